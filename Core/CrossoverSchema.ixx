@@ -38,5 +38,33 @@ namespace Geneticxx {
 		 * @note The implementation should ensure that at least one child genome is returned.
 		 */
 		[[nodiscard]] virtual std::vector<std::unique_ptr<Genome>> crossover(Genome* parent1, Genome* parent2) = 0;
+
+		/**
+		 * @brief Performs the crossover operation writing the offspring into existing genomes.
+		 *
+		 * This is the allocation-free counterpart of `crossover`, used when the children's storage is recycled
+		 * between generations. The default implementation calls `crossover` and assigns its results to the
+		 * given genomes with `Genome::assign`; operators able to recombine in place should override it.
+		 *
+		 * @param parent1 First genome used in generating child genomes.
+		 * @param parent2 Second genome used in generating child genomes.
+		 * @param child1 Genome receiving the first child.
+		 * @param child2 Genome receiving the second child, or nullptr if only one child is needed.
+		 *
+		 * @return Number of children written, 1 or 2.
+		 *
+		 * @throws std::invalid_argument if a child genome cannot be assigned in place.
+		 */
+		virtual size_t crossoverInto(Genome* parent1, Genome* parent2, Genome* child1, Genome* child2) {
+			auto children = crossover(parent1, parent2);
+			Genome* targets[] = {child1, child2};
+			size_t written = 0;
+			for (; written < children.size() && written < 2 && targets[written] != nullptr; written++) {
+				if (!targets[written]->assign(children[written].get())) {
+					throw std::invalid_argument("Child genome does not support in-place assignment");
+				}
+			}
+			return written;
+		}
 	};
 }
@@ -6,6 +6,31 @@ export import Population;
 import std;
 
 namespace Geneticxx {
+	/**
+	 * @brief Callback invoked once an individual submitted with `Dispatcher::dispatchAsync` has been evaluated.
+	 *
+	 * It is called on the thread that evaluated the individual, before the future returned by `dispatchAsync`
+	 * becomes ready, with `succeeded` set to false if an evaluation threw; the exception is stored in the future.
+	 */
+	export using EvaluationCompletion = std::function<void(Individual *individual, bool succeeded)>;
+
+	/**
+	 * @brief Evaluates a single individual with all evaluations and stores its objective scores.
+	 *
+	 * The scores of all evaluations are concatenated in their order.
+	 *
+	 * @param individual Individual to evaluate, its phenome is decoded if needed.
+	 * @param evaluation Evaluations applied to the individual.
+	 */
+	export inline void evaluateIndividual(Individual *individual,
+	                                      std::vector<std::unique_ptr<Evaluation> > *evaluation) {
+		std::vector<double> scores;
+		for (const auto &current: *evaluation) {
+			scores.append_range(current->evaluate(individual->getPhenome()));
+		}
+		individual->setObjectiveScore(&scores);
+	}
+
 	/**
 	 * @class Dispatcher
 	 * @brief Class responsible for executing evaluations on the population.
@@ -32,10 +57,171 @@ namespace Geneticxx {
 		 * logic that connects a population with a set of evaluations. It ensures that the
 		 * population is properly evaluated by the given evaluation objects.
 		 *
+		 * Implementations state whether `dispatch` is reentrant, i.e. whether one dispatcher may be called from
+		 * several threads at once, as the islands of `GeneticAlgorithmSimple` do.
+		 *
 		 * @param population Pointer to the Population object that will be evaluated.
 		 * @param evaluation Pointer to a vector of unique pointers to Evaluation objects
 		 *        that will be used to evaluate the population.
 		 */
 		virtual void dispatch(Population *population, std::vector<std::unique_ptr<Evaluation> > *evaluation) = 0;
+
+		/**
+		 * @brief Submits a single individual for evaluation without waiting for the result.
+		 *
+		 * Used by algorithms without a generational barrier, which keep breeding while earlier offspring are
+		 * still being evaluated. The individual and the evaluations must stay alive, and the individual must not
+		 * be accessed, until the returned future is ready. Dispatchers owning worker threads evaluate the
+		 * individual on one of them, so the evaluations must be thread-safe. The default implementation
+		 * evaluates the individual on the calling thread and returns a ready future.
+		 *
+		 * @param individual Individual to evaluate.
+		 * @param evaluation Evaluations applied to the individual.
+		 * @param completion Callback invoked once the individual is evaluated, may be empty; must not throw.
+		 *
+		 * @return Future becoming ready once the objective scores are stored, holding the exception thrown by an
+		 *         evaluation if any.
+		 */
+		virtual std::future<void> dispatchAsync(Individual *individual,
+		                                        std::vector<std::unique_ptr<Evaluation> > *evaluation,
+		                                        EvaluationCompletion completion) {
+			std::promise<void> promise;
+			auto result = promise.get_future();
+			completeEvaluation(individual, evaluation, completion, promise);
+			return result;
+		}
+
+	protected:
+		/**
+		 * @brief Evaluates an individual submitted with `dispatchAsync`, notifies the completion and fulfils
+		 *        the promise, in this order.
+		 *
+		 * @param individual Individual to evaluate.
+		 * @param evaluation Evaluations applied to the individual.
+		 * @param completion Callback invoked once the individual is evaluated, may be empty; must not throw.
+		 * @param promise Promise receiving the result of the evaluation.
+		 */
+		static void completeEvaluation(Individual *individual, std::vector<std::unique_ptr<Evaluation> > *evaluation,
+		                               const EvaluationCompletion &completion, std::promise<void> &promise) {
+			std::exception_ptr failure;
+			try {
+				evaluateIndividual(individual, evaluation);
+			} catch (...) {
+				failure = std::current_exception();
+			}
+			if (completion) {
+				completion(individual, failure == nullptr);
+			}
+			if (failure) {
+				promise.set_exception(failure);
+			} else {
+				promise.set_value();
+			}
+		}
 	};
+
+	/**
+	 * @brief Evaluates the individuals [begin, end) of a population and stores their objective scores.
+	 *
+	 * Shared by the dispatchers for each contiguous chunk they process. When every evaluation reports its
+	 * number of objectives, the chunk is passed to `Evaluation::evaluateBatch` as a whole; otherwise the
+	 * individuals are evaluated one at a time with `Evaluation::evaluate`. The scores of all evaluations are
+	 * concatenated in their order.
+	 *
+	 * @param population Population holding the individuals.
+	 * @param begin Index of the first individual to evaluate.
+	 * @param end Index one past the last individual to evaluate.
+	 * @param evaluation Evaluations applied to every individual.
+	 */
+	export inline void evaluateRange(Population *population, std::size_t begin, std::size_t end,
+	                                 std::vector<std::unique_ptr<Evaluation> > *evaluation) {
+		std::size_t objectives = 0;
+		for (const auto &current: *evaluation) {
+			if (current->getObjectivesNumber() == 0) {
+				objectives = 0;
+				break;
+			}
+			objectives += current->getObjectivesNumber();
+		}
+
+		std::vector<double> temp;
+		if (objectives == 0 || begin >= end) {
+			for (std::size_t i = begin; i < end; i++) {
+				temp.clear();
+				for (const auto &current: *evaluation) {
+					temp.append_range(current->evaluate(population->getIndividual(i)->getPhenome()));
+				}
+				population->getIndividual(i)->setObjectiveScore(&temp);
+			}
+			return;
+		}
+
+		const std::size_t count = end - begin;
+		std::vector<const Phenome *> phenomes(count);
+		for (std::size_t i = 0; i < count; i++) {
+			phenomes[i] = population->getIndividual(begin + i)->getPhenome();
+		}
+		// the scores of each evaluation form their own block of count * objectivesNumber values
+		std::vector<double> scores(count * objectives);
+		std::size_t offset = 0;
+		for (const auto &current: *evaluation) {
+			const std::size_t size = count * current->getObjectivesNumber();
+			current->evaluateBatch(phenomes, std::span<double>(scores).subspan(offset, size));
+			offset += size;
+		}
+		temp.resize(objectives);
+		for (std::size_t i = 0; i < count; i++) {
+			offset = 0;
+			std::size_t position = 0;
+			for (const auto &current: *evaluation) {
+				const std::size_t number = current->getObjectivesNumber();
+				std::copy_n(scores.begin() + offset + i * number, number, temp.begin() + position);
+				offset += count * number;
+				position += number;
+			}
+			population->getIndividual(begin + i)->setObjectiveScore(&temp);
+		}
+	}
+
+	/**
+	 * @brief Updates the objective scores of an individual after a tracked mutation.
+	 *
+	 * The individual must hold the scores of its genome before the mutation and an up to date (or invalidated)
+	 * phenome. When every evaluation supports `Evaluation::evaluateDelta` for the changes, the scores are
+	 * updated from the changed genes only; otherwise the individual is evaluated from scratch.
+	 *
+	 * The genetic algorithms do not call it, as the children they mutate have not been evaluated yet; it serves
+	 * callers mutating evaluated individuals, such as local searches.
+	 *
+	 * @param individual Individual mutated with `MutationSchema::mutateTracked`.
+	 * @param changes Genes changed by the mutation.
+	 * @param evaluation Evaluations that produced the previous scores.
+	 *
+	 * @return `true` if the scores were updated incrementally, `false` if the individual was evaluated again.
+	 */
+	export inline bool evaluateChanges(Individual *individual, std::span<const GeneChange> changes,
+	                                   std::vector<std::unique_ptr<Evaluation> > *evaluation) {
+		auto scores = individual->getObjectiveScore();
+		const Phenome *phenome = individual->getPhenome();
+		std::size_t offset = 0;
+		bool updated = true;
+		for (const auto &current: *evaluation) {
+			const std::size_t number = current->getObjectivesNumber();
+			if (number == 0 || offset + number > scores.size() ||
+			    !current->evaluateDelta(phenome, changes, std::span<double>(scores).subspan(offset, number))) {
+				updated = false;
+				break;
+			}
+			offset += number;
+		}
+		if (!updated || offset != scores.size()) {
+			scores.clear();
+			for (const auto &current: *evaluation) {
+				scores.append_range(current->evaluate(phenome));
+			}
+			updated = false;
+		}
+		individual->setObjectiveScore(&scores);
+		return updated;
+	}
 }
@@ -40,5 +40,67 @@ namespace Geneticxx {
 		 *       of one value.
 		 */
 		virtual std::vector<double> evaluate(const Phenome *phenome) = 0;
+
+		/**
+		 * @brief Returns the number of objective scores `evaluate` returns for every phenome.
+		 *
+		 * A non-zero value lets dispatchers evaluate contiguous chunks of a population with `evaluateBatch`.
+		 * The default implementation returns 0, meaning that the number is unknown and phenomes are
+		 * evaluated one at a time.
+		 *
+		 * @return Number of objective scores per phenome, or 0 if it is unknown.
+		 */
+		virtual size_t getObjectivesNumber() const {
+			return 0;
+		}
+
+		/**
+		 * @brief Evaluates a batch of phenomes at once.
+		 *
+		 * The scores of phenome `i` are written to `scores[i * getObjectivesNumber()]` and the following
+		 * `getObjectivesNumber() - 1` elements. Implementations override it to process the whole batch with
+		 * vectorized loops and without allocating a result per phenome. The default implementation calls
+		 * `evaluate` for every phenome. It may be called concurrently from several threads.
+		 *
+		 * @param phenomes Phenomes that are subjected to evaluation.
+		 * @param scores Output buffer of `phenomes.size() * getObjectivesNumber()` scores.
+		 *
+		 * @throws std::invalid_argument If the number of objectives is unknown, the output buffer is too
+		 *         small or `evaluate` returns a different number of scores.
+		 */
+		virtual void evaluateBatch(std::span<const Phenome *const> phenomes, std::span<double> scores) {
+			const size_t objectives = getObjectivesNumber();
+			if (objectives == 0 || scores.size() < phenomes.size() * objectives) {
+				throw std::invalid_argument("Output buffer does not fit the scores of the batch");
+			}
+			for (size_t i = 0; i < phenomes.size(); i++) {
+				auto result = evaluate(phenomes[i]);
+				if (result.size() != objectives) {
+					throw std::invalid_argument("Evaluation returned an unexpected number of scores");
+				}
+				std::ranges::copy(result, scores.begin() + i * objectives);
+			}
+		}
+
+		/**
+		 * @brief Updates the objective scores of a phenome after some of its values changed.
+		 *
+		 * Implementations that can derive the new scores from the changed positions alone override it to run
+		 * in time proportional to the number of changes rather than to the size of the phenome. The positions
+		 * index the values of the phenome, so it is only meaningful for phenomes holding their genes as is,
+		 * e.g. `Phenome1DNoTranslation`. The default implementation does not support delta evaluation.
+		 * It may be called concurrently from several threads.
+		 *
+		 * @param phenome Phenome after the change.
+		 * @param changes Changed positions with their previous values, see `MutationSchema::mutateTracked`.
+		 * @param scores The `getObjectivesNumber()` scores of the phenome before the change, replaced with the
+		 *        scores after the change.
+		 *
+		 * @return `true` if `scores` were updated, `false` if the phenome has to be evaluated with `evaluate`.
+		 */
+		virtual bool evaluateDelta(const Phenome *phenome, std::span<const GeneChange> changes,
+		                           std::span<double> scores) {
+			return false;
+		}
 	};
 }
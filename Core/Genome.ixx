@@ -1,5 +1,6 @@
 export module Genome;
 
+export import PoolAllocated;
 import std;
 import std.compat;
 
@@ -12,7 +13,7 @@ namespace Geneticxx {
      * in the context of a genetic algorithm. It provides methods for creating, cloning,
      * comparing, and manipulating genome data.
      */
-    export class Genome {
+    export class Genome : public PoolAllocated {
     public:
         /**
          * @brief Virtual destructor to ensure proper cleanup of derived class objects.
@@ -74,5 +75,149 @@ namespace Geneticxx {
          */
         virtual bool operator==(Genome *other) const = 0;
 
+        /**
+         * @brief Overwrites this genome with the contents of another genome, reusing the storage of this genome.
+         *
+         * This method lets algorithms recycle genomes between generations instead of cloning new ones.
+         * The default implementation does not support in-place assignment and leaves the genome untouched.
+         *
+         * @param other Pointer to the Genome instance to copy from.
+         * @return True if the genome now equals `other`, false if it cannot take its contents in place.
+         */
+        virtual bool assign(const Genome *other) {
+            return false;
+        }
+
+        /**
+         * @brief Returns a hash of the genome's contents.
+         *
+         * Equal genomes must have equal hashes. The hash is used to look up the results of earlier evaluations
+         * of the same genome. The default implementation returns no value, meaning that the genome cannot be
+         * hashed and its evaluations are never reused.
+         *
+         * @return Hash of the genome, or std::nullopt if the genome does not support hashing.
+         */
+        virtual std::optional<std::size_t> hash() const {
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Appends the contents of the genome to a byte buffer.
+         *
+         * Used to send genomes to other processes, e.g. migrants of the multi-process island model. The bytes are
+         * only meant to be read by `deserialize` of a genome of the same type on a machine of the same byte order.
+         * The default implementation does not support serialization and leaves the buffer untouched.
+         *
+         * @param buffer Buffer the serialized genome is appended to.
+         * @return True if the genome was serialized, false if it does not support serialization.
+         */
+        virtual bool serialize(std::vector<std::byte> &buffer) const {
+            return false;
+        }
+
+        /**
+         * @brief Replaces the contents of the genome with bytes written by `serialize`.
+         *
+         * The default implementation does not support serialization and leaves the genome untouched.
+         *
+         * @param bytes Bytes written by `serialize` of a genome of the same type.
+         * @return True if the genome was read, false if it does not support serialization or the bytes are malformed.
+         */
+        virtual bool deserialize(std::span<const std::byte> bytes) {
+            return false;
+        }
+
+        /**
+         * @brief Marks the genes in [begin, end) as modified since the phenome was last decoded from this genome.
+         *
+         * Operators writing genes directly through a typed view call it for the positions they change, so that
+         * only the modified region is decoded again. Writes through `Genome1D::setValue` and `assign` are marked
+         * by the genome itself. The default implementation does not track modifications.
+         *
+         * @param begin Index of the first modified gene.
+         * @param end Index one past the last modified gene.
+         */
+        virtual void markDirty(size_t begin, size_t end) {
+        }
+
+        /**
+         * @brief Returns the range of genes modified since the last call to `clearDirty`.
+         *
+         * The default implementation does not track modifications and always reports the whole genome.
+         *
+         * @return Pair [begin, end) of gene indices, empty (begin >= end) when nothing was modified.
+         */
+        virtual std::pair<size_t, size_t> getDirtyRange() const {
+            return {0, getSize()};
+        }
+
+        /**
+         * @brief Marks all genes as unmodified, called once the phenome has been decoded from this genome.
+         */
+        virtual void clearDirty() {
+        }
+    };
+
+    /**
+     * @struct GeneChange
+     * @brief Record of a single gene changed by a mutation, see `MutationSchema::mutateTracked`.
+     */
+    export struct GeneChange {
+        /// Index of the changed gene.
+        size_t position;
+        /// Value of the gene before the change, held as the genome's value type.
+        std::any previousValue;
+    };
+
+    /**
+     * @class GenomeDirtyRange
+     * @brief Helper tracking the hull of modified genes for genomes implementing `Genome::markDirty`.
+     *
+     * A freshly created range covers the whole genome, since no phenome has been decoded from it yet.
+     */
+    export class GenomeDirtyRange {
+    private:
+        size_t m_Begin = 0;
+        size_t m_End = std::numeric_limits<size_t>::max();
+
+    public:
+        /**
+         * @brief Extends the range to cover [begin, end). Empty ranges are ignored.
+         */
+        void mark(size_t begin, size_t end) {
+            if (begin >= end) {
+                return;
+            }
+            if (m_Begin >= m_End) {
+                m_Begin = begin;
+                m_End = end;
+                return;
+            }
+            m_Begin = std::min(m_Begin, begin);
+            m_End = std::max(m_End, end);
+        }
+
+        /**
+         * @brief Extends the range to cover the whole genome, whatever its size.
+         */
+        void markAll() {
+            m_Begin = 0;
+            m_End = std::numeric_limits<size_t>::max();
+        }
+
+        /**
+         * @brief Empties the range.
+         */
+        void clear() {
+            m_Begin = 0;
+            m_End = 0;
+        }
+
+        /**
+         * @brief Returns the range clamped to a genome of `size` genes.
+         */
+        [[nodiscard]] std::pair<size_t, size_t> get(size_t size) const {
+            return {std::min(m_Begin, size), std::min(m_End, size)};
+        }
     };
 }
@@ -45,4 +45,172 @@ namespace Geneticxx {
         virtual void setValue(size_t position, std::any value) = 0;
 
     };
+
+    /**
+     * @brief Type in which genes of type `T` are stored by genomes and phenomes exposing a typed view.
+     *
+     * `std::vector<bool>` is bit-packed and cannot be viewed through a `std::span`, so boolean genes are
+     * stored one per byte instead. For every other type the storage type is `T` itself.
+     */
+    export template<typename T>
+    using GeneStorage = std::conditional_t<std::is_same_v<T, bool>, std::uint8_t, T>;
+
+    /**
+     * @class Genome1DView
+     * @brief Typed, contiguous access to the genes of a one-dimensional genome.
+     *
+     * Genomes storing their genes in a contiguous buffer implement this interface next to `Genome1D`.
+     * Operators and phenomes query it with `dynamic_cast` once per call and then work on a `std::span`
+     * directly, which avoids boxing every gene into `std::any`. `Genome1D::getValue` and `Genome1D::setValue`
+     * remain available as the slow path for genomes that do not implement it.
+     *
+     * @tparam T Type of the genes, as returned in `std::any` by `Genome1D::getValue`.
+     */
+    export template<typename T>
+    class Genome1DView {
+    public:
+        /**
+         * @brief Virtual destructor to ensure proper cleanup of derived class objects.
+         */
+        virtual ~Genome1DView() {}
+
+        /**
+         * @brief Returns a read-only view of all genes.
+         *
+         * @return Span over the genes, valid until the genome is resized or destroyed.
+         */
+        [[nodiscard]] virtual std::span<const GeneStorage<T>> getValues() const = 0;
+
+        /**
+         * @brief Returns a mutable view of all genes.
+         *
+         * Writes through the span are not tracked by the genome; callers report the genes they change with
+         * `Genome::markDirty`.
+         *
+         * @return Span over the genes, valid until the genome is resized or destroyed.
+         */
+        [[nodiscard]] virtual std::span<GeneStorage<T>> getValues() = 0;
+    };
+
+    /**
+     * @class GenomeBitsView
+     * @brief Packed, word-level access to the bits of a one-dimensional boolean genome.
+     *
+     * Bit `i` of the genome is bit `i % 64` of word `i / 64`. Bits of the last word past `Genome::getSize` are
+     * always zero, so whole words can be compared, hashed and counted directly. Operators query it with
+     * `dynamic_cast` like `Genome1DView` and work on 64 genes at a time.
+     */
+    export class GenomeBitsView {
+    public:
+        /**
+         * @brief Number of bits held by a single word.
+         */
+        static constexpr size_t BitsPerWord = 64;
+
+        /**
+         * @brief Virtual destructor to ensure proper cleanup of derived class objects.
+         */
+        virtual ~GenomeBitsView() {}
+
+        /**
+         * @brief Returns a read-only view of all words.
+         *
+         * @return Span over the words, valid until the genome is resized or destroyed.
+         */
+        [[nodiscard]] virtual std::span<const std::uint64_t> getWords() const = 0;
+
+        /**
+         * @brief Returns a mutable view of all words.
+         *
+         * Callers must keep the bits past the end of the genome zero and report the bits they change with
+         * `Genome::markDirty`.
+         *
+         * @return Span over the words, valid until the genome is resized or destroyed.
+         */
+        [[nodiscard]] virtual std::span<std::uint64_t> getWords() = 0;
+
+        /**
+         * @brief Returns a mask of the `count` lowest bits of a word, `count` being at most `BitsPerWord`.
+         */
+        static constexpr std::uint64_t lowBits(size_t count) {
+            return count >= BitsPerWord ? ~std::uint64_t{0} : (std::uint64_t{1} << count) - 1;
+        }
+    };
+
+    /**
+     * @brief Returns the packed bits view of a genome, or nullptr if the genome does not expose one.
+     *
+     * Constness of the genome is carried over to the returned view.
+     */
+    export template<typename GenomeType>
+    auto *asGenomeBits(GenomeType *genome) {
+        if constexpr (std::is_const_v<GenomeType>) {
+            return dynamic_cast<const GenomeBitsView *>(genome);
+        } else {
+            return dynamic_cast<GenomeBitsView *>(genome);
+        }
+    }
+
+    /**
+     * @brief Combines the hashes of all values, together with their number, into a single hash.
+     *
+     * Helper for `Genome::hash` of genomes storing their genes contiguously.
+     */
+    export template<typename T>
+    std::size_t hashValues(std::span<const T> values) {
+        std::size_t seed = std::hash<std::size_t>{}(values.size());
+        for (const auto &value: values) {
+            seed ^= std::hash<T>{}(value) + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+    }
+
+    /**
+     * @brief Returns the typed view of a genome, or nullptr if the genome does not expose one for type `T`.
+     *
+     * Constness of the genome is carried over to the returned view.
+     */
+    export template<typename T, typename GenomeType>
+    auto *asGenomeView(GenomeType *genome) {
+        if constexpr (std::is_const_v<GenomeType>) {
+            return dynamic_cast<const Genome1DView<T> *>(genome);
+        } else {
+            return dynamic_cast<Genome1DView<T> *>(genome);
+        }
+    }
+
+    /**
+     * @brief Calls `function` with the typed spans of all `genomes` if every one of them exposes a view of type `T`.
+     *
+     * @return True if the function was called, false otherwise.
+     */
+    export template<typename T, typename Function, typename... GenomeTypes>
+    bool visitValuesAs(Function &function, GenomeTypes *... genomes) {
+        if (((asGenomeView<T>(genomes) != nullptr) && ...)) {
+            function(asGenomeView<T>(genomes)->getValues()...);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Calls `function` with the typed spans of all `genomes` for the first of `Types` they all expose.
+     *
+     * This is the entry point of the typed fast path used by the built-in operators: when it returns false
+     * the operator falls back to `Genome1D::getValue` and `Genome1D::setValue`.
+     *
+     * @return True if the function was called, false if the genomes do not share any of the typed views.
+     */
+    export template<typename... Types, typename Function, typename... GenomeTypes>
+    bool visitValues(Function &&function, GenomeTypes *... genomes) {
+        return (visitValuesAs<Types>(function, genomes...) || ...);
+    }
+
+    /**
+     * @brief `visitValues` over the gene types used by the built-in genomes.
+     */
+    export template<typename Function, typename... GenomeTypes>
+    bool visitCommonValues(Function &&function, GenomeTypes *... genomes) {
+        return visitValues<bool, int, long long, float, double>(std::forward<Function>(function), genomes...);
+    }
 }
@@ -2,6 +2,7 @@ export module Individual; // interface for individual implementations
 
 export import Genome;
 export import Phenome;
+import PoolAllocated;
 import std;
 
 namespace Geneticxx {
@@ -13,7 +14,7 @@ namespace Geneticxx {
      * consisting of both a genome and a phenome. It provides methods for retrieving and setting the
      * fitness and objective scores, as well as for manipulating the genome and phenome.
      */
-    export class Individual {
+    export class Individual : public PoolAllocated {
     public:
         /**
          * @brief Virtual destructor to ensure proper cleanup of derived class objects.
@@ -93,6 +94,17 @@ namespace Geneticxx {
          */
         virtual void updatePhenome() = 0;
 
+        /**
+         * @brief Marks the phenome as out of date with the genome.
+         *
+         * Unlike `updatePhenome`, implementations may postpone decoding until the phenome is read through
+         * `getPhenome`, so that individuals whose phenome is never read, e.g. ones whose evaluation is served
+         * from a cache, are never decoded. The default implementation updates the phenome immediately.
+         */
+        virtual void invalidatePhenome() {
+            updatePhenome();
+        }
+
         /**
          * @brief Returns a pointer to the genome of the individual.
          *
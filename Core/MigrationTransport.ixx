@@ -0,0 +1,133 @@
+export module MigrationTransport;
+
+export import Individual;
+import std;
+import std.compat;
+
+namespace Geneticxx {
+    /**
+     * @class MigrationTransport
+     * @brief Class responsible for delivering messages between islands living in separate processes.
+     *
+     * Every process of a multi-process island model owns one transport, identified by the index of its island.
+     * Messages are opaque byte strings, delivered whole and in order per pair of islands, without any guarantee
+     * of delivery: migration is best effort, so transports drop messages that do not fit instead of blocking
+     * the evolution.
+     */
+    export class MigrationTransport {
+    public:
+        /**
+         * @brief Virtual destructor to ensure proper cleanup of derived class objects.
+         */
+        virtual ~MigrationTransport() {
+        }
+
+        /**
+         * @brief Returns the index of the island owning the transport.
+         *
+         * @return Index of the island, less than `getIslandsNumber()`.
+         */
+        virtual size_t getIslandIndex() const = 0;
+
+        /**
+         * @brief Returns the number of islands connected by the transport.
+         *
+         * @return Number of islands.
+         */
+        virtual size_t getIslandsNumber() const = 0;
+
+        /**
+         * @brief Sends a message to another island without waiting for it to be read.
+         *
+         * @param target Index of the receiving island.
+         * @param message Bytes of the message.
+         * @return True if the message was handed over, false if it was dropped, e.g. because the target is not
+         *         reachable yet or its buffer is full.
+         */
+        virtual bool send(size_t target, std::span<const std::byte> message) = 0;
+
+        /**
+         * @brief Takes the next message received by this island, without waiting for one.
+         *
+         * @param message Buffer replaced with the bytes of the message.
+         * @return True if a message was received, false if no message is waiting.
+         */
+        virtual bool receive(std::vector<std::byte> &message) = 0;
+    };
+
+    /**
+     * @brief Appends an individual, i.e. its genome, objective scores and fitness, to a message.
+     *
+     * @param individual Individual to serialize.
+     * @param message Buffer the individual is appended to.
+     * @return True if the individual was appended, false if its genome does not support `Genome::serialize`.
+     */
+    export inline bool serializeIndividual(const Individual *individual, std::vector<std::byte> &message) {
+        const std::size_t start = message.size();
+        std::uint64_t genomeBytes = 0;
+        auto appendValue = [&message](const auto &value) {
+            const auto bytes = std::as_bytes(std::span(&value, 1));
+            message.insert(message.end(), bytes.begin(), bytes.end());
+        };
+        appendValue(genomeBytes);
+        if (!individual->getGenome()->serialize(message)) {
+            message.resize(start);
+            return false;
+        }
+        // the genome's size is only known once it is written
+        genomeBytes = message.size() - start - sizeof(genomeBytes);
+        std::memcpy(message.data() + start, &genomeBytes, sizeof(genomeBytes));
+
+        const auto scores = individual->getObjectiveScore();
+        appendValue(static_cast<std::uint64_t>(scores.size()));
+        const auto scoreBytes = std::as_bytes(std::span(scores));
+        message.insert(message.end(), scoreBytes.begin(), scoreBytes.end());
+        appendValue(individual->getFitness());
+        return true;
+    }
+
+    /**
+     * @brief Reads an individual written by `serializeIndividual` into an existing individual.
+     *
+     * The genome of `individual` has to be of the type that was serialized. The phenome is invalidated, so it is
+     * decoded from the new genome once it is read.
+     *
+     * @param bytes Message holding the individual at its beginning.
+     * @param individual Individual receiving the genome, objective scores and fitness.
+     * @return Number of bytes read, or 0 if the bytes are malformed or the genome cannot be deserialized.
+     */
+    export inline std::size_t deserializeIndividual(std::span<const std::byte> bytes, Individual *individual) {
+        std::size_t offset = 0;
+        auto readValue = [&bytes, &offset](auto &value) {
+            if (bytes.size() - offset < sizeof(value)) {
+                return false;
+            }
+            std::memcpy(&value, bytes.data() + offset, sizeof(value));
+            offset += sizeof(value);
+            return true;
+        };
+        std::uint64_t genomeBytes;
+        if (!readValue(genomeBytes) || genomeBytes > bytes.size() - offset ||
+            !individual->getGenome()->deserialize(bytes.subspan(offset, genomeBytes))) {
+            return 0;
+        }
+        offset += genomeBytes;
+
+        std::uint64_t scoresNumber;
+        if (!readValue(scoresNumber) || scoresNumber > (bytes.size() - offset) / sizeof(double)) {
+            return 0;
+        }
+        std::vector<double> scores(scoresNumber);
+        for (auto &score: scores) {
+            readValue(score);
+        }
+        double fitness;
+        if (!readValue(fitness)) {
+            return 0;
+        }
+        individual->setObjectiveScore(&scores);
+        individual->setFitness(fitness);
+        individual->invalidatePhenome();
+        return offset;
+    }
+}
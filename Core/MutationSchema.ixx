@@ -45,6 +45,37 @@ public:
      */
     virtual void mutate(Genome *genome) = 0;
 
+    /**
+     * @brief Applies a mutation operation and reports the genes it changed.
+     *
+     * Appends a `GeneChange` for every changed gene, each position at most once, so that evaluations can
+     * update the previous scores of the genome with `Evaluation::evaluateDelta` instead of evaluating it again.
+     * The default implementation calls `mutate` and does not report the changes.
+     *
+     * @param genome Pointer to the `Genome` object to be mutated.
+     * @param changes Vector receiving the changed genes with their values before the mutation.
+     * @return `true` if `changes` lists every changed gene, `false` if the changes are unknown.
+     */
+    virtual bool mutateTracked(Genome *genome, std::vector<GeneChange> &changes) {
+        mutate(genome);
+        return false;
+    }
+
+    /**
+     * @brief Applies the mutation to the single gene at the given position.
+     *
+     * Point mutations implement it so that wrappers such as `MutatorPerGene` choose the mutated genes. The default
+     * implementation does not support it and leaves the genome unchanged.
+     *
+     * @param genome Pointer to the `Genome` object to be mutated.
+     * @param position Index of the gene to mutate, less than the genome's size.
+     * @param changes Vector receiving the changed gene with its value before the mutation, or nullptr.
+     * @return `true` if the gene was mutated, `false` if the mutation cannot target a given gene.
+     */
+    virtual bool mutateAt(Genome *genome, size_t position, std::vector<GeneChange> *changes) {
+        return false;
+    }
+
     /**
      * @brief Checks if the mutation schema is valid for the given genome.
      *
@@ -45,4 +45,30 @@ namespace Geneticxx {
          */
         virtual void setValue(size_t position, std::any value) = 0; // TODO: Change to return specific types
     };
+
+    /**
+     * @class Phenome1DView
+     * @brief Typed, contiguous access to the values of a one-dimensional phenome.
+     *
+     * The phenome counterpart of `Genome1DView`. Evaluations query it with `dynamic_cast` once per call and read
+     * the values through a `std::span`, keeping `Phenome1D::getValue` only as the slow path for phenomes that
+     * do not implement it. Boolean values are stored one per byte, see `GeneStorage`.
+     *
+     * @tparam T Type of the values, as returned in `std::any` by `Phenome1D::getValue`.
+     */
+    export template<typename T>
+    class Phenome1DView {
+    public:
+        /**
+         * @brief Virtual destructor to ensure proper cleanup of derived class objects.
+         */
+        virtual ~Phenome1DView() {}
+
+        /**
+         * @brief Returns a read-only view of all values.
+         *
+         * @return Span over the values, valid until the phenome is updated or destroyed.
+         */
+        [[nodiscard]] virtual std::span<const GeneStorage<T>> getValues() const = 0;
+    };
 }
@@ -1,6 +1,7 @@
 export module Phenome;
 
 export import Genome;
+import PoolAllocated;
 import std;
 
 namespace Geneticxx {
@@ -11,7 +12,7 @@ namespace Geneticxx {
      * The `Phenome` class represents the external expression or manifestation of a genome after it has undergone some transformation.
      * It provides methods to update the phenome based on a genome, as well as methods for manipulating its values and comparing phenomes.
      */
-    export class Phenome {
+    export class Phenome : public PoolAllocated {
     public:
         /**
          * @brief Virtual destructor to ensure proper cleanup of derived class objects.
@@ -33,6 +34,21 @@ namespace Geneticxx {
          */
         virtual void updatePhenome(const Genome *genome) = 0;
 
+        /**
+         * @brief Updates the part of the phenome that depends on the genes in [begin, end).
+         *
+         * Called instead of `updatePhenome` when the phenome was already decoded from the same genome and only
+         * the given genes changed since then, see `Genome::getDirtyRange`. Implementations may update more than
+         * the requested part; the default implementation updates the whole phenome.
+         *
+         * @param genome Pointer to the `Genome` object used for updating the phenome.
+         * @param begin Index of the first modified gene.
+         * @param end Index one past the last modified gene.
+         */
+        virtual void updatePhenomeRange(const Genome *genome, size_t begin, size_t end) {
+            updatePhenome(genome);
+        }
+
         /**
          * @brief Creates a new instance of the phenome with default values.
          *
@@ -0,0 +1,94 @@
+export module PoolAllocated;
+
+import std;
+import std.compat;
+
+namespace Geneticxx {
+    /// Resource new individuals, genomes, phenomes and populations are allocated from, null for the default one.
+    inline std::atomic<std::pmr::memory_resource *> objectResource{nullptr};
+
+    /**
+     * @brief Sets the memory resource new individuals, genomes, phenomes and populations are allocated from.
+     *
+     * Objects remember the resource they were allocated from, so the resource can be changed at any time; it has
+     * to outlive every object allocated from it.
+     *
+     * @param resource The resource, e.g. a `GenerationPool`, or nullptr for `std::pmr::get_default_resource`.
+     */
+    export inline void setObjectResource(std::pmr::memory_resource *resource) {
+        objectResource.store(resource, std::memory_order_release);
+    }
+
+    /**
+     * @brief Returns the memory resource new individuals, genomes, phenomes and populations are allocated from.
+     */
+    export inline std::pmr::memory_resource *getObjectResource() {
+        auto resource = objectResource.load(std::memory_order_acquire);
+        return resource != nullptr ? resource : std::pmr::get_default_resource();
+    }
+
+    /**
+     * @class ObjectResourceScope
+     * @brief Sets the object resource for the lifetime of the scope and restores the previous one afterwards.
+     */
+    export class ObjectResourceScope {
+    private:
+        std::pmr::memory_resource *m_Previous; ///< Resource restored when the scope ends.
+
+    public:
+        /**
+         * @brief Sets the object resource.
+         *
+         * @param resource The resource, or nullptr for the default one.
+         */
+        explicit ObjectResourceScope(std::pmr::memory_resource *resource)
+            : m_Previous{objectResource.exchange(resource, std::memory_order_acq_rel)} {
+        }
+
+        ObjectResourceScope(const ObjectResourceScope &) = delete;
+
+        ObjectResourceScope &operator=(const ObjectResourceScope &) = delete;
+
+        ~ObjectResourceScope() {
+            objectResource.store(m_Previous, std::memory_order_release);
+        }
+    };
+
+    /**
+     * @class PoolAllocated
+     * @brief Base class routing `new` and `delete` of the derived classes to the object resource.
+     *
+     * Every object is preceded by a small header holding the resource it was allocated from, so objects are
+     * always returned to the right resource, even through a base class pointer and after the object resource
+     * changed. With a size-class pool such as `GenerationPool`, the individuals, genomes and phenomes cloned for
+     * a generation reuse the blocks freed by the generation before instead of going through `malloc`.
+     */
+    export class PoolAllocated {
+    private:
+        /// Size of the header in front of every object, keeping the objects aligned like `new` does.
+        static constexpr std::size_t HeaderSize = alignof(std::max_align_t);
+
+        static_assert(HeaderSize >= sizeof(std::pmr::memory_resource *));
+
+    public:
+        static void *operator new(std::size_t size) {
+            auto resource = getObjectResource();
+            auto block = static_cast<std::byte *>(resource->allocate(size + HeaderSize, alignof(std::max_align_t)));
+            std::memcpy(block, &resource, sizeof(resource));
+            return block + HeaderSize;
+        }
+
+        static void operator delete(void *pointer, std::size_t size) noexcept {
+            if (pointer == nullptr) {
+                return;
+            }
+            auto block = static_cast<std::byte *>(pointer) - HeaderSize;
+            std::pmr::memory_resource *resource;
+            std::memcpy(&resource, block, sizeof(resource));
+            resource->deallocate(block, size + HeaderSize, alignof(std::max_align_t));
+        }
+
+    protected:
+        ~PoolAllocated() = default;
+    };
+}
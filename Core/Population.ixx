@@ -1,6 +1,7 @@
 export module Population;
 
 export import Individual;
+import PoolAllocated;
 import std;
 import std.compat;
 
@@ -12,7 +13,7 @@ namespace Geneticxx {
      * The `Population` class represents a collection of individuals, typically used in evolutionary algorithms.
      * It provides methods to manage the individuals, track the population's size, and handle iterations for the algorithm's progression.
      */
-    export class Population {
+    export class Population : public PoolAllocated {
     public:
         /**
          * @brief Virtual destructor to ensure proper cleanup of derived class objects.
@@ -64,6 +65,34 @@ namespace Geneticxx {
          */
         virtual void setIndividual(size_t i, Individual *individual) = 0;
 
+        /**
+         * @brief Takes the Individual at the specified index out of the Population.
+         *
+         * Ownership passes to the caller, so individuals can be moved between populations without being cloned.
+         * The slot must be set again with `setIndividual` before it is read. The default implementation returns
+         * a clone and leaves the slot unchanged, which suits populations not storing individuals as objects.
+         *
+         * @param i The index of the `Individual` to take.
+         * @return A pointer to the `Individual`, owned by the caller.
+         */
+        virtual Individual* releaseIndividual(size_t i) {
+            return getIndividual(i)->clone();
+        }
+
+        /**
+         * @brief Exchanges the individuals of this Population with those of another one without copying them.
+         *
+         * Only the storage of the individuals is exchanged, together with the sizes; iterations and any other
+         * state stay with their populations, and the versions of both change. Implementations exchange their
+         * storage in O(1) with populations of their own type. The default implementation exchanges nothing.
+         *
+         * @param other The Population to exchange the individuals with.
+         * @return True if the individuals were exchanged, false if the storages are not compatible.
+         */
+        virtual bool swapIndividuals(Population *other) {
+            return false;
+        }
+
         /**
          * @brief Returns the current occupied size of the Population.
          *
@@ -119,5 +148,65 @@ namespace Geneticxx {
          * This method removes all individuals from the population, effectively resetting it to an empty state.
          */
         virtual void clear() = 0;
+
+        /**
+         * @brief Returns a number that changes whenever the individuals held by the Population may have changed.
+         *
+         * Operators caching data derived from a population, such as the selection distribution of
+         * `SelectorRoulette`, compare it between calls to detect that their cache is stale. Implementations
+         * change it in `setIndividual`, `resize`, `clear` and `increaseIteration`; modifying an individual
+         * obtained through `getIndividual` does not change it. The default implementation returns the iteration.
+         *
+         * @return The current version of the Population.
+         */
+        virtual size_t getVersion() const {
+            return getIteration();
+        }
     };
+
+    /**
+     * @class PopulationFitnessView
+     * @brief Flat, read-only access to the fitness of every Individual in a Population.
+     *
+     * Populations keeping fitness values in a contiguous buffer implement this interface next to `Population`,
+     * so that selectors and statistics can scan fitness as a plain array instead of calling
+     * `getIndividual(i)->getFitness()` for every individual.
+     */
+    export class PopulationFitnessView {
+    public:
+        /**
+         * @brief Virtual destructor to ensure proper cleanup of derived class objects.
+         */
+        virtual ~PopulationFitnessView() {
+        }
+
+        /**
+         * @brief Returns the fitness values of all individuals, indexed like the population.
+         *
+         * @return Span over the fitness values, valid until the population is resized or destroyed.
+         */
+        [[nodiscard]] virtual std::span<const double> getFitnessValues() const = 0;
+    };
+
+    /**
+     * @brief Returns the fitness of every individual of the population as a flat array.
+     *
+     * When the population implements `PopulationFitnessView` its own buffer is returned without copying.
+     * Otherwise the fitness values are read from the individuals one by one into `buffer`, which is resized
+     * to the size of the population; reusing the same buffer between calls avoids allocations.
+     *
+     * @param population Population to read the fitness from.
+     * @param buffer Scratch buffer used when the population has no flat fitness storage.
+     * @return Span over the fitness values, indexed like the population.
+     */
+    export inline std::span<const double> viewFitness(Population *population, std::vector<double> &buffer) {
+        if (auto flat = dynamic_cast<const PopulationFitnessView *>(population)) {
+            return flat->getFitnessValues();
+        }
+        buffer.resize(population->getSize());
+        for (size_t i = 0; i < buffer.size(); i++) {
+            buffer[i] = population->getIndividual(i)->getFitness();
+        }
+        return buffer;
+    }
 }
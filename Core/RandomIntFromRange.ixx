@@ -5,6 +5,21 @@ import std;
 import std.compat;
 
 namespace Geneticxx {
+    /**
+     * @brief SplitMix64 finalizer, a bijective mix of 64 bits.
+     *
+     * Used to derive well separated seeds and stream identifiers from consecutive numbers.
+     *
+     * @param value Value to mix.
+     * @return The mixed value; distinct inputs give distinct outputs.
+     */
+    export constexpr std::uint64_t splitMix64(std::uint64_t value) {
+        value += 0x9E3779B97F4A7C15ull;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
     /**
      * @class RandomIntFromRange
      * @brief A base class for generating random integers within a specified range.
@@ -41,6 +56,105 @@ namespace Geneticxx {
          * @return A random integer between min and max (inclusive).
          */
         virtual int generate(int min, int max) = 0;
+
+        /**
+         * @brief Fills a buffer with random integers within the given range.
+         *
+         * Bulk draws avoid one virtual call per value. The default implementation calls `generate` for every value.
+         *
+         * @param min The minimum value of the range.
+         * @param max The maximum value of the range.
+         * @param values Buffer receiving random integers between min and max (inclusive).
+         */
+        virtual void generate(int min, int max, std::span<int> values) {
+            for (auto &value: values) {
+                value = generate(min, max);
+            }
+        }
+
+        /**
+         * @brief Fills a buffer with words of 64 independent, equally likely random bits.
+         *
+         * The default implementation builds every word from four draws of 16 bits.
+         *
+         * @param words Buffer to fill.
+         */
+        virtual void generateBits(std::span<std::uint64_t> words) {
+            for (auto &word: words) {
+                word = 0;
+                for (int i = 0; i < 4; i++) {
+                    word = (word << 16) | static_cast<std::uint64_t>(generate(0, 0xFFFF));
+                }
+            }
+        }
+
+        /**
+         * @brief Fills a buffer with words whose bits are independently set with the given probability.
+         *
+         * The probability is rounded to a multiple of 2^-32 and every digit of its binary expansion, from the
+         * lowest set one up to 2^-1, combines one random word into the mask: `mask | random` for a one,
+         * `mask & random` for a zero. Every 64 bits thus cost at most 32 random words instead of 64 draws, and
+         * just one for 0.5 or two for 0.25 and 0.75. Very small probabilities are cheaper to sample by skipping
+         * over the unset bits.
+         *
+         * @param probability Probability of every bit being set, clamped to [0, 1].
+         * @param words Buffer receiving the mask.
+         */
+        void generateMask(double probability, std::span<std::uint64_t> words) {
+            if (!(probability > 0.0) || probability >= 1.0) {
+                std::ranges::fill(words, probability >= 1.0 ? ~std::uint64_t{0} : 0);
+                return;
+            }
+            auto fraction = static_cast<std::uint64_t>(std::llround(std::ldexp(probability, 32)));
+            if (fraction >> 32 != 0) {
+                std::ranges::fill(words, ~std::uint64_t{0});
+                return;
+            }
+            std::ranges::fill(words, 0);
+            if (fraction == 0) {
+                return;
+            }
+            std::array<std::uint64_t, 32> random;
+            for (size_t start = 0; start < words.size(); start += random.size()) {
+                const auto chunk = words.subspan(start, std::min(random.size(), words.size() - start));
+                const auto draws = std::span{random.data(), chunk.size()};
+                for (int digit = std::countr_zero(fraction); digit < 32; digit++) {
+                    generateBits(draws);
+                    const bool set = (fraction >> digit & 1) != 0;
+                    for (size_t i = 0; i < chunk.size(); i++) {
+                        chunk[i] = set ? chunk[i] | draws[i] : chunk[i] & draws[i];
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Creates an independent generator for the given stream.
+         *
+         * Every thread, island or individual can get its own stream, so generators are never shared between
+         * threads. The new generator only depends on this generator's seed and stream and on `streamId`, so the
+         * same split always produces the same sequence; splitting does not advance this generator.
+         *
+         * @param streamId Identifier of the stream, e.g. the index of the thread.
+         * @return The new generator, or nullptr if the generator cannot be split. The default returns nullptr.
+         */
+        [[nodiscard]] virtual std::unique_ptr<RandomIntFromRange> split(std::uint64_t streamId) const {
+            return nullptr;
+        }
+
+        /**
+         * @brief Restarts the generator at the beginning of the sequence `split(streamId)` would draw.
+         *
+         * Streams are derived from the seed and stream the generator was created with, so reseeding with the
+         * same identifier always repeats the same sequence, whatever was drawn before. Unlike `split` it neither
+         * allocates nor invalidates the pointers operators keep to the generator.
+         *
+         * @param streamId Identifier of the stream.
+         * @return False if the generator cannot be split, leaving it unchanged. The default returns false.
+         */
+        virtual bool reseed(std::uint64_t streamId) {
+            return false;
+        }
     };
 
 }
@@ -41,6 +41,45 @@ namespace Geneticxx {
          * @return A random real number between min and max (inclusive).
          */
         virtual double generate(double min, double max) = 0;
+
+        /**
+         * @brief Fills a buffer with random real numbers within the given range.
+         *
+         * Bulk draws avoid one virtual call per value. The default implementation calls `generate` for every value.
+         *
+         * @param min The minimum value of the range.
+         * @param max The maximum value of the range.
+         * @param values Buffer receiving random real numbers between min and max.
+         */
+        virtual void generate(double min, double max, std::span<double> values) {
+            for (auto &value: values) {
+                value = generate(min, max);
+            }
+        }
+
+        /**
+         * @brief Creates an independent generator for the given stream.
+         *
+         * See `RandomIntFromRange::split`.
+         *
+         * @param streamId Identifier of the stream, e.g. the index of the thread.
+         * @return The new generator, or nullptr if the generator cannot be split. The default returns nullptr.
+         */
+        [[nodiscard]] virtual std::unique_ptr<RandomRealFromRange> split(std::uint64_t streamId) const {
+            return nullptr;
+        }
+
+        /**
+         * @brief Restarts the generator at the beginning of the sequence `split(streamId)` would draw.
+         *
+         * See `RandomIntFromRange::reseed`.
+         *
+         * @param streamId Identifier of the stream.
+         * @return False if the generator cannot be split, leaving it unchanged. The default returns false.
+         */
+        virtual bool reseed(std::uint64_t streamId) {
+            return false;
+        }
     };
 
 }
@@ -36,4 +36,34 @@ namespace Geneticxx {
          */
         virtual Population* replace(Population *originalPopulation, Population *replacingPopulation) = 0;
     };
+
+    /**
+     * @brief Orders the indices of individuals so that the `count` best of them come first.
+     *
+     * Uses `std::nth_element`, so it runs in O(n) on average; neither part of the result is sorted. Ties are
+     * broken towards the lower index and NaN fitness is worse than any other value, so the partition is
+     * deterministic.
+     *
+     * @param fitness Fitness of every individual.
+     * @param count Number of best individuals to move to the front, clamped to the number of individuals.
+     * @param maximize True if a higher fitness is better.
+     * @param order Buffer receiving the indices; reusing it between calls avoids allocations.
+     */
+    export inline void partitionBest(std::span<const double> fitness, std::size_t count, bool maximize,
+                                     std::vector<std::size_t> &order) {
+        order.resize(fitness.size());
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        if (count == 0 || count >= order.size()) {
+            return;
+        }
+        auto key = [&fitness, maximize](std::size_t i) {
+            const double value = maximize ? fitness[i] : -fitness[i];
+            return std::isnan(value) ? -std::numeric_limits<double>::infinity() : value;
+        };
+        std::ranges::nth_element(order, order.begin() + count, [&key](std::size_t first, std::size_t second) {
+            const double a = key(first);
+            const double b = key(second);
+            return a > b || (a == b && first < second);
+        });
+    }
 }
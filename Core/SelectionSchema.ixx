@@ -2,6 +2,8 @@ export module SelectionSchema;
 
 export import Individual;
 export import Population;
+export import RandomIntFromRange;
+export import RandomRealFromRange;
 import std;
 import std.compat;
 
@@ -39,6 +41,54 @@ namespace Geneticxx {
          */
         virtual std::vector<std::unique_ptr<Individual>> select(Population *population, size_t size) = 0;
 
+        /**
+         * @brief Selects individuals from the given population and writes their indices, without copying them.
+         *
+         * This is the allocation-free counterpart of `select`: one individual is selected for every element of
+         * `indices`, following the same strategy. Callers read the selected individuals directly from the
+         * population through `Population::getIndividual`. The default implementation does not support index
+         * selection and leaves `indices` untouched, in which case callers fall back to `select`.
+         *
+         * @param population Pointer to the population from which individuals will be selected.
+         * @param indices Output span receiving the indices of the selected individuals.
+         *
+         * @return True if `indices` were written, false if the schema does not support index selection.
+         */
+        virtual bool selectIndices(Population *population, std::span<size_t> indices) {
+            return false;
+        }
+
+        /**
+         * @brief Builds the state selections from the population rely on, e.g. a table of its fitness values.
+         *
+         * Called once before `selectIndicesWith` is called from several threads, so that they share one state
+         * instead of building it each. The default implementation does nothing.
+         *
+         * @param population Pointer to the population individuals will be selected from.
+         */
+        virtual void prepare(Population *population) {
+        }
+
+        /**
+         * @brief Selects individuals like `selectIndices`, drawing from the given generators instead of the
+         *        schema's own and without modifying the schema.
+         *
+         * Safe to call concurrently once the schema was prepared for the population with `prepare`, so threads
+         * owning their generators share the selection state. The default implementation does not support it.
+         *
+         * @param population Pointer to the population from which individuals will be selected.
+         * @param indices Output span receiving the indices of the selected individuals.
+         * @param genInt Integer generator to draw from, may be null if the schema does not need one.
+         * @param genReal Real generator to draw from, may be null if the schema does not need one.
+         *
+         * @return True if `indices` were written, false if the schema does not support it, was not prepared for
+         *         the population or misses a generator; callers fall back to `selectIndices` then.
+         */
+        virtual bool selectIndicesWith(Population *population, std::span<size_t> indices, RandomIntFromRange *genInt,
+                                       RandomRealFromRange *genReal) const {
+            return false;
+        }
+
         /**
          * @note The population should ideally be `const` to prevent modifications. However, this would require
          * the `getIndividual` method to be a `const` function as well, which would prevent modification of individuals.
@@ -0,0 +1,137 @@
+export module ThreadTeam;
+
+import std;
+
+namespace Geneticxx {
+    /**
+     * @class ThreadTeam
+     * @brief Fixed group of threads running one job at a time, kept alive between jobs.
+     *
+     * Generational algorithms split every generation into a short parallel job. Starting and joining threads for
+     * each of them would cost a large share of a generation when evaluations are cheap, so the team's threads
+     * stay asleep between jobs instead. The thread calling `run` takes part as member 0, so a team of n members
+     * owns n - 1 threads. Jobs are run one at a time: `run` must not be called concurrently.
+     */
+    export class ThreadTeam {
+    private:
+        std::mutex m_Mutex; ///< Guards all members below.
+        std::condition_variable m_WakeUp; ///< Signalled when a job is started or the team is stopped.
+        std::condition_variable m_Finished; ///< Signalled when the last thread finished its part of a job.
+        const std::function<void(std::size_t)> *m_Job = nullptr; ///< Job being run, null between jobs.
+        std::size_t m_Members = 0; ///< Number of members taking part in the current job.
+        std::size_t m_Running = 0; ///< Threads that did not finish their part of the current job yet.
+        std::size_t m_Round = 0; ///< Number of jobs started, lets sleeping threads tell a new job apart.
+        std::exception_ptr m_Failure; ///< First exception thrown by a thread in the current job.
+        bool m_Stop = false; ///< Set when the team is destroyed.
+        std::vector<std::jthread> m_Threads; ///< Members 1 to n - 1, declared last so they start last.
+
+        void loop(std::size_t member) {
+            std::size_t seenRound = 0;
+            while (true) {
+                const std::function<void(std::size_t)> *job;
+                {
+                    std::unique_lock lock(m_Mutex);
+                    m_WakeUp.wait(lock, [this, seenRound] { return m_Stop || m_Round != seenRound; });
+                    if (m_Stop) {
+                        return;
+                    }
+                    seenRound = m_Round;
+                    if (member >= m_Members) {
+                        continue;
+                    }
+                    job = m_Job;
+                }
+                std::exception_ptr failure;
+                try {
+                    (*job)(member);
+                } catch (...) {
+                    failure = std::current_exception();
+                }
+                std::lock_guard lock(m_Mutex);
+                if (failure && !m_Failure) {
+                    m_Failure = failure;
+                }
+                if (--m_Running == 0) {
+                    m_Finished.notify_one();
+                }
+            }
+        }
+
+    public:
+        /**
+         * @brief Starts the threads of the team.
+         *
+         * @param members Number of members including the thread calling `run`; 0 is treated as 1.
+         */
+        explicit ThreadTeam(std::size_t members) {
+            for (std::size_t member = 1; member < members; member++) {
+                m_Threads.emplace_back([this, member] { loop(member); });
+            }
+        }
+
+        ThreadTeam(const ThreadTeam &) = delete;
+
+        ThreadTeam &operator=(const ThreadTeam &) = delete;
+
+        /**
+         * @brief Stops and joins the threads.
+         */
+        ~ThreadTeam() {
+            {
+                std::lock_guard lock(m_Mutex);
+                m_Stop = true;
+            }
+            m_WakeUp.notify_all();
+            m_Threads.clear(); // joins
+        }
+
+        /**
+         * @brief Returns the number of members, including the thread calling `run`.
+         */
+        std::size_t getSize() const {
+            return m_Threads.size() + 1;
+        }
+
+        /**
+         * @brief Runs `job(member)` for the members [0, members) and waits until all of them returned.
+         *
+         * Member 0 runs on the calling thread. Members typically claim work items from a shared atomic counter.
+         *
+         * @param job Job run by every member, given the index of the member.
+         * @param members Number of members taking part, at most `getSize()`.
+         *
+         * @throws The first exception thrown by a member, once all members returned.
+         */
+        void run(const std::function<void(std::size_t)> &job, std::size_t members) {
+            members = std::clamp<std::size_t>(members, 1, getSize());
+            {
+                std::lock_guard lock(m_Mutex);
+                m_Job = &job;
+                m_Members = members;
+                m_Running = members - 1;
+                m_Failure = nullptr;
+                m_Round++;
+            }
+            if (members > 1) {
+                m_WakeUp.notify_all();
+            }
+            std::exception_ptr failure;
+            try {
+                job(0);
+            } catch (...) {
+                failure = std::current_exception();
+            }
+            {
+                std::unique_lock lock(m_Mutex);
+                m_Finished.wait(lock, [this] { return m_Running == 0; });
+                m_Job = nullptr;
+                if (!failure) {
+                    failure = m_Failure;
+                }
+            }
+            if (failure) {
+                std::rethrow_exception(failure);
+            }
+        }
+    };
+}
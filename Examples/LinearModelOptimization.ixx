@@ -15,7 +15,7 @@ import Phenome1DNoTranslation;
 // ------ Genetic algorithm components ------
 
 // Genetic algorithm
-import GeneticAlgorithmSimple;
+import GeneticAlgorithmSteadyState;
 
 // Initialization
 import InitializeWithCopies;
@@ -30,13 +30,11 @@ import MutatorReplacement;
 import Mutator1DRandomValueAddition;
 
 // Selection
-import SelectorRoulette;
+import SelectorTournament;
 
 // Stopping criterion
 import StoppingCriterionMaxGenerations;
 
-// Replacement
-import ReplacementFull;
 
 // Evaluation
 import Evaluation;
@@ -80,6 +78,12 @@ namespace Geneticxx
         ~EvaluationLinear() override = default;
         std::vector<double> evaluate(const Phenome *phenomeBase) override
         {
+            if (auto typed = dynamic_cast<const Phenome1DView<double>*>(phenomeBase))
+            {
+                auto values = typed->getValues();
+                double result = std::inner_product(x.begin(), x.end(), values.begin(), 0.0);
+                return {std::abs(y - result) + 0.000001};
+            }
             auto phenome = dynamic_cast<const Phenome1D*>(phenomeBase); // ideally this should be type checked earlier
             double result = 0;
             for (int i = 0; i < 6; i++)
@@ -89,6 +93,48 @@ namespace Geneticxx
             std::vector<double> resultVector = {std::abs(y - result) + 0.000001};
             return resultVector;
         }
+
+        size_t getObjectivesNumber() const override
+        {
+            return 1;
+        }
+
+        void evaluateBatch(std::span<const Phenome *const> phenomes, std::span<double> scores) override
+        {
+            const bool typed = std::ranges::all_of(phenomes, [this](const Phenome *phenome) {
+                auto view = dynamic_cast<const Phenome1DView<double>*>(phenome);
+                return view != nullptr && view->getValues().size() >= x.size();
+            });
+            if (!typed)
+            {
+                Evaluation::evaluateBatch(phenomes, scores);
+                return;
+            }
+            // coefficients are stored column by column, so each product runs over the whole batch at once
+            const size_t count = phenomes.size();
+            std::vector<double> columns(x.size() * count);
+            for (size_t i = 0; i < count; i++)
+            {
+                auto values = dynamic_cast<const Phenome1DView<double>*>(phenomes[i])->getValues();
+                for (size_t j = 0; j < x.size(); j++)
+                {
+                    columns[j * count + i] = values[j];
+                }
+            }
+            std::fill_n(scores.begin(), count, 0.0);
+            for (size_t j = 0; j < x.size(); j++)
+            {
+                const double *column = columns.data() + j * count;
+                for (size_t i = 0; i < count; i++)
+                {
+                    scores[i] += x[j] * column[i];
+                }
+            }
+            for (size_t i = 0; i < count; i++)
+            {
+                scores[i] = std::abs(y - scores[i]) + 0.000001;
+            }
+        }
     };
 }
 
@@ -114,16 +160,14 @@ int main(int argc, char *argv[]) {
 
     HistoryBasic *history = new HistoryBasic(new StatisticsBasic());
 
-    auto geneticAlgorithm = std::make_unique<GeneticAlgorithmSimple>( //TODO change this to a steady-state algorithm
+    // Steady-state algorithm: every step breeds two children which replace the worst individuals
+    auto geneticAlgorithm = std::make_unique<GeneticAlgorithmSteadyState>(
         // Create a new population using PopulationSimple
         &populationVector,
 
         // Define the evaluation method for fitness calculation
         new EvaluationLinear(), //TODO
 
-        // Specify the replacement schema for the population
-        new ReplacementFull(),
-
         // Define the crossover operation
         new CrossoverSinglePoint(genInt),
 
@@ -135,13 +179,14 @@ int main(int argc, char *argv[]) {
         //new ScalingWithout(),
         new ScalingInverse(),
 
-        // Specify the selection method for reproduction
-        new SelectorRoulette(genReal),
+        // Specify the selection method for reproduction; every step replaces an individual, so a roulette would
+        // rebuild its O(N) table every step, while a tournament only looks at its participants
+        new SelectorTournament(genInt, 3),
 
         // Initialize the population with 100 copies of an IndividualSimple
         initializer,
 
-        // Define the stopping criterion (max 100 generations)
+        // Define the stopping criterion (max 100 generations, i.e. 100 * population size children)
         new StoppingCriterionMaxGenerations(100),
 
         // Define a dispatcher for managing tasks (no dispatching in this case)
@@ -0,0 +1,43 @@
+// Benchmark of SelectorRoulette: draws a whole generation's worth of parents (two per child) from populations
+// of growing size. With the alias table built once per population version the time per individual stays flat,
+// i.e. a generation scales linearly with the population size.
+
+// Population
+import PopulationSoA;
+
+// Selection
+import SelectorRoulette;
+
+// Random numbers generator
+import DefaultUniformRealRandomGenerator;
+
+import std;
+
+using namespace Geneticxx;
+
+int main(int argc, char *argv[]) {
+    DefaultUniformRealRandomGenerator genReal(42);
+    SelectorRoulette selector(&genReal);
+
+    std::cout << "individuals | generation [ms] | per individual [ns]" << std::endl;
+    for (size_t size = 1'000; size <= 1'000'000; size *= 10) {
+        PopulationSoA<bool> population(1);
+        population.resize(size);
+        for (size_t i = 0; i < size; i++) {
+            population.setFitness(i, genReal.generate(0, 100));
+        }
+        population.increaseIteration(); // fitness is written in place, announce the new generation
+
+        std::vector<size_t> parents(2 * size);
+        std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+        selector.selectIndices(&population, parents);
+
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+
+        std::cout << size << " | " << elapsed / 1'000'000.0 << " | "
+                  << static_cast<double>(elapsed) / static_cast<double>(size) << std::endl;
+    }
+    return 0;
+}
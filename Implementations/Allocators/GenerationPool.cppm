@@ -0,0 +1,75 @@
+module GenerationPool;
+
+namespace Geneticxx {
+    namespace {
+        /// Raises an atomic maximum to at least the given value.
+        void raiseMaximum(std::atomic<size_t> &maximum, size_t value) {
+            size_t current = maximum.load(std::memory_order_relaxed);
+            while (current < value && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            }
+        }
+    }
+
+    GenerationPool::GenerationPool(const std::pmr::pool_options &options, std::pmr::memory_resource *upstream)
+        : m_Pool{options, upstream} {
+    }
+
+    void *GenerationPool::do_allocate(size_t bytes, size_t alignment) {
+        void *pointer = m_Pool.allocate(bytes, alignment);
+        m_Allocations.fetch_add(1, std::memory_order_relaxed);
+        m_GenerationAllocations.fetch_add(1, std::memory_order_relaxed);
+        m_BytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+        m_GenerationBytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+        const size_t inUse = m_BytesInUse.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        raiseMaximum(m_PeakBytesInUse, inUse);
+        raiseMaximum(m_GenerationPeakBytesInUse, inUse);
+        return pointer;
+    }
+
+    void GenerationPool::do_deallocate(void *pointer, size_t bytes, size_t alignment) {
+        m_Pool.deallocate(pointer, bytes, alignment);
+        m_Deallocations.fetch_add(1, std::memory_order_relaxed);
+        m_GenerationDeallocations.fetch_add(1, std::memory_order_relaxed);
+        m_BytesInUse.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    bool GenerationPool::do_is_equal(const std::pmr::memory_resource &other) const noexcept {
+        return this == &other;
+    }
+
+    GenerationPoolStatistics GenerationPool::getStatistics() const {
+        return {
+            m_Allocations.load(std::memory_order_relaxed),
+            m_Deallocations.load(std::memory_order_relaxed),
+            m_BytesAllocated.load(std::memory_order_relaxed),
+            m_BytesInUse.load(std::memory_order_relaxed),
+            m_PeakBytesInUse.load(std::memory_order_relaxed)
+        };
+    }
+
+    GenerationPoolStatistics GenerationPool::endGeneration() {
+        const size_t inUse = m_BytesInUse.load(std::memory_order_relaxed);
+        return {
+            m_GenerationAllocations.exchange(0, std::memory_order_relaxed),
+            m_GenerationDeallocations.exchange(0, std::memory_order_relaxed),
+            m_GenerationBytesAllocated.exchange(0, std::memory_order_relaxed),
+            inUse,
+            m_GenerationPeakBytesInUse.exchange(inUse, std::memory_order_relaxed)
+        };
+    }
+
+    void GenerationPool::release() {
+        if (m_BytesInUse.load(std::memory_order_acquire) != 0) {
+            throw std::logic_error("GenerationPool released while objects allocated from it are alive");
+        }
+        m_Pool.release();
+        m_Allocations.store(0, std::memory_order_relaxed);
+        m_Deallocations.store(0, std::memory_order_relaxed);
+        m_BytesAllocated.store(0, std::memory_order_relaxed);
+        m_PeakBytesInUse.store(0, std::memory_order_relaxed);
+        m_GenerationAllocations.store(0, std::memory_order_relaxed);
+        m_GenerationDeallocations.store(0, std::memory_order_relaxed);
+        m_GenerationBytesAllocated.store(0, std::memory_order_relaxed);
+        m_GenerationPeakBytesInUse.store(0, std::memory_order_relaxed);
+    }
+}
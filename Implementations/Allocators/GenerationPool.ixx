@@ -0,0 +1,93 @@
+export module GenerationPool;
+
+export import PoolAllocated;
+import std;
+import std.compat;
+
+namespace Geneticxx {
+    /**
+     * @struct GenerationPoolStatistics
+     * @brief Allocations and bytes served by a `GenerationPool`.
+     */
+    export struct GenerationPoolStatistics {
+        size_t allocations = 0; ///< Number of blocks allocated.
+        size_t deallocations = 0; ///< Number of blocks deallocated.
+        size_t bytesAllocated = 0; ///< Number of bytes allocated.
+        size_t bytesInUse = 0; ///< Number of bytes allocated and not deallocated yet.
+        size_t peakBytesInUse = 0; ///< Maximum of `bytesInUse`.
+    };
+
+    /**
+     * @class GenerationPool
+     * @brief Thread-safe size-class pool for the objects of a genetic algorithm, counting what it serves.
+     *
+     * Every generation clones roughly as many individuals, genomes and phenomes as the generation before
+     * destroyed, all of few distinct sizes. Set as the object resource, see `setObjectResource`, the pool keeps
+     * the freed blocks in per-size free lists, so after the first generations new objects reuse the blocks of
+     * the discarded ones instead of going through `malloc`. `release` returns all the memory in bulk once no
+     * object is alive any more, e.g. at the end of a run.
+     *
+     * Elites and other survivors outlive the generation they were created in, so blocks are recycled rather
+     * than freed at the end of every generation; `endGeneration` closes the statistics of a generation instead.
+     *
+     * The pool has to outlive every object allocated from it.
+     */
+    export class GenerationPool : public std::pmr::memory_resource {
+    private:
+        std::pmr::synchronized_pool_resource m_Pool; ///< Pool serving the blocks.
+
+        std::atomic<size_t> m_Allocations{0}; ///< Blocks allocated since the last release.
+        std::atomic<size_t> m_Deallocations{0}; ///< Blocks deallocated since the last release.
+        std::atomic<size_t> m_BytesAllocated{0}; ///< Bytes allocated since the last release.
+        std::atomic<size_t> m_BytesInUse{0}; ///< Bytes currently allocated.
+        std::atomic<size_t> m_PeakBytesInUse{0}; ///< Maximum of the bytes in use since the last release.
+
+        std::atomic<size_t> m_GenerationAllocations{0}; ///< Blocks allocated in the current generation.
+        std::atomic<size_t> m_GenerationDeallocations{0}; ///< Blocks deallocated in the current generation.
+        std::atomic<size_t> m_GenerationBytesAllocated{0}; ///< Bytes allocated in the current generation.
+        std::atomic<size_t> m_GenerationPeakBytesInUse{0}; ///< Maximum of the bytes in use in the current generation.
+
+    protected:
+        void *do_allocate(size_t bytes, size_t alignment) override;
+
+        void do_deallocate(void *pointer, size_t bytes, size_t alignment) override;
+
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+    public:
+        /**
+         * @brief Constructor for GenerationPool.
+         *
+         * @param options Size classes and chunk sizes of the pool, see `std::pmr::pool_options`.
+         * @param upstream Resource the pool takes its chunks from.
+         */
+        explicit GenerationPool(const std::pmr::pool_options &options = {},
+                                std::pmr::memory_resource *upstream = std::pmr::get_default_resource());
+
+        GenerationPool(const GenerationPool &) = delete;
+
+        GenerationPool &operator=(const GenerationPool &) = delete;
+
+        /**
+         * @brief Returns the statistics since the pool was created or last released.
+         */
+        GenerationPoolStatistics getStatistics() const;
+
+        /**
+         * @brief Closes the statistics of the current generation and starts the next one.
+         *
+         * To be called between generations, e.g. by an observer of the population.
+         *
+         * @return Statistics of the generation just closed; `bytesInUse` is the number of bytes still in use,
+         * i.e. held by the objects surviving into the next generation.
+         */
+        GenerationPoolStatistics endGeneration();
+
+        /**
+         * @brief Returns all the memory of the pool to the upstream resource and resets the statistics.
+         *
+         * @throws std::logic_error If objects allocated from the pool are still alive.
+         */
+        void release();
+    };
+}
@@ -31,6 +31,22 @@ namespace Geneticxx {
             int iter1 = 0;
             int iter2 = 0;
 
+            auto child1Typed = asGenomeView<T>(child1.get());
+            auto child2Typed = asGenomeView<T>(child2.get());
+            auto parent1Typed = asGenomeView<T>(parent1);
+            auto parent2Typed = asGenomeView<T>(parent2);
+            if (child1Typed && child2Typed && parent1Typed && parent2Typed)
+            {
+                orderTyped(parent1Typed->getValues(), parent2Typed->getValues(),
+                           child1Typed->getValues(), child2Typed->getValues(), point1);
+                child1->markDirty(point1, size);
+                child2->markDirty(point1, size);
+                std::vector<std::unique_ptr<Genome>> results;
+                results.push_back(std::move(child1));
+                results.push_back(std::move(child2));
+                return std::move(results);
+            }
+
             auto child1ptr = dynamic_cast<Genome1D*> (child1.get()); //TODO questionable casts
             auto child2ptr = dynamic_cast<Genome1D*> (child2.get());
             auto parent1ptr = dynamic_cast<Genome1D*> (parent1);
@@ -79,5 +95,41 @@ namespace Geneticxx {
             results.push_back(std::move(child2));
             return std::move(results);
         }
+
+    private:
+        /**
+         * @brief Order crossover performed directly on the typed genes.
+         *
+         * Each child keeps the prefix [0, point) of its own parent and the remaining positions are filled with the
+         * genes of the other parent that are missing from that prefix, in the order they appear in the other parent.
+         * A hash set of the prefix replaces the quadratic rescans of the `std::any` path.
+         */
+        static void orderTyped(std::span<const GeneStorage<T>> parent1, std::span<const GeneStorage<T>> parent2,
+                               std::span<GeneStorage<T>> child1, std::span<GeneStorage<T>> child2, size_t point)
+        {
+            auto fill = [point](std::span<const GeneStorage<T>> own, std::span<const GeneStorage<T>> other,
+                                std::span<GeneStorage<T>> child)
+            {
+                std::unordered_set<GeneStorage<T>> prefix(own.begin(), own.begin() + point);
+                size_t position = point;
+                for (const auto &gene : other)
+                {
+                    if (position == child.size())
+                    {
+                        break;
+                    }
+                    if (!prefix.contains(gene))
+                    {
+                        child[position++] = gene;
+                    }
+                }
+                if (position != child.size())
+                {
+                    throw std::invalid_argument("Order crossover requires both parents to be permutations of the same genes");
+                }
+            };
+            fill(parent1, parent2, child1);
+            fill(parent2, parent1, child2);
+        }
     };
 }
@@ -5,26 +5,52 @@ namespace Geneticxx {
 
     CrossoverSinglePoint::~CrossoverSinglePoint() = default;
 
-    std::vector<std::unique_ptr<Genome> > CrossoverSinglePoint::crossover(Genome *parent1, Genome *parent2) {
-        auto child1 = parent1->clone();
-        auto child2 = parent2->clone();
-
+    int CrossoverSinglePoint::drawCutPoint(Genome *parent1, Genome *parent2) {
         // Determine the shorter genome size to avoid out-of-bounds access
         int shorter = parent1->getSize() > parent2->getSize() ? parent2->getSize() : parent1->getSize();
 
         // Generate a random crossover point
-        int cut_point = m_RandomNumbersGeneratorInt->generate(0, shorter - 1);
+        return m_RandomNumbersGeneratorInt->generate(0, shorter - 1);
+    }
 
-        auto child1ptr = dynamic_cast<Genome1D*> (child1.get()); //TODO questionable casts
-        auto child2ptr = dynamic_cast<Genome1D*> (child2.get());
-        auto parent1ptr = dynamic_cast<Genome1D*> (parent1);
-        auto parent2ptr = dynamic_cast<Genome1D*> (parent2);
+    void CrossoverSinglePoint::exchange(Genome *child, Genome *donor, int cutPoint) {
+        // Perform the crossover at the selected point, on typed genes if the genomes expose them
+        const bool typed = visitCommonValues([cutPoint](auto childValues, auto donorValues) {
+            std::copy_n(donorValues.begin(), cutPoint, childValues.begin());
+        }, child, donor);
 
-        // Perform the crossover at the selected point
-        for (int i = 0; i < cut_point; i++) {
-            child1ptr->setValue(i, parent2ptr->getValue(i));
-            child2ptr->setValue(i, parent1ptr->getValue(i));
+        auto childBits = asGenomeBits(child);
+        auto donorBits = asGenomeBits(donor);
+        if (typed) {
+            child->markDirty(0, cutPoint);
+        } else if (childBits != nullptr && donorBits != nullptr) {
+            // whole words below the cut point are copied, the word containing it is blended with a mask
+            auto childWords = childBits->getWords();
+            auto donorWords = donorBits->getWords();
+            const size_t fullWords = cutPoint / GenomeBitsView::BitsPerWord;
+            std::copy_n(donorWords.begin(), fullWords, childWords.begin());
+            if (const size_t rest = cutPoint % GenomeBitsView::BitsPerWord; rest != 0) {
+                const std::uint64_t mask = GenomeBitsView::lowBits(rest);
+                childWords[fullWords] = (childWords[fullWords] & ~mask) | (donorWords[fullWords] & mask);
+            }
+            child->markDirty(0, cutPoint);
+        } else {
+            auto childPtr = dynamic_cast<Genome1D*> (child); //TODO questionable casts
+            auto donorPtr = dynamic_cast<Genome1D*> (donor);
+
+            for (int i = 0; i < cutPoint; i++) {
+                childPtr->setValue(i, donorPtr->getValue(i));
+            }
         }
+    }
+
+    std::vector<std::unique_ptr<Genome> > CrossoverSinglePoint::crossover(Genome *parent1, Genome *parent2) {
+        auto child1 = parent1->clone();
+        auto child2 = parent2->clone();
+
+        int cut_point = drawCutPoint(parent1, parent2);
+        exchange(child1.get(), parent2, cut_point);
+        exchange(child2.get(), parent1, cut_point);
 
         // Return the two children genomes
         std::vector<std::unique_ptr<Genome>> results;
@@ -33,4 +59,18 @@ namespace Geneticxx {
 
         return std::move(results);
     }
+
+    size_t CrossoverSinglePoint::crossoverInto(Genome *parent1, Genome *parent2, Genome *child1, Genome *child2) {
+        if (!child1->assign(parent1) || (child2 != nullptr && !child2->assign(parent2))) {
+            throw std::invalid_argument("Child genome does not support in-place assignment");
+        }
+
+        int cut_point = drawCutPoint(parent1, parent2);
+        exchange(child1, parent2, cut_point);
+        if (child2 == nullptr) {
+            return 1;
+        }
+        exchange(child2, parent1, cut_point);
+        return 2;
+    }
 }
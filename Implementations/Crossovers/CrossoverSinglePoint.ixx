@@ -18,6 +18,16 @@ namespace Geneticxx {
     private:
         RandomIntFromRange* m_RandomNumbersGeneratorInt; /**< Utility for generating random numbers */
 
+        /**
+         * @brief Draws a random crossover point within the shorter of the two parents.
+         */
+        int drawCutPoint(Genome* parent1, Genome* parent2);
+
+        /**
+         * @brief Copies the first `cutPoint` genes of `donor` into `child`.
+         */
+        static void exchange(Genome* child, Genome* donor, int cutPoint);
+
     public:
         /**
          * @brief Constructor for the CrossoverSinglePoint class.
@@ -47,6 +57,23 @@ namespace Geneticxx {
          * @return A vector containing two unique pointers to the child genomes.
          */
         std::vector<std::unique_ptr<Genome>> crossover(Genome* parent1, Genome* parent2) override;
+
+        /**
+         * @brief Performs single-point crossover writing the children into existing genomes.
+         *
+         * Draws the same random numbers as `crossover`, but overwrites `child1` and `child2` in place
+         * instead of cloning the parents.
+         *
+         * @param parent1 Pointer to the first parent genome.
+         * @param parent2 Pointer to the second parent genome.
+         * @param child1 Genome receiving the first child.
+         * @param child2 Genome receiving the second child, or nullptr.
+         *
+         * @return Number of children written.
+         *
+         * @throws std::invalid_argument If a child genome cannot be assigned in place.
+         */
+        size_t crossoverInto(Genome* parent1, Genome* parent2, Genome* child1, Genome* child2) override;
     };
 }
 
@@ -1,11 +1,99 @@
 module CrossoverUniform;
 
 namespace Geneticxx {
+    namespace {
+        /// Mask of the crossover in progress, per thread because islands recombine concurrently.
+        thread_local std::vector<std::uint64_t> maskWords;
+
+        bool isSelected(std::span<const std::uint64_t> mask, size_t gene) {
+            return (mask[gene / 64] >> (gene % 64) & 1) != 0;
+        }
+    }
+
     CrossoverUniform::CrossoverUniform(RandomIntFromRange *genInt) : m_RandomNumbersGeneratorInt{genInt} {
     }
 
     CrossoverUniform::~CrossoverUniform() = default;
 
+    std::span<const std::uint64_t> CrossoverUniform::drawMask(size_t genes) {
+        maskWords.resize((genes + 63) / 64);
+        m_RandomNumbersGeneratorInt->generateBits(maskWords);
+        return maskWords;
+    }
+
+    void CrossoverUniform::recombine(Genome *child1, Genome *child2, Genome *parent1, Genome *parent2) {
+        // the mask is sized from the first parent and the packed path walks the words of the first child
+        const size_t size = parent1->getSize();
+        if (parent2->getSize() != size || child1->getSize() != size || (child2 != nullptr && child2->getSize() != size)) {
+            throw std::invalid_argument("Genomes must have the same size");
+        }
+        const auto mask = drawMask(size);
+        auto child1Bits = asGenomeBits(child1);
+        auto child2Bits = child2 != nullptr ? asGenomeBits(child2) : nullptr;
+        auto parent1Bits = asGenomeBits(parent1);
+        auto parent2Bits = asGenomeBits(parent2);
+        if (child1Bits != nullptr && parent1Bits != nullptr && parent2Bits != nullptr &&
+            (child2 == nullptr || child2Bits != nullptr)) {
+            // packed bits are exchanged a word at a time, the padding bits of both parents are zero and stay so
+            auto child1Words = child1Bits->getWords();
+            auto parent1Words = parent1Bits->getWords();
+            auto parent2Words = parent2Bits->getWords();
+            for (size_t i = 0; i < child1Words.size(); i++) {
+                child1Words[i] = (parent1Words[i] & ~mask[i]) | (parent2Words[i] & mask[i]);
+                if (child2Bits != nullptr) {
+                    child2Bits->getWords()[i] = (parent2Words[i] & ~mask[i]) | (parent1Words[i] & mask[i]);
+                }
+            }
+            child1->markDirty(0, child1->getSize());
+            if (child2 != nullptr) {
+                child2->markDirty(0, child2->getSize());
+            }
+            return;
+        }
+
+        // Perform the uniform crossover for each gene position, on typed genes if the genomes expose them
+        const bool typed = child2 != nullptr
+            ? visitCommonValues([mask](auto child1Values, auto child2Values, auto parent1Values, auto parent2Values) {
+                for (size_t i = 0; i < child1Values.size(); i++) {
+                    if (isSelected(mask, i)) {
+                        child1Values[i] = parent2Values[i];
+                        child2Values[i] = parent1Values[i];
+                    }
+                }
+            }, child1, child2, parent1, parent2)
+            : visitCommonValues([mask](auto child1Values, auto parent2Values) {
+                for (size_t i = 0; i < child1Values.size(); i++) {
+                    if (isSelected(mask, i)) {
+                        child1Values[i] = parent2Values[i];
+                    }
+                }
+            }, child1, parent2);
+
+        if (typed) {
+            // the exchanged genes are scattered over the whole genome
+            child1->markDirty(0, child1->getSize());
+            if (child2 != nullptr) {
+                child2->markDirty(0, child2->getSize());
+            }
+        } else {
+            auto child1ptr = dynamic_cast<Genome1D*> (child1); //TODO questionable casts
+            auto child2ptr = dynamic_cast<Genome1D*> (child2);
+            auto parent1ptr = dynamic_cast<Genome1D*> (parent1);
+            auto parent2ptr = dynamic_cast<Genome1D*> (parent2);
+
+            for (int i = 0; i < parent1->getSize(); i++) {
+                if (!isSelected(mask, i)) {
+                    // No need to change as children already have these values
+                } else {
+                    child1ptr->setValue(i, parent2ptr->getValue(i));
+                    if (child2ptr != nullptr) {
+                        child2ptr->setValue(i, parent1ptr->getValue(i));
+                    }
+                }
+            }
+        }
+    }
+
     std::vector<std::unique_ptr<Genome> > CrossoverUniform::crossover(Genome *parent1, Genome *parent2) {
         // Ensure that both parent genomes are of the same size
         if (parent1->getSize() != parent2->getSize()) {
@@ -15,20 +103,7 @@ namespace Geneticxx {
         auto child1 = parent1->clone();
         auto child2 = parent2->clone();
 
-        auto child1ptr = dynamic_cast<Genome1D*> (child1.get()); //TODO questionable casts
-        auto child2ptr = dynamic_cast<Genome1D*> (child2.get());
-        auto parent1ptr = dynamic_cast<Genome1D*> (parent1);
-        auto parent2ptr = dynamic_cast<Genome1D*> (parent2);
-
-        // Perform the uniform crossover for each gene position
-        for (int i = 0; i < parent1->getSize(); i++) {
-            if (m_RandomNumbersGeneratorInt->generate(0, 1) == 0) {
-                // No need to change as cloned children already have these values
-            } else {
-                child1ptr->setValue(i, parent2ptr->getValue(i));
-                child2ptr->setValue(i, parent1ptr->getValue(i));
-            }
-        }
+        recombine(child1.get(), child2.get(), parent1, parent2);
 
         // Return the two children genomes
         std::vector<std::unique_ptr<Genome> > results;
@@ -37,4 +112,17 @@ namespace Geneticxx {
 
         return std::move(results);
     }
+
+    size_t CrossoverUniform::crossoverInto(Genome *parent1, Genome *parent2, Genome *child1, Genome *child2) {
+        // Ensure that both parent genomes are of the same size
+        if (parent1->getSize() != parent2->getSize()) {
+            throw std::invalid_argument("Genomes must have the same size");
+        }
+        if (!child1->assign(parent1) || (child2 != nullptr && !child2->assign(parent2))) {
+            throw std::invalid_argument("Child genome does not support in-place assignment");
+        }
+
+        recombine(child1, child2, parent1, parent2);
+        return child2 == nullptr ? 1 : 2;
+    }
 }
@@ -13,12 +13,34 @@ namespace Geneticxx {
      * The `CrossoverUniform` class implements a uniform crossover schema for genetic algorithms.
      * It creates two offspring genomes by randomly exchanging genetic material at each gene position between
      * two parent genomes. This class uses a random number generator to decide whether to copy a gene from the first
-     * parent or the second parent at each position.
+     * parent or the second parent at each position; the decisions for all positions are drawn at once as random
+     * 64-bit mask words.
      */
     export class CrossoverUniform : public CrossoverSchema {
     private:
         RandomIntFromRange* m_RandomNumbersGeneratorInt; /**< Utility for generating random numbers */
 
+        /**
+         * @brief Swaps randomly chosen genes of two children initialized as copies of their parents.
+         *
+         * @param child1 Copy of the first parent.
+         * @param child2 Copy of the second parent, or nullptr if only the first child is needed.
+         * @param parent1 Pointer to the first parent genome.
+         * @param parent2 Pointer to the second parent genome.
+         *
+         * @throws std::invalid_argument If the parents and children do not all have the same size.
+         */
+        void recombine(Genome* child1, Genome* child2, Genome* parent1, Genome* parent2);
+
+        /**
+         * @brief Draws one equally likely bit per gene selecting the genes to exchange, in a single bulk call.
+         *
+         * @param genes Number of genes.
+         * @return Mask words, bit `i % 64` of word `i / 64` selects gene `i`; valid until the next call on the
+         *         same thread.
+         */
+        std::span<const std::uint64_t> drawMask(size_t genes);
+
     public:
         /**
          * @brief Constructor for the CrossoverUniform class.
@@ -52,5 +74,23 @@ namespace Geneticxx {
          * @throws std::invalid_argument If the parent genomes have different sizes.
          */
         std::vector<std::unique_ptr<Genome>> crossover(Genome* parent1, Genome* parent2) override;
+
+        /**
+         * @brief Performs uniform crossover writing the children into existing genomes.
+         *
+         * Draws the same random numbers as `crossover`, but overwrites `child1` and `child2` in place
+         * instead of cloning the parents.
+         *
+         * @param parent1 Pointer to the first parent genome.
+         * @param parent2 Pointer to the second parent genome.
+         * @param child1 Genome receiving the first child.
+         * @param child2 Genome receiving the second child, or nullptr.
+         *
+         * @return Number of children written.
+         *
+         * @throws std::invalid_argument If the parent genomes have different sizes or a child genome cannot be
+         *         assigned in place.
+         */
+        size_t crossoverInto(Genome* parent1, Genome* parent2, Genome* child1, Genome* child2) override;
     };
 }
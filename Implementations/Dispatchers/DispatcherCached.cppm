@@ -0,0 +1,122 @@
+module DispatcherCached;
+
+namespace Geneticxx {
+    namespace {
+        // scratch buffer for the scores read from the cache, per thread as dispatch may be called concurrently
+        thread_local std::vector<double> scores;
+
+        /**
+         * @brief Non-owning view of the individuals of a population selected by their indices.
+         *
+         * Dispatchers only read individuals through `getSize` and `getIndividual`, so this is all the wrapped
+         * dispatcher needs to evaluate the cache misses in place. Structural operations are not supported.
+         */
+        class PopulationSubset : public Population {
+        private:
+            Population *m_population;
+            std::span<const std::size_t> m_indices;
+
+        public:
+            PopulationSubset(Population *population, std::span<const std::size_t> indices)
+                : m_population{population}, m_indices{indices} {
+            }
+
+            [[nodiscard]] std::unique_ptr<Population> createNew() const override {
+                throw std::logic_error("PopulationSubset cannot create populations");
+            }
+
+            [[nodiscard]] std::unique_ptr<Population> clone() const override {
+                throw std::logic_error("PopulationSubset cannot be cloned");
+            }
+
+            Individual *getIndividual(size_t i) override {
+                return m_population->getIndividual(m_indices[i]);
+            }
+
+            void setIndividual(size_t i, Individual *individual) override {
+                m_population->setIndividual(m_indices[i], individual);
+            }
+
+            size_t getSize() const override {
+                return m_indices.size();
+            }
+
+            size_t getIteration() const override {
+                return m_population->getIteration();
+            }
+
+            void increaseIteration() override {
+                throw std::logic_error("PopulationSubset cannot change the iteration");
+            }
+
+            void resize(size_t size) override {
+                throw std::logic_error("PopulationSubset cannot be resized");
+            }
+
+            void clear() override {
+                throw std::logic_error("PopulationSubset cannot be cleared");
+            }
+        };
+    }
+
+    DispatcherCached::DispatcherCached(Dispatcher *dispatcher, std::size_t capacity, std::size_t shardsNumber)
+        : m_dispatcher{dispatcher}, m_cache{capacity, shardsNumber} {
+        if (dispatcher == nullptr) {
+            throw std::invalid_argument("Wrapped dispatcher must not be null");
+        }
+    }
+
+    DispatcherCached::~DispatcherCached() = default;
+
+    void DispatcherCached::dispatch(Population *population, std::vector<std::unique_ptr<Evaluation> > *evaluation) {
+        // owned by the call, the wrapped dispatcher reads it while other calls may be running
+        std::vector<std::size_t> missing;
+        for (size_t i = 0; i < population->getSize(); i++) {
+            auto individual = population->getIndividual(i);
+            if (m_cache.lookup(individual->getGenome(), scores)) {
+                individual->setObjectiveScore(&scores);
+            } else {
+                missing.push_back(i);
+            }
+        }
+        if (missing.empty()) {
+            return;
+        }
+
+        PopulationSubset misses(population, missing);
+        m_dispatcher->dispatch(&misses, evaluation);
+
+        for (auto i: missing) {
+            auto individual = population->getIndividual(i);
+            m_cache.insert(individual->getGenome(), individual->getObjectiveScore());
+        }
+    }
+
+    std::future<void> DispatcherCached::dispatchAsync(Individual *individual,
+                                                      std::vector<std::unique_ptr<Evaluation> > *evaluation,
+                                                      EvaluationCompletion completion) {
+        if (m_cache.lookup(individual->getGenome(), scores)) {
+            individual->setObjectiveScore(&scores);
+            if (completion) {
+                completion(individual, true);
+            }
+            std::promise<void> promise;
+            promise.set_value();
+            return promise.get_future();
+        }
+        // the completion runs on the wrapped dispatcher's thread, the sharded cache is safe to insert from there
+        auto insertAndComplete = [this, completion = std::move(completion)](Individual *evaluated, bool succeeded) {
+            if (succeeded) {
+                m_cache.insert(evaluated->getGenome(), evaluated->getObjectiveScore());
+            }
+            if (completion) {
+                completion(evaluated, succeeded);
+            }
+        };
+        return m_dispatcher->dispatchAsync(individual, evaluation, std::move(insertAndComplete));
+    }
+
+    EvaluationCache &DispatcherCached::getCache() {
+        return m_cache;
+    }
+}
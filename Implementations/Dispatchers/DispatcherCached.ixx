@@ -0,0 +1,74 @@
+export module DispatcherCached;
+
+export import Dispatcher;
+export import EvaluationCache;
+import std;
+
+namespace Geneticxx {
+    /**
+     * @class DispatcherCached
+     * @brief A dispatcher reusing the objective scores of genomes evaluated before.
+     *
+     * `DispatcherCached` wraps another dispatcher. On every call to `dispatch` it first looks up the genome of
+     * every individual in its `EvaluationCache`; individuals found there get the cached objective scores
+     * directly. Only the remaining individuals are handed to the wrapped dispatcher, as a population view,
+     * and their results are added to the cache afterwards. Any dispatcher can be wrapped, so cached and
+     * parallel evaluation combine freely.
+     *
+     * The cache assumes that the evaluations are deterministic and that they do not change between calls.
+     *
+     * The cache is sharded and locked and every call keeps its own scratch state, so `dispatch` is reentrant
+     * whenever the wrapped dispatcher is.
+     */
+    export class DispatcherCached : public Dispatcher {
+    public:
+        /**
+         * @brief Constructor for DispatcherCached.
+         *
+         * @param dispatcher Dispatcher evaluating the individuals missing from the cache; ownership is taken.
+         * @param capacity Maximum number of genomes kept in the cache.
+         * @param shardsNumber Number of independently locked shards of the cache.
+         *
+         * @throws std::invalid_argument If the dispatcher is null or the capacity is 0.
+         */
+        DispatcherCached(Dispatcher *dispatcher, std::size_t capacity, std::size_t shardsNumber = 16);
+
+        /**
+         * @brief Destructor for DispatcherCached, destroys the wrapped dispatcher.
+         */
+        ~DispatcherCached() override;
+
+        /**
+         * @brief Dispatches the evaluations of the individuals whose genomes are not cached.
+         *
+         * @param population Pointer to the Population object containing individuals to be evaluated.
+         * @param evaluation Vector of unique pointers to Evaluation objects, each representing an evaluation function.
+         */
+        void dispatch(Population *population, std::vector<std::unique_ptr<Evaluation> > *evaluation) override;
+
+        /**
+         * @brief Completes the individual from the cache, or submits it to the wrapped dispatcher.
+         *
+         * A cache hit stores the cached scores and completes immediately on the calling thread. A miss is
+         * forwarded to the wrapped dispatcher's `dispatchAsync`, and its scores are added to the cache once it
+         * is evaluated successfully.
+         *
+         * @param individual Individual to evaluate.
+         * @param evaluation Evaluations applied to the individual.
+         * @param completion Callback invoked once the individual is evaluated.
+         *
+         * @return Future becoming ready once the objective scores are stored.
+         */
+        std::future<void> dispatchAsync(Individual *individual, std::vector<std::unique_ptr<Evaluation> > *evaluation,
+                                        EvaluationCompletion completion) override;
+
+        /**
+         * @brief Returns the cache, e.g. to read its hit and miss counters.
+         */
+        [[nodiscard]] EvaluationCache &getCache();
+
+    private:
+        std::unique_ptr<Dispatcher> m_dispatcher;
+        EvaluationCache m_cache;
+    };
+}
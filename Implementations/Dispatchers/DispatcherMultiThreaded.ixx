@@ -1,6 +1,7 @@
 export module DispatcherMultiThreaded;
 
 export import Dispatcher;
+import std;
 
 namespace Geneticxx {
     /**
@@ -8,11 +9,12 @@ namespace Geneticxx {
      * @brief A dispatcher that performs evaluations in parallel on 4 threads
      *
      * The `DispatcherMultiThreaded` class is a concrete implementation of the `Dispatcher` interface.
-     * It processes each individual in a population in parallel on 4 threads by applying all evaluation functions
-     * to their phenomes and storing the computed objective scores.
+     * It splits a population into 4 contiguous chunks evaluated in parallel, each on its own thread, by applying
+     * all evaluation functions to their phenomes and storing the computed objective scores.
      * It shouldn't be used when evaluation needs data beyond a single individual
      * or if the evaluation function has low computational cost.
      * This is a very simple, inefficient implementation to showcase the possibility of multithreading.
+     * `dispatch` keeps no state between calls, so it is reentrant.
      */
     export class DispatcherMultiThreaded : public Dispatcher {
     public:
@@ -42,6 +44,15 @@ namespace Geneticxx {
          */
         void dispatch(Population* population, std::vector<std::unique_ptr<Evaluation>>* evaluation) override;
 
-        static void dispatched(Individual* individual, std::vector<std::unique_ptr<Evaluation>>* evaluation);
+        /**
+         * @brief Evaluates the individuals [begin, end) of the population, run on one of the threads.
+         *
+         * @param population Pointer to the Population object containing individuals to be evaluated.
+         * @param begin Index of the first individual of the chunk.
+         * @param end Index one past the last individual of the chunk.
+         * @param evaluation Vector of unique pointers to Evaluation objects, each representing an evaluation function.
+         */
+        static void dispatched(Population* population, size_t begin, size_t end,
+                               std::vector<std::unique_ptr<Evaluation>>* evaluation);
     };
 }
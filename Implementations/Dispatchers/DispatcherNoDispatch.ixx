@@ -9,7 +9,8 @@ namespace Geneticxx {
      *
      * The `DispatcherNoDispatch` class is a concrete implementation of the `Dispatcher` interface.
      * It processes each individual in a population sequentially by applying all evaluation functions
-     * to their phenomes and storing the computed objective scores.
+     * to their phenomes and storing the computed objective scores. `dispatch` keeps no state between calls,
+     * so it is reentrant.
      */
     export class DispatcherNoDispatch : public Dispatcher {
     public:
@@ -0,0 +1,166 @@
+module DispatcherThreadPool;
+
+namespace Geneticxx {
+    DispatcherThreadPool::DispatcherThreadPool(unsigned int threadsNumber) {
+        if (threadsNumber == 0) {
+            threadsNumber = 1;
+        }
+        m_queues.reserve(threadsNumber);
+        for (unsigned int i = 0; i < threadsNumber; i++) {
+            m_queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        m_workers.reserve(threadsNumber);
+        for (unsigned int i = 0; i < threadsNumber; i++) {
+            m_workers.emplace_back(&DispatcherThreadPool::workerLoop, this, i);
+        }
+    }
+
+    DispatcherThreadPool::~DispatcherThreadPool() {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_wakeUp.notify_all();
+        for (auto &worker: m_workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+    }
+
+    void DispatcherThreadPool::dispatch(Population *population, std::vector<std::unique_ptr<Evaluation> > *evaluation) {
+        if (population == nullptr || evaluation == nullptr) {
+            throw std::invalid_argument("Population and evaluation must not be null");
+        }
+        const std::size_t size = population->getSize();
+        if (size == 0) {
+            return;
+        }
+        const std::size_t batchSize = computeBatchSize(size);
+        const std::size_t batchesNumber = (size + batchSize - 1) / batchSize;
+        DispatchCall call;
+        call.remainingBatches.store(batchesNumber);
+        {
+            std::lock_guard lock(m_mutex);
+            // Consecutive batches go to the same worker, so each one starts on a contiguous slice of the population.
+            const std::size_t perWorker = (batchesNumber + m_queues.size() - 1) / m_queues.size();
+            for (std::size_t b = 0; b < batchesNumber; b++) {
+                Batch batch{population, evaluation, b * batchSize, std::min(size, (b + 1) * batchSize), &call};
+                auto &queue = *m_queues[b / perWorker];
+                std::lock_guard queueLock(queue.m_mutex);
+                queue.m_batches.push_back(batch);
+            }
+            ++m_round;
+        }
+        m_wakeUp.notify_all();
+
+        std::unique_lock lock(m_mutex);
+        m_finished.wait(lock, [&call] { return call.remainingBatches.load() == 0; });
+        if (call.exception) {
+            std::rethrow_exception(call.exception);
+        }
+    }
+
+    std::future<void> DispatcherThreadPool::dispatchAsync(Individual *individual,
+                                                          std::vector<std::unique_ptr<Evaluation> > *evaluation,
+                                                          EvaluationCompletion completion) {
+        if (individual == nullptr || evaluation == nullptr) {
+            throw std::invalid_argument("Individual and evaluation must not be null");
+        }
+        // std::function has to be copyable, so the promise is shared with the task
+        auto promise = std::make_shared<std::promise<void> >();
+        auto result = promise->get_future();
+        {
+            std::lock_guard lock(m_mutex);
+            m_tasks.emplace_back([individual, evaluation, completion = std::move(completion), promise]() {
+                completeEvaluation(individual, evaluation, completion, *promise);
+            });
+        }
+        m_wakeUp.notify_one();
+        return result;
+    }
+
+    std::size_t DispatcherThreadPool::getThreadsNumber() const {
+        return m_workers.size();
+    }
+
+    void DispatcherThreadPool::workerLoop(std::size_t worker) {
+        std::size_t seenRound = 0;
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(m_mutex);
+                m_wakeUp.wait(lock, [this, seenRound] {
+                    return m_stop || m_round != seenRound || !m_tasks.empty();
+                });
+                if (m_stop) {
+                    return;
+                }
+                // a new round of batches goes first, a blocked dispatch is waiting for it
+                if (m_round != seenRound) {
+                    seenRound = m_round;
+                } else {
+                    task = std::move(m_tasks.front());
+                    m_tasks.pop_front();
+                }
+            }
+            if (task) {
+                task();
+            } else {
+                runBatches(worker);
+            }
+        }
+    }
+
+    bool DispatcherThreadPool::popBatch(std::size_t worker, Batch &batch) {
+        auto &queue = *m_queues[worker];
+        std::lock_guard lock(queue.m_mutex);
+        if (queue.m_batches.empty()) {
+            return false;
+        }
+        batch = queue.m_batches.front();
+        queue.m_batches.pop_front();
+        return true;
+    }
+
+    bool DispatcherThreadPool::stealBatch(std::size_t thief, Batch &batch) {
+        for (std::size_t i = 1; i < m_queues.size(); i++) {
+            auto &queue = *m_queues[(thief + i) % m_queues.size()];
+            std::lock_guard lock(queue.m_mutex);
+            if (!queue.m_batches.empty()) {
+                batch = queue.m_batches.back();
+                queue.m_batches.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void DispatcherThreadPool::runBatches(std::size_t worker) {
+        Batch batch;
+        while (popBatch(worker, batch) || stealBatch(worker, batch)) {
+            try {
+                evaluateRange(batch.population, batch.begin, batch.end, batch.evaluation);
+            } catch (...) {
+                std::lock_guard lock(m_mutex);
+                if (!batch.call->exception) {
+                    batch.call->exception = std::current_exception();
+                }
+            }
+            // The call may return as soon as its last batch is counted, so it is not touched afterwards.
+            if (batch.call->remainingBatches.fetch_sub(1) == 1) {
+                // Notifying under the lock guarantees the waiting dispatch cannot miss the wake-up.
+                std::lock_guard lock(m_mutex);
+                m_finished.notify_all();
+            }
+        }
+    }
+
+    std::size_t DispatcherThreadPool::computeBatchSize(std::size_t populationSize) const {
+        // Aim for several batches per worker so stealing can even out uneven evaluation times,
+        // while keeping batches large enough for the queue locking to be negligible.
+        constexpr std::size_t batchesPerWorker = 4;
+        const std::size_t batchSize = populationSize / (m_queues.size() * batchesPerWorker);
+        return std::max<std::size_t>(1, batchSize);
+    }
+}
@@ -0,0 +1,138 @@
+export module DispatcherThreadPool;
+
+export import Dispatcher;
+import std;
+
+namespace Geneticxx {
+    /**
+     * @class DispatcherThreadPool
+     * @brief A dispatcher that performs evaluations on a persistent pool of worker threads.
+     *
+     * The `DispatcherThreadPool` class is a concrete implementation of the `Dispatcher` interface.
+     * Unlike `DispatcherMultiThreaded`, it creates its worker threads once, in the constructor, and keeps
+     * them alive for the whole lifetime of the dispatcher, so no threads are created during evolution.
+     * On every call to `dispatch` the population is split into contiguous batches whose size adapts to the
+     * population size and the number of workers. Batches are distributed over per-worker deques; a worker
+     * takes batches from the front of its own deque and, once it runs dry, steals batches from the back of
+     * the other workers' deques, which keeps all cores busy even when evaluation cost varies between individuals.
+     * The call to `dispatch` blocks until every individual has been evaluated, so it can be used as a drop-in
+     * replacement for the other dispatchers.
+     * Evaluation objects are shared between the workers, so their `evaluate` and `evaluateBatch` methods must be
+     * thread-safe. Each batch is passed to `evaluateBatch` as a whole, see `evaluateRange`.
+     *
+     * `dispatch` is reentrant: every call keeps its own count of outstanding batches, so several threads, e.g.
+     * the islands of `GeneticAlgorithmSimple`, can share one pool and each returns once its own population is
+     * evaluated.
+     */
+    export class DispatcherThreadPool : public Dispatcher {
+    public:
+        /**
+         * @brief Constructor for DispatcherThreadPool.
+         *
+         * Starts the worker threads, which wait for work until the dispatcher is destroyed.
+         *
+         * @param threadsNumber Number of worker threads in the pool. When 0 is passed, a single worker is used.
+         */
+        explicit DispatcherThreadPool(unsigned int threadsNumber = std::thread::hardware_concurrency());
+
+        /**
+         * @brief Destructor for DispatcherThreadPool.
+         *
+         * Signals all worker threads to finish and joins them.
+         */
+        ~DispatcherThreadPool() override;
+
+        DispatcherThreadPool(const DispatcherThreadPool &) = delete;
+
+        DispatcherThreadPool &operator=(const DispatcherThreadPool &) = delete;
+
+        /**
+         * @brief Dispatches the evaluations for each individual in the population.
+         *
+         * Splits the population into batches, hands them to the worker threads and waits until all of them
+         * are evaluated. Every individual gets the concatenated results of all evaluation functions stored
+         * as its objective score. If any evaluation throws, the first exception is rethrown after all
+         * remaining batches have finished.
+         *
+         * @param population Pointer to the Population object containing individuals to be evaluated.
+         * @param evaluation Vector of unique pointers to Evaluation objects, each representing an evaluation function.
+         */
+        void dispatch(Population *population, std::vector<std::unique_ptr<Evaluation> > *evaluation) override;
+
+        /**
+         * @brief Queues a single individual to be evaluated by one of the worker threads.
+         *
+         * Individual tasks are taken by idle workers in submission order; batches of a concurrent `dispatch`
+         * take precedence over them. Tasks not started when the dispatcher is destroyed are dropped, their
+         * futures then hold a `std::future_error` with `broken_promise`.
+         *
+         * @param individual Individual to evaluate.
+         * @param evaluation Evaluations applied to the individual.
+         * @param completion Callback invoked on the worker thread once the individual is evaluated.
+         *
+         * @return Future becoming ready once the objective scores are stored.
+         */
+        std::future<void> dispatchAsync(Individual *individual, std::vector<std::unique_ptr<Evaluation> > *evaluation,
+                                        EvaluationCompletion completion) override;
+
+        /**
+         * @brief Returns the number of worker threads owned by the pool.
+         *
+         * @return Number of worker threads.
+         */
+        [[nodiscard]] std::size_t getThreadsNumber() const;
+
+    private:
+        /**
+         * @brief Completion state of one call to `dispatch`, owned by the waiting call.
+         */
+        struct DispatchCall {
+            std::atomic<std::size_t> remainingBatches{0};
+            /// First exception thrown by an evaluation of the call, guarded by m_mutex.
+            std::exception_ptr exception;
+        };
+
+        /**
+         * @brief Contiguous range of individuals processed by a single worker in one go.
+         *
+         * The batch carries the population and evaluations it belongs to, so a worker never mixes work
+         * from two different calls to `dispatch`.
+         */
+        struct Batch {
+            Population *population = nullptr;
+            std::vector<std::unique_ptr<Evaluation> > *evaluation = nullptr;
+            std::size_t begin = 0;
+            std::size_t end = 0;
+            DispatchCall *call = nullptr;
+        };
+
+        /**
+         * @brief Deque of batches owned by one worker, guarded by its own mutex.
+         */
+        struct WorkerQueue {
+            std::mutex m_mutex;
+            std::deque<Batch> m_batches;
+        };
+
+        void workerLoop(std::size_t worker);
+
+        bool popBatch(std::size_t worker, Batch &batch);
+
+        bool stealBatch(std::size_t thief, Batch &batch);
+
+        void runBatches(std::size_t worker);
+
+        [[nodiscard]] std::size_t computeBatchSize(std::size_t populationSize) const;
+
+        std::vector<std::unique_ptr<WorkerQueue> > m_queues;
+        std::vector<std::thread> m_workers;
+
+        std::mutex m_mutex;
+        std::condition_variable m_wakeUp;
+        std::condition_variable m_finished;
+        std::size_t m_round = 0;
+        bool m_stop = false;
+        /// Individuals submitted with `dispatchAsync` and not taken by a worker yet, guarded by m_mutex.
+        std::deque<std::function<void()> > m_tasks;
+    };
+}
@@ -0,0 +1,133 @@
+module EvaluationCache;
+
+namespace Geneticxx {
+    EvaluationCache::EvaluationCache(std::size_t capacity, std::size_t shardsNumber) : m_capacity{capacity} {
+        if (capacity == 0) {
+            throw std::invalid_argument("Evaluation cache capacity must be greater than 0");
+        }
+        shardsNumber = std::clamp<std::size_t>(shardsNumber, 1, capacity);
+        m_shards.reserve(shardsNumber);
+        for (std::size_t i = 0; i < shardsNumber; i++) {
+            auto shard = std::make_unique<Shard>();
+            // spread the capacity so that the shards add up to exactly the requested capacity
+            shard->m_capacity = capacity / shardsNumber + (i < capacity % shardsNumber ? 1 : 0);
+            shard->m_entries.reserve(shard->m_capacity);
+            m_shards.push_back(std::move(shard));
+        }
+    }
+
+    EvaluationCache::~EvaluationCache() = default;
+
+    bool EvaluationCache::lookup(const Genome *genome, std::vector<double> &scores) {
+        auto hash = genome != nullptr ? genome->hash() : std::nullopt;
+        if (hash) {
+            auto &shard = shardFor(*hash);
+            std::lock_guard lock(shard.m_mutex);
+            if (auto entry = find(shard, *hash, genome)) {
+                entry->referenced = true;
+                scores.assign(entry->scores.begin(), entry->scores.end());
+                m_hits.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    void EvaluationCache::insert(const Genome *genome, std::span<const double> scores) {
+        auto hash = genome != nullptr ? genome->hash() : std::nullopt;
+        if (!hash) {
+            return;
+        }
+        auto &shard = shardFor(*hash);
+        std::lock_guard lock(shard.m_mutex);
+        if (auto entry = find(shard, *hash, genome)) {
+            entry->scores.assign(scores.begin(), scores.end());
+            return;
+        }
+
+        std::size_t slot;
+        if (shard.m_entries.size() < shard.m_capacity) {
+            slot = shard.m_entries.size();
+            shard.m_entries.emplace_back();
+        } else {
+            slot = evict(shard);
+        }
+        auto &entry = shard.m_entries[slot];
+        // reuse the evicted genome's storage when possible
+        if (!entry.genome || !entry.genome->assign(genome)) {
+            entry.genome = genome->clone();
+        }
+        entry.hash = *hash;
+        entry.scores.assign(scores.begin(), scores.end());
+        entry.referenced = false;
+        shard.m_index.emplace(*hash, slot);
+    }
+
+    void EvaluationCache::clear() {
+        for (auto &shard: m_shards) {
+            std::lock_guard lock(shard->m_mutex);
+            shard->m_entries.clear();
+            shard->m_index.clear();
+            shard->m_hand = 0;
+        }
+        m_hits = 0;
+        m_misses = 0;
+    }
+
+    std::size_t EvaluationCache::getHits() const {
+        return m_hits.load(std::memory_order_relaxed);
+    }
+
+    std::size_t EvaluationCache::getMisses() const {
+        return m_misses.load(std::memory_order_relaxed);
+    }
+
+    std::size_t EvaluationCache::getSize() const {
+        std::size_t size = 0;
+        for (auto &shard: m_shards) {
+            std::lock_guard lock(shard->m_mutex);
+            size += shard->m_entries.size();
+        }
+        return size;
+    }
+
+    std::size_t EvaluationCache::getCapacity() const {
+        return m_capacity;
+    }
+
+    EvaluationCache::Shard &EvaluationCache::shardFor(std::size_t hash) {
+        // the low bits select the bucket inside the shard's index, so use the high ones here
+        return *m_shards[(hash ^ hash >> (sizeof(std::size_t) * 4)) % m_shards.size()];
+    }
+
+    EvaluationCache::Entry *EvaluationCache::find(Shard &shard, std::size_t hash, const Genome *genome) {
+        auto [begin, end] = shard.m_index.equal_range(hash);
+        for (auto it = begin; it != end; ++it) {
+            auto &entry = shard.m_entries[it->second];
+            if (*entry.genome == const_cast<Genome *>(genome)) {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    std::size_t EvaluationCache::evict(Shard &shard) {
+        // second chance: skip and unmark recently used entries until an unmarked one comes up
+        while (shard.m_entries[shard.m_hand].referenced) {
+            shard.m_entries[shard.m_hand].referenced = false;
+            shard.m_hand = (shard.m_hand + 1) % shard.m_entries.size();
+        }
+        const std::size_t victim = shard.m_hand;
+        shard.m_hand = (shard.m_hand + 1) % shard.m_entries.size();
+
+        auto [begin, end] = shard.m_index.equal_range(shard.m_entries[victim].hash);
+        for (auto it = begin; it != end; ++it) {
+            if (it->second == victim) {
+                shard.m_index.erase(it);
+                break;
+            }
+        }
+        return victim;
+    }
+}
@@ -0,0 +1,108 @@
+export module EvaluationCache;
+
+export import Genome;
+import std;
+
+namespace Geneticxx {
+    /**
+     * @class EvaluationCache
+     * @brief A bounded, thread-safe memo of objective scores keyed by genome.
+     *
+     * Under low mutation rates many children are exact copies of their parents, so their evaluation can be
+     * skipped by reusing the scores computed for the same genome earlier. Genomes are looked up by
+     * `Genome::hash` and confirmed with `Genome::operator==`, so hash collisions never return wrong scores;
+     * genomes which cannot be hashed are never cached.
+     *
+     * The cache holds at most `capacity` entries. It is split into independently locked shards, selected by
+     * the hash, and every shard evicts with the CLOCK policy: entries are marked on every hit and the clock
+     * hand evicts the first unmarked entry, clearing the marks it passes. Hit and miss counters are kept
+     * for tuning the capacity.
+     */
+    export class EvaluationCache {
+    public:
+        /**
+         * @brief Constructor for EvaluationCache.
+         *
+         * @param capacity Maximum number of cached genomes; must be greater than 0.
+         * @param shardsNumber Number of independently locked shards, reduced if larger than the capacity.
+         *
+         * @throws std::invalid_argument If the capacity is 0.
+         */
+        explicit EvaluationCache(std::size_t capacity, std::size_t shardsNumber = 16);
+
+        ~EvaluationCache();
+
+        EvaluationCache(const EvaluationCache &) = delete;
+
+        EvaluationCache &operator=(const EvaluationCache &) = delete;
+
+        /**
+         * @brief Looks up the scores of a genome.
+         *
+         * @param genome Genome to look up.
+         * @param scores Receives the cached scores on a hit, untouched on a miss.
+         * @return True on a hit, false on a miss.
+         */
+        bool lookup(const Genome *genome, std::vector<double> &scores);
+
+        /**
+         * @brief Stores the scores of a genome, evicting an entry if the shard is full.
+         *
+         * Genomes which cannot be hashed are ignored.
+         *
+         * @param genome Genome the scores belong to; it is copied, not retained.
+         * @param scores Objective scores of the genome.
+         */
+        void insert(const Genome *genome, std::span<const double> scores);
+
+        /**
+         * @brief Removes all entries and resets the counters.
+         */
+        void clear();
+
+        /// Returns the number of lookups which found the genome.
+        [[nodiscard]] std::size_t getHits() const;
+
+        /// Returns the number of lookups which did not find the genome.
+        [[nodiscard]] std::size_t getMisses() const;
+
+        /// Returns the number of cached genomes.
+        [[nodiscard]] std::size_t getSize() const;
+
+        /// Returns the maximum number of cached genomes.
+        [[nodiscard]] std::size_t getCapacity() const;
+
+    private:
+        /**
+         * @brief A cached genome with its scores and CLOCK reference mark.
+         */
+        struct Entry {
+            std::size_t hash = 0;
+            std::unique_ptr<Genome> genome;
+            std::vector<double> scores;
+            bool referenced = false;
+        };
+
+        /**
+         * @brief Part of the cache guarded by its own mutex.
+         */
+        struct Shard {
+            mutable std::mutex m_mutex;
+            std::vector<Entry> m_entries;
+            std::unordered_multimap<std::size_t, std::size_t> m_index;
+            std::size_t m_capacity = 0;
+            std::size_t m_hand = 0;
+        };
+
+        Shard &shardFor(std::size_t hash);
+
+        static Entry *find(Shard &shard, std::size_t hash, const Genome *genome);
+
+        static std::size_t evict(Shard &shard);
+
+        std::vector<std::unique_ptr<Shard> > m_shards;
+        std::size_t m_capacity;
+        std::atomic<std::size_t> m_hits{0};
+        std::atomic<std::size_t> m_misses{0};
+    };
+}
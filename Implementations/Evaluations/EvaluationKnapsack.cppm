@@ -9,18 +9,101 @@ namespace Geneticxx {
     }
 
     std::vector<double> EvaluationKnapsack::evaluate(const Phenome* phenomeBase) {
-        auto phenome = dynamic_cast<const Phenome1D*>(phenomeBase); //TODO check for bad casts
-        int size = phenome->getSize();
         double result = 0;
         int weight = 0;
 
-        // Compute the score by checking how many phenome values match the expected pattern.
-        for (int i = 0; i < size; i++) {
-            weight += weights[i] * std::any_cast<bool>(phenome->getValue(i)); //TODO check for bad casts
-            result += values[i] * std::any_cast<bool>(phenome->getValue(i));
+        if (auto typed = dynamic_cast<const Phenome1DView<bool>*>(phenomeBase)) {
+            // fast path, the selected items are read directly from the phenome's buffer
+            auto selected = typed->getValues();
+            for (size_t i = 0; i < selected.size(); i++) {
+                weight += weights[i] * selected[i];
+                result += values[i] * selected[i];
+            }
+        } else {
+            auto phenome = dynamic_cast<const Phenome1D*>(phenomeBase); //TODO check for bad casts
+            int size = phenome->getSize();
+
+            // Compute the score by checking how many phenome values match the expected pattern.
+            for (int i = 0; i < size; i++) {
+                weight += weights[i] * std::any_cast<bool>(phenome->getValue(i)); //TODO check for bad casts
+                result += values[i] * std::any_cast<bool>(phenome->getValue(i));
+            }
         }
         result = weight <= capacity ? result : 0;
         double bonus1 = weight > 0 ? result / weight : 0; //bonus rewarding low weight
         return std::vector<double>{result, bonus1};
     }
+
+    size_t EvaluationKnapsack::getObjectivesNumber() const {
+        return 2;
+    }
+
+    void EvaluationKnapsack::evaluateBatch(std::span<const Phenome* const> phenomes, std::span<double> scores) {
+        const bool typed = std::ranges::all_of(phenomes, [](const Phenome* phenome) {
+            return dynamic_cast<const Phenome1DView<bool>*>(phenome) != nullptr;
+        });
+        if (!typed) {
+            Evaluation::evaluateBatch(phenomes, scores);
+            return;
+        }
+        if (scores.size() < phenomes.size() * 2) {
+            throw std::invalid_argument("Output buffer does not fit the scores of the batch");
+        }
+
+        // selections stored item-major, row `item` holds whether every phenome of the batch selected that item
+        constexpr size_t items = std::extent_v<decltype(values)>;
+        const size_t count = phenomes.size();
+        std::vector<int> selection(items * count, 0);
+        for (size_t i = 0; i < count; i++) {
+            auto selected = dynamic_cast<const Phenome1DView<bool>*>(phenomes[i])->getValues();
+            for (size_t item = 0; item < std::min(items, selected.size()); item++) {
+                selection[item * count + i] = selected[item];
+            }
+        }
+
+        std::vector<int> weight(count, 0);
+        std::vector<int> value(count, 0);
+        for (size_t item = 0; item < items; item++) {
+            const int* row = selection.data() + item * count;
+            for (size_t i = 0; i < count; i++) {
+                weight[i] += weights[item] * row[i];
+                value[i] += values[item] * row[i];
+            }
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            const double result = weight[i] <= capacity ? value[i] : 0;
+            scores[2 * i] = result;
+            scores[2 * i + 1] = weight[i] > 0 ? result / weight[i] : 0; //bonus rewarding low weight
+        }
+    }
+
+    bool EvaluationKnapsack::evaluateDelta(const Phenome* phenomeBase, std::span<const GeneChange> changes,
+                                           std::span<double> scores) {
+        auto typed = dynamic_cast<const Phenome1DView<bool>*>(phenomeBase);
+        if (typed == nullptr || scores.size() < 2 || scores[0] <= 0 || scores[1] <= 0) {
+            return false;
+        }
+        // the value per weight is value / weight, so the weight of a fitting selection is value / bonus
+        int value = static_cast<int>(std::lround(scores[0]));
+        int weight = static_cast<int>(std::lround(scores[0] / scores[1]));
+        auto selected = typed->getValues();
+        constexpr size_t items = std::extent_v<decltype(values)>;
+        for (const auto &change: changes) {
+            auto previous = std::any_cast<bool>(&change.previousValue);
+            if (previous == nullptr || change.position >= selected.size()) {
+                return false;
+            }
+            if (change.position >= items) {
+                continue;
+            }
+            const int difference = static_cast<int>(selected[change.position]) - static_cast<int>(*previous);
+            weight += weights[change.position] * difference;
+            value += values[change.position] * difference;
+        }
+        const double result = weight <= capacity ? value : 0;
+        scores[0] = result;
+        scores[1] = weight > 0 ? result / weight : 0; //bonus rewarding low weight
+        return true;
+    }
 }
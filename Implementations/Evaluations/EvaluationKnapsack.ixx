@@ -38,5 +38,39 @@ namespace Geneticxx {
          * @return A vector containing a single double value representing the fitness score.
          */
         std::vector<double> evaluate(const Phenome* phenome) override;
+
+        /**
+         * @brief Returns the number of scores returned for every phenome: the value and the value per weight.
+         *
+         * @return 2.
+         */
+        size_t getObjectivesNumber() const override;
+
+        /**
+         * @brief Evaluates a batch of phenomes exposing `Phenome1DView<bool>` with vectorized loops.
+         *
+         * The selections of the whole batch are transposed into an item-major matrix, so that the total weight
+         * and value of every phenome are accumulated one item at a time over contiguous memory. Batches
+         * containing other phenomes are evaluated one phenome at a time.
+         *
+         * @param phenomes Phenomes representing the solutions.
+         * @param scores Output buffer receiving two scores per phenome.
+         */
+        void evaluateBatch(std::span<const Phenome* const> phenomes, std::span<double> scores) override;
+
+        /**
+         * @brief Updates the value and the value per weight from the items whose selection changed.
+         *
+         * The previous total weight is recovered from the previous scores, which is only possible for selections
+         * that fit into the knapsack, i.e. with a positive value. Runs in time proportional to the number of changes.
+         *
+         * @param phenome Phenome exposing `Phenome1DView<bool>` after the change.
+         * @param changes Changed items with their previous selection as `bool`.
+         * @param scores Scores of the previous selection, replaced with the scores of the current selection.
+         *
+         * @return False for other phenomes, or if the previous selection had no value or did not fit.
+         */
+        bool evaluateDelta(const Phenome* phenome, std::span<const GeneChange> changes,
+                           std::span<double> scores) override;
     };
 }
@@ -1,6 +1,105 @@
 module EvaluationTravellingSalesman;
 
 namespace Geneticxx {
+    namespace {
+        /**
+         * @brief Sums `edge(route[i], route[i + 1])` over all edges of the closed route.
+         *
+         * Four independent partial sums break the dependency chain of the accumulation, so the distance
+         * lookups (gathers) of consecutive edges can be issued and vectorized together.
+         */
+        template<typename Edge>
+        double sumEdges(std::span<const int> route, Edge &&edge) {
+            const std::size_t edges = route.size() - 1;
+            double partial[4] = {0.0, 0.0, 0.0, 0.0};
+            std::size_t i = 0;
+            for (; i + 4 <= edges; i += 4) {
+                partial[0] += edge(route[i], route[i + 1]);
+                partial[1] += edge(route[i + 1], route[i + 2]);
+                partial[2] += edge(route[i + 2], route[i + 3]);
+                partial[3] += edge(route[i + 3], route[i + 4]);
+            }
+            for (; i < edges; i++) {
+                partial[0] += edge(route[i], route[i + 1]);
+            }
+            // Wrap-around for the last city
+            partial[0] += edge(route[edges], route[0]);
+            return (partial[0] + partial[1]) + (partial[2] + partial[3]);
+        }
+
+        /**
+         * @brief Reads the route through the typed view when available, otherwise unboxes it once from std::any.
+         */
+        std::span<const int> readRoute(const Phenome* phenomeBase, std::vector<int> &unboxedRoute) {
+            if (auto typed = dynamic_cast<const Phenome1DView<int>*>(phenomeBase)) {
+                return typed->getValues();
+            }
+            auto phenome = dynamic_cast<const Phenome1D*>(phenomeBase);
+            unboxedRoute.resize(phenome->getSize());
+            for (int i = 0; i < phenome->getSize(); i++) {
+                unboxedRoute[i] = std::any_cast<int>(phenome->getValue(i));
+            }
+            return unboxedRoute;
+        }
+
+        /**
+         * @brief Returns the exponent of the revisit penalty: the number of visits of the cities visited more than once.
+         *
+         * @return The exponent, or nothing if the route contains a city outside of `[0, cities)`.
+         */
+        std::optional<int> revisitExponent(std::span<const int> route, int cities) {
+            // visits are counted in a per-thread buffer, as evaluations are shared between dispatcher threads
+            thread_local std::vector<int> repeats;
+            repeats.assign(cities, 0);
+            for (const int city: route) {
+                if (city < 0 || city >= cities) {
+                    return std::nullopt;
+                }
+                repeats[city]++;
+            }
+            int exponent = 0;
+            for (const int count: repeats) {
+                if (count > 1) {
+                    exponent += count;
+                }
+            }
+            return exponent;
+        }
+
+        /// Rounds to the nearest integer like the `nint` of the TSPLIB definitions.
+        double nearestInteger(double value) {
+            return std::floor(value + 0.5);
+        }
+
+        /**
+         * @brief Computes the distance of two cities from the differences of their coordinates.
+         */
+        double measure(DistanceType type, double dx, double dy) {
+            switch (type) {
+                case DistanceType::Euc2D:
+                    return nearestInteger(std::sqrt(dx * dx + dy * dy));
+                case DistanceType::Ceil2D:
+                    return std::ceil(std::sqrt(dx * dx + dy * dy));
+                case DistanceType::Att: {
+                    const double exact = std::sqrt((dx * dx + dy * dy) / 10.0);
+                    const double rounded = nearestInteger(exact);
+                    return rounded < exact ? rounded + 1 : rounded;
+                }
+                case DistanceType::Euclidean:
+                default:
+                    return std::sqrt(dx * dx + dy * dy);
+            }
+        }
+
+        std::string_view trim(std::string_view text) {
+            const auto first = text.find_first_not_of(" \t\r");
+            if (first == std::string_view::npos) {
+                return {};
+            }
+            return text.substr(first, text.find_last_not_of(" \t\r") - first + 1);
+        }
+    }
+
     EvaluationTravellingSalesman::EvaluationTravellingSalesman() : m_cols{2}, m_rows{8} {
         m_array = new double*[m_rows];
         for (int i = 0; i < m_rows; i++) {
@@ -24,10 +123,121 @@ namespace Geneticxx {
         m_array[6][1] = 0;
         m_array[7][0] = -1;
         m_array[7][1] = -1;
+
+        buildDistances(DefaultMaxMatrixBytes);
     }
 
-    EvaluationTravellingSalesman::EvaluationTravellingSalesman(int rows, double** array)
-        : m_cols{2}, m_rows{rows}, m_array{array} {
+    EvaluationTravellingSalesman::EvaluationTravellingSalesman(int rows, double** array, std::size_t maxMatrixBytes,
+                                                               DistanceType distanceType)
+        : m_cols{2}, m_rows{rows}, m_array{array}, m_DistanceType{distanceType} {
+        buildDistances(maxMatrixBytes);
+    }
+
+    std::unique_ptr<EvaluationTravellingSalesman> EvaluationTravellingSalesman::fromTsplib(std::istream &input,
+        std::size_t maxMatrixBytes) {
+        std::size_t dimension = 0;
+        DistanceType distanceType = DistanceType::Euclidean;
+        bool coordinates = false;
+        std::string line;
+        while (std::getline(input, line)) {
+            const auto entry = trim(line);
+            if (entry == "NODE_COORD_SECTION") {
+                coordinates = true;
+                break;
+            }
+            if (entry == "EOF") {
+                break;
+            }
+            const auto colon = entry.find(':');
+            if (colon == std::string_view::npos) {
+                continue;
+            }
+            const auto key = trim(entry.substr(0, colon));
+            const auto value = trim(entry.substr(colon + 1));
+            if (key == "TYPE" && value != "TSP") {
+                throw std::runtime_error("Only TSPLIB instances of TYPE TSP are supported");
+            }
+            if (key == "EDGE_WEIGHT_TYPE") {
+                if (value == "EUC_2D") {
+                    distanceType = DistanceType::Euc2D;
+                } else if (value == "CEIL_2D") {
+                    distanceType = DistanceType::Ceil2D;
+                } else if (value == "ATT") {
+                    distanceType = DistanceType::Att;
+                } else {
+                    throw std::runtime_error("Unsupported TSPLIB EDGE_WEIGHT_TYPE: " + std::string(value));
+                }
+            }
+            if (key == "DIMENSION") {
+                dimension = std::stoull(std::string(value));
+            }
+        }
+        if (!coordinates || dimension == 0) {
+            throw std::runtime_error("TSPLIB instance has no DIMENSION or NODE_COORD_SECTION");
+        }
+        if (dimension > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+            throw std::runtime_error("TSPLIB instance has too many cities");
+        }
+
+        std::vector<std::array<double, 2>> cities(dimension);
+        for (auto &city: cities) {
+            long long index;
+            if (!(input >> index >> city[0] >> city[1])) {
+                throw std::runtime_error("TSPLIB instance has fewer cities than its DIMENSION");
+            }
+        }
+        auto array = new double*[dimension];
+        for (std::size_t i = 0; i < dimension; i++) {
+            array[i] = new double[2]{cities[i][0], cities[i][1]};
+        }
+        return std::make_unique<EvaluationTravellingSalesman>(static_cast<int>(dimension), array, maxMatrixBytes,
+                                                              distanceType);
+    }
+
+    std::unique_ptr<EvaluationTravellingSalesman> EvaluationTravellingSalesman::fromTsplib(
+        const std::filesystem::path &path, std::size_t maxMatrixBytes) {
+        std::ifstream file(path);
+        if (!file) {
+            throw std::runtime_error("Cannot open TSPLIB file " + path.string());
+        }
+        return fromTsplib(file, maxMatrixBytes);
+    }
+
+    void EvaluationTravellingSalesman::buildDistances(std::size_t maxMatrixBytes) {
+        m_Distances.reset();
+        m_Stride = 0;
+        m_X.clear();
+        m_Y.clear();
+        const std::size_t cities = m_rows > 0 ? static_cast<std::size_t>(m_rows) : 0;
+        if (cities == 0) {
+            return;
+        }
+
+        // rows are padded to whole cache lines, so every row starts on its own line
+        constexpr std::size_t perLine = CacheLineSize / sizeof(double);
+        const std::size_t stride = (cities + perLine - 1) / perLine * perLine;
+        if (cities > maxMatrixBytes / sizeof(double) / stride) {
+            m_X.resize(cities);
+            m_Y.resize(cities);
+            for (std::size_t i = 0; i < cities; i++) {
+                m_X[i] = m_array[i][0];
+                m_Y[i] = m_array[i][1];
+            }
+            return;
+        }
+
+        m_Distances.reset(static_cast<double *>(
+            ::operator new[](stride * cities * sizeof(double), std::align_val_t{CacheLineSize})));
+        m_Stride = stride;
+        for (std::size_t i = 0; i < cities; i++) {
+            double *row = m_Distances.get() + i * stride;
+            row[i] = 0.0;
+            for (std::size_t j = i + 1; j < cities; j++) {
+                row[j] = measure(m_DistanceType, m_array[i][0] - m_array[j][0], m_array[i][1] - m_array[j][1]);
+                m_Distances[j * stride + i] = row[j];
+            }
+            std::fill(row + cities, row + stride, 0.0);
+        }
     }
 
     EvaluationTravellingSalesman::~EvaluationTravellingSalesman() {
@@ -56,44 +266,149 @@ namespace Geneticxx {
         return m_array[index];
     }
 
-    std::vector<double> EvaluationTravellingSalesman::evaluate(const Phenome* phenomeBase) {
-        auto phenome = dynamic_cast<const Phenome1D*>(phenomeBase);
-        double totalDistance = 0.0;
-        int routeSize = phenome->getSize();
+    bool EvaluationTravellingSalesman::hasDistanceMatrix() const {
+        return m_Distances != nullptr;
+    }
 
-        if (routeSize != m_rows) {
-            throw std::invalid_argument("Evaluation m_rows is not equal to the phenome size!");
+    double EvaluationTravellingSalesman::getDistance(int from, int to) const {
+        if (m_Distances) {
+            return m_Distances[static_cast<std::size_t>(from) * m_Stride + to];
         }
+        return measure(m_DistanceType, m_X[from] - m_X[to], m_Y[from] - m_Y[to]);
+    }
 
-        // Compute total distance for the closed route
-        for (int i = 0; i < routeSize; i++) {
-            int currentCity = std::any_cast<int>(phenome->getValue(i));
-            int nextCity = std::any_cast<int>(phenome->getValue((i + 1) % routeSize));
-            // Wrap-around for the last city
+    DistanceType EvaluationTravellingSalesman::getDistanceType() const {
+        return m_DistanceType;
+    }
 
-            // Compute Euclidean distance between consecutive cities
-            double dx = static_cast<double>(m_array[currentCity][0] - m_array[nextCity][0]);
-            double dy = static_cast<double>(m_array[currentCity][1] - m_array[nextCity][1]);
-            double distance = std::sqrt(dx * dx + dy * dy);
-            totalDistance += distance;
+    void EvaluationTravellingSalesman::setPermutationRoutes(bool permutations) {
+        m_PermutationRoutes = permutations;
+    }
+
+    bool EvaluationTravellingSalesman::hasPermutationRoutes() const {
+        return m_PermutationRoutes;
+    }
+
+    double EvaluationTravellingSalesman::tourLength(std::span<const int> route) const {
+        if (route.empty()) {
+            return 0.0;
+        }
+        if (m_Distances) {
+            const double *distances = m_Distances.get();
+            const std::size_t stride = m_Stride;
+            return sumEdges(route, [distances, stride](int from, int to) {
+                return distances[static_cast<std::size_t>(from) * stride + to];
+            });
+        }
+        const double *xs = m_X.data();
+        const double *ys = m_Y.data();
+        if (m_DistanceType != DistanceType::Euclidean) {
+            const DistanceType type = m_DistanceType;
+            return sumEdges(route, [xs, ys, type](int from, int to) {
+                return measure(type, xs[from] - xs[to], ys[from] - ys[to]);
+            });
+        }
+        return sumEdges(route, [xs, ys](int from, int to) {
+            const double dx = xs[from] - xs[to];
+            const double dy = ys[from] - ys[to];
+            return std::sqrt(dx * dx + dy * dy);
+        });
+    }
+
+    double EvaluationTravellingSalesman::score(std::span<const int> route) const {
+        if (static_cast<int>(route.size()) != m_rows) {
+            throw std::invalid_argument("Evaluation m_rows is not equal to the phenome size!");
+        }
+        //penalty for revisiting towns, each city visited n > 1 times doubles the distance n times
+        const auto penaltyExponent = revisitExponent(route, m_rows);
+        if (!penaltyExponent) {
+            throw std::invalid_argument("Route contains a city outside of the evaluation");
         }
-        //penalty for revisiting towns
+        if (m_PermutationRoutes && *penaltyExponent != 0) {
+            throw std::invalid_argument("Route revisits cities although routes are declared permutations");
+        }
+
+        double totalDistance = tourLength(route);
         if (totalDistance == 0) totalDistance = 100;
-        std::vector<int> repeats(routeSize, 0);
-        double penalty = 1;
-        for (int i = 0; i < routeSize; i++)
-        {
-            repeats[std::any_cast<int>(phenome->getValue(i))]++;
+        return std::ldexp(totalDistance, *penaltyExponent);
+    }
+
+    std::vector<double> EvaluationTravellingSalesman::evaluate(const Phenome* phenomeBase) {
+        std::vector<int> unboxedRoute;
+        return std::vector<double>{score(readRoute(phenomeBase, unboxedRoute))};
+    }
+
+    std::size_t EvaluationTravellingSalesman::getObjectivesNumber() const {
+        return 1;
+    }
+
+    void EvaluationTravellingSalesman::evaluateBatch(std::span<const Phenome* const> phenomes, std::span<double> scores) {
+        if (scores.size() < phenomes.size()) {
+            throw std::invalid_argument("Output buffer does not fit the scores of the batch");
+        }
+        std::vector<int> unboxedRoute;
+        for (std::size_t i = 0; i < phenomes.size(); i++) {
+            scores[i] = score(readRoute(phenomes[i], unboxedRoute));
+        }
+    }
+
+    bool EvaluationTravellingSalesman::evaluateDelta(const Phenome* phenomeBase, std::span<const GeneChange> changes,
+                                                     std::span<double> scores) {
+        auto typed = dynamic_cast<const Phenome1DView<int>*>(phenomeBase);
+        // the revisit penalty of other routes could only be found by walking them
+        if (!m_PermutationRoutes || typed == nullptr || scores.empty() || m_rows < 2) {
+            return false;
+        }
+        auto route = typed->getValues();
+        const std::size_t cities = route.size();
+        if (static_cast<int>(cities) != m_rows) {
+            return false;
         }
-        for (int i = 0; i < routeSize; i++)
-        {
-            if (repeats[i] > 1)
-            {
-                penalty *= std::pow(2, repeats[i]);
+
+        thread_local std::vector<int> before;
+        thread_local std::vector<int> after;
+        before.clear();
+        after.clear();
+        for (const auto &change: changes) {
+            auto previous = std::any_cast<int>(&change.previousValue);
+            if (previous == nullptr || change.position >= cities || *previous < 0 || *previous >= m_rows) {
+                return false;
             }
+            before.push_back(*previous);
+            after.push_back(route[change.position]);
+        }
+        // the changed positions must hold the same, distinct cities as before
+        std::ranges::sort(before);
+        std::ranges::sort(after);
+        if (before != after || std::ranges::adjacent_find(after) != after.end()) {
+            return false;
         }
-        totalDistance *= penalty;
-        return std::vector<double>{totalDistance};
+
+        auto previousCity = [&](std::size_t position) {
+            for (const auto &change: changes) {
+                if (change.position == position) {
+                    return std::any_cast<int>(change.previousValue);
+                }
+            }
+            return route[position];
+        };
+        // edge e connects positions e and e + 1, every changed position touches the edges on both of its sides
+        thread_local std::vector<std::size_t> edges;
+        edges.clear();
+        for (const auto &change: changes) {
+            edges.push_back((change.position + cities - 1) % cities);
+            edges.push_back(change.position);
+        }
+        std::ranges::sort(edges);
+        edges.erase(std::ranges::unique(edges).begin(), edges.end());
+
+        double delta = 0;
+        for (const std::size_t edge: edges) {
+            const std::size_t next = (edge + 1) % cities;
+            delta += getDistance(route[edge], route[next]) - getDistance(previousCity(edge), previousCity(next));
+        }
+        // a route of zero length, scored as 100, keeps zero length under any permutation, so delta is 0 then
+        scores[0] += delta;
+        return true;
     }
 }
-
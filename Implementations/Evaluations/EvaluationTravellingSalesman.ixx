@@ -5,12 +5,31 @@ import Phenome1D;
 import std;
 
 namespace Geneticxx {
+    /**
+     * @enum DistanceType
+     * @brief How the distance between two cities is computed from their coordinates.
+     *
+     * The TSPLIB types round distances to integers as defined by the TSPLIB format, so tour lengths are
+     * comparable with the published optima of the instances.
+     */
+    export enum class DistanceType {
+        Euclidean, ///< Exact Euclidean distance.
+        Euc2D, ///< TSPLIB `EUC_2D`: Euclidean distance rounded to the nearest integer.
+        Ceil2D, ///< TSPLIB `CEIL_2D`: Euclidean distance rounded up.
+        Att ///< TSPLIB `ATT`: pseudo-Euclidean distance, rounded up.
+    };
+
     /**
      * @class EvaluationTravellingSalesman
      * @brief Evaluation class for the Travelling Salesman Problem (TSP).
      *
      * This class calculates the total distance of a given route based on a predefined set of city coordinates.
      * It assumes that the route is closed, meaning the last city connects back to the first.
+     *
+     * The distances between all pairs of cities are computed once, on construction, into a flat matrix whose rows
+     * are aligned to cache lines, so evaluating a route only gathers one precomputed distance per edge. When the
+     * matrix would exceed the configured memory limit, as for instances of many thousands of cities, distances are
+     * computed on the fly from coordinates stored as contiguous x and y arrays instead.
      */
     export class EvaluationTravellingSalesman : public Evaluation {
     private:
@@ -22,7 +41,53 @@ namespace Geneticxx {
     private:
         double** m_array; ///< 2D array storing the coordinates of the cities.
 
+        static constexpr std::size_t CacheLineSize = 64; ///< Alignment of the distance matrix and its rows.
+
+        /**
+         * @brief Frees buffers allocated with cache line alignment.
+         */
+        struct AlignedDelete {
+            void operator()(double *buffer) const {
+                ::operator delete[](buffer, std::align_val_t{CacheLineSize});
+            }
+        };
+
+        std::unique_ptr<double[], AlignedDelete> m_Distances; ///< Row-major distance matrix, null when computed on the fly.
+        std::size_t m_Stride = 0; ///< Number of doubles between consecutive rows of the matrix.
+        std::vector<double> m_X; ///< X coordinates of the cities, used when there is no matrix.
+        std::vector<double> m_Y; ///< Y coordinates of the cities, used when there is no matrix.
+        DistanceType m_DistanceType = DistanceType::Euclidean; ///< How distances are computed from the coordinates.
+        bool m_PermutationRoutes = false; ///< Whether every route is declared to visit every city exactly once.
+
+        /**
+         * @brief Builds the distance matrix, or the coordinate arrays when the matrix exceeds the memory limit.
+         *
+         * @param maxMatrixBytes Largest size of the distance matrix, in bytes.
+         */
+        void buildDistances(std::size_t maxMatrixBytes);
+
+        /**
+         * @brief Returns the length of the closed route, without checking it.
+         *
+         * @param route Indices of the cities in the order of visiting.
+         */
+        double tourLength(std::span<const int> route) const;
+
+        /**
+         * @brief Returns the score of a route: its length multiplied by the penalty for revisited cities.
+         *
+         * @param route Indices of the cities in the order of visiting.
+         * @throws std::invalid_argument if the route size does not match `m_rows`, it contains an unknown city, or it
+         *         revisits cities although routes are declared permutations.
+         */
+        double score(std::span<const int> route) const;
+
     public:
+        /**
+         * @brief Default limit for the size of the distance matrix, 256 MiB (about 5800 cities).
+         */
+        static constexpr std::size_t DefaultMaxMatrixBytes = std::size_t{256} * 1024 * 1024;
+
         /**
          * @brief Default constructor initializing a predefined set of city coordinates.
          *
@@ -35,8 +100,38 @@ namespace Geneticxx {
          *
          * @param rows Number of cities (destinations).
          * @param array Pointer to a dynamically allocated 2D array containing city coordinates.
+         * @param maxMatrixBytes Largest size of the precomputed distance matrix, in bytes. Larger instances compute
+         *        distances on the fly.
+         * @param distanceType How distances are computed from the coordinates.
          */
-        EvaluationTravellingSalesman(int rows, double** array);
+        EvaluationTravellingSalesman(int rows, double** array, std::size_t maxMatrixBytes = DefaultMaxMatrixBytes,
+                                     DistanceType distanceType = DistanceType::Euclidean);
+
+        /**
+         * @brief Loads the cities of a TSPLIB instance.
+         *
+         * Instances with `EDGE_WEIGHT_TYPE` `EUC_2D`, `CEIL_2D` or `ATT` and a `NODE_COORD_SECTION` are supported;
+         * distances follow the TSPLIB definition of the edge weight type, see `DistanceType`. Cities are renumbered
+         * from 0 in the order of the section.
+         *
+         * @param input Stream containing the instance.
+         * @param maxMatrixBytes Largest size of the precomputed distance matrix, in bytes.
+         * @return The evaluation of the instance.
+         * @throws std::runtime_error if the instance is malformed or uses an unsupported format.
+         */
+        static std::unique_ptr<EvaluationTravellingSalesman> fromTsplib(std::istream &input,
+                                                                         std::size_t maxMatrixBytes = DefaultMaxMatrixBytes);
+
+        /**
+         * @brief Loads the cities of a TSPLIB instance from a file, see `fromTsplib(std::istream&, std::size_t)`.
+         *
+         * @param path Path of the `.tsp` file.
+         * @param maxMatrixBytes Largest size of the precomputed distance matrix, in bytes.
+         * @return The evaluation of the instance.
+         * @throws std::runtime_error if the file cannot be read, the instance is malformed or unsupported.
+         */
+        static std::unique_ptr<EvaluationTravellingSalesman> fromTsplib(const std::filesystem::path &path,
+                                                                         std::size_t maxMatrixBytes = DefaultMaxMatrixBytes);
 
         /**
          * @brief Destructor for `EvaluationTravellingSalesman`.
@@ -55,6 +150,38 @@ namespace Geneticxx {
         void setRows(int m_rows);
 
         double *getCity(int index);
+
+        /**
+         * @brief Returns true if distances are read from the precomputed matrix rather than computed on the fly.
+         */
+        bool hasDistanceMatrix() const;
+
+        /**
+         * @brief Returns the distance between two cities.
+         */
+        double getDistance(int from, int to) const;
+
+        /**
+         * @brief Returns how distances are computed from the coordinates.
+         */
+        DistanceType getDistanceType() const;
+
+        /**
+         * @brief Declares whether every route visits every city exactly once.
+         *
+         * Routes built as permutations and changed only by operators keeping them permutations, such as
+         * `MutatorRandomSwap`, never pay the revisit penalty, which lets `evaluateDelta` update their scores without
+         * looking at the rest of the route. Once declared, evaluating a route revisiting cities throws.
+         *
+         * @param permutations True if all routes are permutations of the cities; false by default.
+         */
+        void setPermutationRoutes(bool permutations);
+
+        /**
+         * @brief Returns whether every route is declared to visit every city exactly once.
+         */
+        bool hasPermutationRoutes() const;
+
         /**
          * @brief Evaluates a given route and calculates its total travel distance.
          *
@@ -63,5 +190,39 @@ namespace Geneticxx {
          * @throws std::invalid_argument if the number of cities in the phenome does not match `m_rows`.
          */
         std::vector<double> evaluate(const Phenome* phenome) override;
+
+        /**
+         * @brief Returns the number of scores returned for every route.
+         *
+         * @return 1.
+         */
+        std::size_t getObjectivesNumber() const override;
+
+        /**
+         * @brief Evaluates a batch of routes, writing one total distance per route without allocating results.
+         *
+         * @param phenomes Phenomes representing the proposed routes.
+         * @param scores Output buffer receiving one score per route.
+         */
+        void evaluateBatch(std::span<const Phenome* const> phenomes, std::span<double> scores) override;
+
+        /**
+         * @brief Updates the score of a route from the edges adjacent to the changed positions.
+         *
+         * Only the distances of the edges adjacent to the changes are looked up, e.g. four for a swap of two
+         * cities, so an update costs O(k) for k changes whatever the size of the route. Only routes declared
+         * permutations with `setPermutationRoutes`, and changes permuting their cities, are supported: such routes
+         * pay no revisit penalty, which would otherwise take a pass over the route to count. Repeated updates
+         * accumulate rounding errors of the order of the machine epsilon per update.
+         *
+         * @param phenome Phenome exposing `Phenome1DView<int>` after the change.
+         * @param changes Changed positions with their previous cities as `int`.
+         * @param scores Total distance of the previous route, replaced with the distance of the current route.
+         *
+         * @return False for other phenomes, routes not declared permutations or changes that do not permute the
+         *         cities of the route.
+         */
+        bool evaluateDelta(const Phenome* phenome, std::span<const GeneChange> changes,
+                           std::span<double> scores) override;
     };
 }
@@ -1,6 +1,37 @@
 module GeneticAlgorithmSimple;
 
 namespace Geneticxx {
+    namespace {
+        // selection of one breeding thread: draws from the selection state shared by all threads with the
+        // thread's own generators, or falls back to the thread's own selection
+        class WorkerSelection : public SelectionSchema {
+        private:
+            const SelectionSchema &m_shared;
+            BreedingOperators &m_operators;
+
+        public:
+            WorkerSelection(const SelectionSchema &shared, BreedingOperators &operators)
+                : m_shared{shared}, m_operators{operators} {
+            }
+
+            std::vector<std::unique_ptr<Individual>> select(Population *population, size_t size) override {
+                return m_operators.selection->select(population, size);
+            }
+
+            bool selectIndices(Population *population, std::span<size_t> indices) override {
+                return m_shared.selectIndicesWith(population, indices, m_operators.genInt.get(),
+                                                  m_operators.genReal.get()) ||
+                       m_operators.selection->selectIndices(population, indices);
+            }
+        };
+
+        // restarts the generators of the set at the given stream, false if one of them cannot be reseeded
+        bool reseedOperators(BreedingOperators &operators, std::uint64_t stream) {
+            return (operators.genInt == nullptr || operators.genInt->reseed(stream)) &&
+                   (operators.genReal == nullptr || operators.genReal->reseed(stream));
+        }
+    }
+
     GeneticAlgorithmSimple::GeneticAlgorithmSimple(
         std::vector<std::unique_ptr<Population> > *populations,
         Evaluation *evaluation,
@@ -35,40 +66,104 @@ namespace Geneticxx {
 
 
     void GeneticAlgorithmSimple::step() {
+        if (m_islandOperatorsFactory) {
+            stepIslands();
+            return;
+        }
         notify(genStart, &m_populations);
 
-        for (auto &pop: m_populations) {
-            auto newPopulation = pop.get()->createNew();
-            newPopulation->resize(pop->getSize());
-            size_t siz = 0;
-            while (siz < pop->getSize()) {
-                auto childrenGenomes = m_crossoverSchema->crossover(
-                    m_selectionSchema->select(pop.get(), 1)[0]->getGenome(),
-                    m_selectionSchema->select(pop.get(), 1)[0]->getGenome()
-                    );
-
-                // if generated number is lower than the set mutation rate then perform a mutation and update the phenome
-                for (auto &child: childrenGenomes) {
-                    tryToMutate(child.get());
-                    auto temp = pop->getIndividual(0)->clone();
-                    temp->setGenome(child.release()); // TODO set genome should take unique ptr
-                    temp->updatePhenome();
-                    newPopulation->setIndividual(siz, temp); // TODO do iterators get invalidated? this might break for longer vectors
-                    ++siz; //TODO make function pushbackIndividual rather than this method?
-                }
-            }
+        for (size_t populationIndex = 0; populationIndex < m_populations.size(); populationIndex++) {
+            evolvePopulation(populationIndex, nullptr);
+            notify(genDone, &m_populations);
+        }
+    }
 
-            m_dispatcher->dispatch(newPopulation.get(), &m_evaluation); //TODO don't get(), or do, dispatch should use the whole vector?
-            m_scalingSchema->scale(newPopulation.get()); //TODO don't get(), or do
+    void GeneticAlgorithmSimple::evolvePopulation(size_t populationIndex, BreedingOperators *islandOperators) {
+        auto &pop = m_populations[populationIndex];
+        std::unique_ptr<Population> ownedPopulation;
+        Population *newPopulation;
+        if (m_doubleBuffering) {
+            newPopulation = prepareOffspringBuffer(populationIndex);
+        } else {
+            ownedPopulation = pop.get()->createNew();
+            ownedPopulation->resize(pop->getSize());
+            newPopulation = ownedPopulation.get();
+        }
+        if (islandOperators != nullptr) {
+            breedRange(pop.get(), newPopulation, 0, newPopulation->getSize(), islandOperators->selection.get(),
+                       islandOperators->crossover.get(), islandOperators->mutation.get(),
+                       islandOperators->genReal.get());
+        } else if (m_breedingOperatorsFactory) {
+            breedParallel(pop.get(), newPopulation, populationIndex);
+        } else {
+            breedRange(pop.get(), newPopulation, 0, newPopulation->getSize(), m_selectionSchema.get(),
+                       m_crossoverSchema.get(), m_mutationSchema.get(), m_randomNumbersGeneratorReal);
+        }
 
+        m_dispatcher->dispatch(newPopulation, &m_evaluation); //TODO dispatch should use the whole vector?
+        m_scalingSchema->scale(newPopulation);
 
-            //
-            //notify(evalDone, newPopulation);
 
-            m_replacementSchema->replace(pop.get(), newPopulation.get()); //TODO don't get()
+        //
+        //notify(evalDone, newPopulation);
 
-            notify(genDone, &m_populations);
+        // in double-buffered mode the individuals not taken over stay in the buffer, to be bred into next time
+        m_replacementSchema->replace(pop.get(), newPopulation); //TODO don't get()
+    }
+
+    void GeneticAlgorithmSimple::stepIslands() {
+        notify(genStart, &m_populations);
+
+        const size_t islands = m_populations.size();
+        // mailboxes are gathered up front, which also checks that every population is an island
+        std::vector<std::shared_ptr<MigrationMailbox>> mailboxes;
+        for (auto &pop: m_populations) {
+            auto island = dynamic_cast<PopulationMigratory *>(pop.get());
+            if (island == nullptr) {
+                throw std::invalid_argument("Island model requires every population to be a PopulationMigratory");
+            }
+            mailboxes.push_back(island->getMailbox());
+        }
+        if (m_doubleBuffering && m_offspringBuffers.size() < islands) {
+            m_offspringBuffers.resize(islands);
+        }
+        while (m_islandOperators.size() < islands) {
+            m_islandOperators.push_back(m_islandOperatorsFactory(
+                static_cast<unsigned int>(splitMix64(splitMix64(m_islandSeed) + m_islandOperators.size()))));
         }
+
+        std::atomic<size_t> nextIsland{0};
+        const std::function<void(size_t)> worker = [&](size_t) {
+            try {
+                for (size_t index = nextIsland++; index < islands; index = nextIsland++) {
+                    dynamic_cast<PopulationMigratory *>(m_populations[index].get())->immigrate(m_migrationPolicy);
+                    evolvePopulation(index, &m_islandOperators[index]);
+                }
+            } catch (...) {
+                // the other threads stop claiming islands, the team rethrows the first failure once all returned
+                nextIsland = islands;
+                throw;
+            }
+        };
+        m_islandTeam->run(worker, islands);
+
+        // emigrants are posted once every island finished the generation, so an island never integrates migrants
+        // of the generation it is evolving, whichever thread evolves it
+        if (m_migrationPolicy.interval != 0 && m_migrationPolicy.migrants != 0) {
+            for (size_t index = 0; index < islands; index++) {
+                auto island = dynamic_cast<PopulationMigratory *>(m_populations[index].get());
+                if (island->getIteration() % m_migrationPolicy.interval != 0) {
+                    continue;
+                }
+                for (size_t target: migrationTargets(m_migrationPolicy.topology, index, islands,
+                                                     m_islandOperators[index].genInt.get())) {
+                    mailboxes[target]->post(index, island->selectEmigrants(m_migrationPolicy.migrants,
+                                                                           m_migrationPolicy.maximize));
+                }
+            }
+        }
+
+        notify(genDone, &m_populations);
     }
 
     void GeneticAlgorithmSimple::step(int steps) {
@@ -141,6 +236,175 @@ namespace Geneticxx {
         m_randomNumbersGeneratorReal = genReal;
     }
 
+    void GeneticAlgorithmSimple::setMutationChance(double mutationChance) {
+        if (!(mutationChance >= 0.0 && mutationChance <= 1.0)) {
+            throw std::invalid_argument("Mutation chance must be within [0, 1]");
+        }
+        m_mutationChance = mutationChance;
+    }
+
+    double GeneticAlgorithmSimple::getMutationChance() const {
+        return m_mutationChance;
+    }
+
+    void GeneticAlgorithmSimple::setParallelBreeding(unsigned int threadsNumber, BreedingOperatorsFactory factory,
+                                                     unsigned int seed, size_t blockSize) {
+        if (blockSize == 0) {
+            throw std::invalid_argument("Breeding block size must be greater than 0");
+        }
+        m_breedingThreads = threadsNumber == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threadsNumber;
+        m_breedingOperatorsFactory = std::move(factory);
+        m_breedingSeed = seed;
+        m_breedingBlockSize = blockSize;
+        m_breedingOperators.clear();
+        m_breedingTeam.reset();
+        if (!m_breedingOperatorsFactory) {
+            return;
+        }
+        // every set is built from the same seed, reseeding then makes a block's stream independent of its thread
+        for (unsigned int t = 0; t < m_breedingThreads; t++) {
+            m_breedingOperators.push_back(m_breedingOperatorsFactory(m_breedingSeed));
+        }
+        m_breedingTeam = std::make_unique<ThreadTeam>(m_breedingThreads);
+    }
+
+    void GeneticAlgorithmSimple::setIslandModel(unsigned int threadsNumber, MigrationPolicy policy,
+                                                BreedingOperatorsFactory factory, unsigned int seed) {
+        m_islandThreads = threadsNumber == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threadsNumber;
+        m_migrationPolicy = policy;
+        m_islandOperatorsFactory = std::move(factory);
+        m_islandSeed = seed;
+        m_islandOperators.clear();
+        m_islandTeam.reset();
+        if (m_islandOperatorsFactory) {
+            m_islandTeam = std::make_unique<ThreadTeam>(m_islandThreads);
+        }
+    }
+
+    void GeneticAlgorithmSimple::setDoubleBuffering(bool enabled) {
+        m_doubleBuffering = enabled;
+        if (!enabled) {
+            m_offspringBuffers.clear();
+        }
+    }
+
+    Population *GeneticAlgorithmSimple::prepareOffspringBuffer(size_t populationIndex) {
+        if (m_offspringBuffers.size() < m_populations.size()) {
+            m_offspringBuffers.resize(m_populations.size());
+        }
+        auto &population = m_populations[populationIndex];
+        auto &buffer = m_offspringBuffers[populationIndex];
+        if (!buffer) {
+            buffer = population->createNew();
+        }
+        if (buffer->getSize() != population->getSize()) {
+            buffer->resize(population->getSize());
+        }
+        for (size_t i = 0; i < buffer->getSize(); i++) {
+            if (buffer->getIndividual(i) == nullptr) {
+                buffer->setIndividual(i, population->getIndividual(i)->clone());
+            }
+        }
+        return buffer.get();
+    }
+
+    void GeneticAlgorithmSimple::breedRange(Population *population, Population *newPopulation, size_t begin,
+                                            size_t end, SelectionSchema *selection, CrossoverSchema *crossover,
+                                            MutationSchema *mutation, RandomRealFromRange *genReal) const {
+        size_t siz = begin;
+        std::array<size_t, 2> parentIndices{};
+        std::vector<std::unique_ptr<Individual>> selectedParents;
+        while (siz < end) {
+            // parents are read in place from the population, unless the selection can only return clones
+            Genome *parent1;
+            Genome *parent2;
+            if (selection->selectIndices(population, parentIndices)) {
+                parent1 = population->getIndividual(parentIndices[0])->getGenome();
+                parent2 = population->getIndividual(parentIndices[1])->getGenome();
+            } else {
+                selectedParents.clear();
+                selectedParents.push_back(std::move(selection->select(population, 1)[0]));
+                selectedParents.push_back(std::move(selection->select(population, 1)[0]));
+                parent1 = selectedParents[0]->getGenome();
+                parent2 = selectedParents[1]->getGenome();
+            }
+
+            if (m_doubleBuffering) {
+                // the slots already hold individuals from two generations ago, their genomes are overwritten
+                auto child1 = newPopulation->getIndividual(siz);
+                auto child2 = siz + 1 < end ? newPopulation->getIndividual(siz + 1) : nullptr;
+                const size_t bred = crossover->crossoverInto(parent1, parent2, child1->getGenome(),
+                                                             child2 != nullptr ? child2->getGenome() : nullptr);
+                for (size_t k = 0; k < bred; k++, siz++) {
+                    auto child = newPopulation->getIndividual(siz);
+                    if (genReal->generate(0, 1) < m_mutationChance) {
+                        mutation->mutate(child->getGenome());
+                    }
+                    child->invalidatePhenome();
+                }
+                continue;
+            }
+
+            auto childrenGenomes = crossover->crossover(parent1, parent2);
+            // children that do not fit into the range are dropped, so blocks never write outside their range
+            for (auto &child: childrenGenomes) {
+                if (siz >= end) {
+                    break;
+                }
+                // if generated number is lower than the set mutation rate then perform a mutation, the phenome is
+                // decoded once it is read by the evaluation
+                if (genReal->generate(0, 1) < m_mutationChance) {
+                    mutation->mutate(child.get());
+                }
+                auto temp = population->getIndividual(0)->clone();
+                temp->setGenome(child.release()); // TODO set genome should take unique ptr
+                temp->invalidatePhenome();
+                newPopulation->setIndividual(siz, temp);
+                ++siz;
+            }
+        }
+    }
+
+    void GeneticAlgorithmSimple::breedParallel(Population *population, Population *newPopulation,
+                                               size_t populationIndex) {
+        const size_t size = newPopulation->getSize();
+        const size_t blocksNumber = (size + m_breedingBlockSize - 1) / m_breedingBlockSize;
+        const std::uint64_t generationSeed = splitMix64(
+            splitMix64(m_breedingSeed) ^ (splitMix64(population->getIteration()) + populationIndex));
+
+        // the selection state, e.g. an alias table, is built once per generation and shared by all threads
+        const SelectionSchema &sharedSelection = *m_breedingOperators.front().selection;
+        m_breedingOperators.front().selection->prepare(population);
+
+        // blocks are claimed dynamically, but every block's stream and slots are fixed up front,
+        // so the bred population does not depend on which thread handles which block
+        std::atomic<size_t> nextBlock{0};
+        const std::function<void(size_t)> worker = [&](size_t member) {
+            try {
+                for (size_t block = nextBlock++; block < blocksNumber; block = nextBlock++) {
+                    const std::uint64_t stream = splitMix64(generationSeed + block);
+                    BreedingOperators *operators = &m_breedingOperators[member];
+                    BreedingOperators blockOperators;
+                    if (!reseedOperators(*operators, stream)) {
+                        // generators that cannot be reseeded get a new set of operators for the block
+                        blockOperators = m_breedingOperatorsFactory(static_cast<unsigned int>(stream));
+                        operators = &blockOperators;
+                    }
+                    WorkerSelection selection(sharedSelection, *operators);
+                    const size_t begin = block * m_breedingBlockSize;
+                    breedRange(population, newPopulation, begin, std::min(size, begin + m_breedingBlockSize),
+                               &selection, operators->crossover.get(), operators->mutation.get(),
+                               operators->genReal.get());
+                }
+            } catch (...) {
+                // the other threads stop claiming blocks, the team rethrows the first failure once all returned
+                nextBlock = blocksNumber;
+                throw;
+            }
+        };
+        m_breedingTeam->run(worker, blocksNumber);
+    }
+
     void GeneticAlgorithmSimple::tryToMutate(Genome *object) {
         if (m_randomNumbersGeneratorReal->generate(0, 1) < m_mutationChance) {
             m_mutationSchema->mutate(object);
@@ -2,10 +2,50 @@ export module GeneticAlgorithmSimple;
 
 export import GeneticAlgorithm;
 export import PublisherPopulation;
+export import RandomIntFromRange;
+export import PopulationMigratory;
+import ThreadTeam;
 import std;
 import std.compat;
 
 namespace Geneticxx {
+    /**
+     * @struct BreedingOperators
+     * @brief A private set of operators used by one breeding thread in parallel breeding mode.
+     *
+     * Built-in operators keep a non-owning pointer to their random numbers generator and keep internal state
+     * between calls (e.g. the alias table of `SelectorRoulette`), so they cannot be shared between threads.
+     * In parallel breeding mode every thread gets its own set of operators, built once, which owns the random
+     * numbers generators the operators point to. Before every block of child slots the generators are reseeded
+     * with the block's stream (see `RandomIntFromRange::reseed`), so apart from their generators the operators
+     * must not keep random state from one block to the next.
+     */
+    export struct BreedingOperators {
+        /// Selection used to pick the parents.
+        std::unique_ptr<SelectionSchema> selection;
+
+        /// Crossover applied to the parents' genomes.
+        std::unique_ptr<CrossoverSchema> crossover;
+
+        /// Mutation applied to the children's genomes.
+        std::unique_ptr<MutationSchema> mutation;
+
+        /// Integer generator owned by the set, to be passed to the operators that need one.
+        std::unique_ptr<RandomIntFromRange> genInt;
+
+        /// Real generator owned by the set, also used to decide whether a child is mutated.
+        std::unique_ptr<RandomRealFromRange> genReal;
+    };
+
+    /**
+     * @brief Factory building a set of breeding operators seeded with the given seed.
+     *
+     * The factory has to be deterministic: the same seed must always produce operators generating the same
+     * sequence of random numbers. Its generators should support `reseed`; for those that do not, a new set of
+     * operators is built for every block, possibly concurrently from several threads.
+     */
+    export using BreedingOperatorsFactory = std::function<BreedingOperators(unsigned int seed)>;
+
     /**
      * @class GeneticAlgorithmSimple
      * @brief A basic genetic algorithm implementation.
@@ -56,6 +96,108 @@ namespace Geneticxx {
         /// A pointer to a random number generator for real numbers.
         RandomRealFromRange* m_randomNumbersGeneratorReal;
 
+        /// Number of threads breeding the offspring, used only when m_breedingOperatorsFactory is set.
+        unsigned int m_breedingThreads = 1;
+
+        /// Number of consecutive child slots bred from a single random stream.
+        size_t m_breedingBlockSize = 64;
+
+        /// Base seed from which the seed of every breeding block is derived.
+        unsigned int m_breedingSeed = 0;
+
+        /// Factory of the breeding operators; when empty the offspring are bred serially with the shared operators.
+        BreedingOperatorsFactory m_breedingOperatorsFactory;
+
+        /// Operators of every breeding thread, created once from m_breedingOperatorsFactory.
+        std::vector<BreedingOperators> m_breedingOperators;
+
+        /// Threads breeding the offspring, kept alive between generations.
+        std::unique_ptr<ThreadTeam> m_breedingTeam;
+
+        /// Whether the offspring are bred into a reused buffer per population, from which the replacement schema
+        /// transfers them into the population.
+        bool m_doubleBuffering = false;
+
+        /// Spare population of every entry of m_populations, holding the discarded individuals in double-buffered mode.
+        std::vector<std::unique_ptr<Population>> m_offspringBuffers;
+
+        /// Factory of the per-island operators; when empty the populations evolve one after another.
+        BreedingOperatorsFactory m_islandOperatorsFactory;
+
+        /// Operators of every island, created once from m_islandOperatorsFactory.
+        std::vector<BreedingOperators> m_islandOperators;
+
+        /// Migration settings of the island model.
+        MigrationPolicy m_migrationPolicy;
+
+        /// Number of threads evolving the islands.
+        unsigned int m_islandThreads = 1;
+
+        /// Base seed from which the seed of every island's operators is derived.
+        unsigned int m_islandSeed = 0;
+
+        /// Threads evolving the islands, kept alive between steps.
+        std::unique_ptr<ThreadTeam> m_islandTeam;
+
+        /**
+         * @brief Fills the slots [begin, end) of the new population with children bred from the old one.
+         *
+         * In double-buffered mode the slots already hold individuals, whose genomes are overwritten in place
+         * with `CrossoverSchema::crossoverInto`; otherwise new individuals are cloned for every slot.
+         *
+         * @param population Population the parents are selected from.
+         * @param newPopulation Population the children are written to.
+         * @param begin First child slot to fill.
+         * @param end One past the last child slot to fill.
+         * @param selection Selection used to pick the parents.
+         * @param crossover Crossover applied to the parents' genomes.
+         * @param mutation Mutation applied to the children's genomes.
+         * @param genReal Generator deciding whether a child is mutated.
+         */
+        void breedRange(Population* population, Population* newPopulation, size_t begin, size_t end,
+                        SelectionSchema* selection, CrossoverSchema* crossover, MutationSchema* mutation,
+                        RandomRealFromRange* genReal) const;
+
+        /**
+         * @brief Returns the spare population of the given population, ready to be bred into.
+         *
+         * On first use, or when the size of the population changed, the buffer is created. Its empty slots, on
+         * first use or left by a replacement taking children over, are filled with clones of the population's
+         * individuals; all other individuals are reused.
+         *
+         * @param populationIndex Index of the population in m_populations.
+         * @return The buffer, sized like the population, with every slot holding an individual.
+         */
+        Population* prepareOffspringBuffer(size_t populationIndex);
+
+        /**
+         * @brief Breeds the whole new population with the per-thread operators on m_breedingThreads threads.
+         *
+         * @param population Population the parents are selected from.
+         * @param newPopulation Population the children are written to, already resized.
+         * @param populationIndex Index of the population in m_populations, mixed into the block seeds.
+         */
+        void breedParallel(Population* population, Population* newPopulation, size_t populationIndex);
+
+        /**
+         * @brief Breeds, evaluates and scales the next generation of one population and makes it current.
+         *
+         * @param populationIndex Index of the population in m_populations.
+         * @param islandOperators Operators of the island the population belongs to, or null to use the shared
+         *        operators of the algorithm.
+         */
+        void evolvePopulation(size_t populationIndex, BreedingOperators* islandOperators);
+
+        /**
+         * @brief Executes one generation of every island concurrently and exchanges migrants between them.
+         *
+         * Each island first integrates the migrants it received, then evolves one generation with its own
+         * operators. Once all islands finished the generation, every `m_migrationPolicy.interval` generations
+         * each island posts clones of its best individuals to the mailboxes of its targets, and observers are
+         * notified.
+         */
+        void stepIslands();
+
     public:
         /**
          * @brief Constructs a GeneticAlgorithmSimple instance.
@@ -148,6 +290,85 @@ namespace Geneticxx {
         /// @param genReal The random number generator to use.
         void setRandomNumbersGenerator(RandomRealFromRange* genReal) override;
 
+        /**
+         * @brief Sets the probability of mutating a child.
+         *
+         * Mutations that apply their own probability to every gene, such as the per-gene mode of
+         * `Mutator1DPointBitFlip`, are meant to be used with a chance of 1.
+         *
+         * @param mutationChance Probability within [0, 1]; 0.1 by default.
+         *
+         * @throws std::invalid_argument If the probability is not within [0, 1].
+         */
+        void setMutationChance(double mutationChance);
+
+        /// Returns the probability of mutating a child.
+        double getMutationChance() const;
+
+        /**
+         * @brief Enables parallel breeding of the offspring.
+         *
+         * The child slots of every new population are split into blocks of `blockSize` consecutive slots.
+         * Each block is bred by one of `threadsNumber` threads, which are started here and kept alive. Every
+         * thread owns a set of operators created once by `factory` from `seed`, whose generators are reseeded
+         * for every block with a stream derived from the population's iteration, the population's index and the
+         * block's index. The parents are drawn through the selection state of the first set, prepared once per
+         * generation (see `SelectionSchema::prepare`), so e.g. the alias table of `SelectorRoulette` is built
+         * once and not once per thread. Children are written directly to their preassigned slots, so for a given
+         * seed the result does not depend on the number of threads. Passing an empty factory restores serial
+         * breeding.
+         *
+         * The individual used as a template for new children is only read, so `Individual::clone` and the
+         * population's `getIndividual`/`setIndividual` must be safe to call concurrently for distinct slots.
+         *
+         * @param threadsNumber Number of breeding threads; 0 uses the hardware concurrency.
+         * @param factory Factory of the per-thread operators.
+         * @param seed Base seed of the breeding streams.
+         * @param blockSize Number of child slots bred from one random stream; must be greater than 0.
+         */
+        void setParallelBreeding(unsigned int threadsNumber, BreedingOperatorsFactory factory,
+                                 unsigned int seed = 0, size_t blockSize = 64);
+
+        /**
+         * @brief Enables or disables double-buffered generations.
+         *
+         * When enabled, every population gets a preallocated twin. The offspring are bred into the twin,
+         * reusing its individuals, genomes and phenomes in place, and the replacement schema then moves the
+         * survivors from the twin into the population, which stays the same object. Discarded individuals are
+         * left in the twin to be bred into in the next generation: `ReplacementFull` exchanges the two
+         * generations without copying, so after the first generation breeding performs no allocations of its
+         * own, while with other replacements the slots of the children taken over are refilled with clones.
+         *
+         * The genomes of the population have to support `Genome::assign`.
+         *
+         * @param enabled True to breed into recycled buffers, false to create a new population every generation.
+         */
+        void setDoubleBuffering(bool enabled);
+
+        /**
+         * @brief Enables the island model, evolving every population as an island on its own thread.
+         *
+         * All populations have to be `PopulationMigratory`. In every step the islands evolve one generation
+         * concurrently on `threadsNumber` threads, which are started here and kept alive between steps, each
+         * island with its own set of operators created by `factory` with a seed derived from `seed` and the
+         * island's index. Islands exchange their best individuals through lock-free mailboxes according to
+         * `policy`, see `MigrationPolicy`. Migrants are posted after all islands finished a step and integrated at
+         * the start of the next one, so for a given seed the result does not depend on the number of threads.
+         * Parallel breeding within an island is not used in this mode.
+         *
+         * The evaluations, dispatcher, scaling and replacement schemas are shared by all islands and have to be
+         * safe to call concurrently for distinct populations. The dispatchers of the library are, `DispatcherCached`
+         * as long as the dispatcher it wraps is, and so are the scaling and replacement schemas of the library.
+         * Passing an empty factory restores serial evolution.
+         *
+         * @param threadsNumber Number of threads evolving the islands; 0 uses the hardware concurrency.
+         * @param policy Topology, interval and size of the migrations.
+         * @param factory Factory of the per-island operators.
+         * @param seed Base seed of the islands' operators.
+         */
+        void setIslandModel(unsigned int threadsNumber, MigrationPolicy policy, BreedingOperatorsFactory factory,
+                            unsigned int seed = 0);
+
         /// Attempts to mutate a given genome based on a predefined mutation probability.
         /// @param object The genome to mutate.
         void tryToMutate(Genome* object);
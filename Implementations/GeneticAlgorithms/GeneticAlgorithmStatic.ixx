@@ -0,0 +1,446 @@
+export module GeneticAlgorithmStatic;
+
+export import GeneticAlgorithm;
+export import PublisherPopulation;
+export import StaticOperators;
+export import Genome1D;
+import std;
+import std.compat;
+
+namespace Geneticxx {
+    /**
+     * @class GeneticAlgorithmStatic
+     * @brief Generational genetic algorithm whose operators are composed at compile time.
+     *
+     * The genomes are plain values, e.g. `std::vector<double>`, stored contiguously together with their
+     * fitness, and the operators are function objects checked by the `StaticGenome`, `StaticEvaluation`,
+     * `StaticSelection`, `StaticCrossover` and `StaticMutation` concepts. Selection, crossover, mutation and
+     * evaluation of a child are thus one loop without virtual calls or casts, which the compiler can inline and
+     * vectorize as a whole. The evaluation works on the genome directly, decoding the phenome itself if needed.
+     *
+     * Every generation, the `elites` best genomes are copied unchanged and the remaining slots are bred into the
+     * genomes of the generation before, reusing their storage. The slots are split into blocks drawing from
+     * their own `PhiloxEngine` stream, derived from the seed, the iteration and the block, so the result only
+     * depends on the seed and not on the number of threads. The operators are shared by all threads and must
+     * therefore not modify any state; all randomness comes from the engine passed to them.
+     *
+     * Use `GeneticAlgorithmStaticWrapper` to drive it through the `GeneticAlgorithm` interface.
+     *
+     * @tparam GenomeType Type of the genomes.
+     * @tparam EvaluationType Function object computing the fitness of a genome; higher is better by default.
+     * @tparam SelectionType Function object selecting a parent.
+     * @tparam CrossoverType Function object writing two children of two parents.
+     * @tparam MutationType Function object mutating a child in place.
+     */
+    export template<StaticGenome GenomeType, typename EvaluationType, StaticSelection SelectionType,
+        typename CrossoverType, typename MutationType>
+        requires StaticEvaluation<EvaluationType, GenomeType> && StaticCrossover<CrossoverType, GenomeType> &&
+                 StaticMutation<MutationType, GenomeType>
+    class GeneticAlgorithmStatic {
+    public:
+        using Genome = GenomeType;
+
+    private:
+        std::vector<GenomeType> m_genomes; ///< Current generation.
+        std::vector<double> m_fitness; ///< Fitness of the current generation.
+        std::vector<GenomeType> m_offspring; ///< Previous generation, whose storage the next one is bred into.
+        std::vector<double> m_offspringFitness; ///< Fitness of the generation being bred.
+        std::vector<GenomeType> m_spares; ///< Second child of the last pair of every block, if it does not fit.
+        std::vector<size_t> m_order; ///< Indices of the current generation, best first up to the elites.
+
+        EvaluationType m_evaluation;
+        SelectionType m_selection;
+        CrossoverType m_crossover;
+        MutationType m_mutation;
+
+        std::uint64_t m_seed; ///< Seed of the breeding streams.
+        size_t m_iteration = 0; ///< Number of generations bred.
+        double m_mutationChance = 0.1; ///< Probability of mutating a child.
+        size_t m_elites = 0; ///< Number of best genomes copied to the next generation.
+        bool m_maximize = true; ///< Whether the elites are the genomes with the highest fitness.
+        unsigned int m_threads = 1; ///< Number of threads breeding the blocks.
+        size_t m_blockSize = 64; ///< Number of slots bred from one engine stream.
+
+        /**
+         * @brief Breeds and evaluates the children of the slots [begin, end) with the engine of the block.
+         */
+        void breedBlock(size_t block, size_t begin, size_t end) {
+            PhiloxEngine random = PhiloxEngine{m_seed, m_iteration}.split(block);
+            const std::span<const double> fitness{m_fitness};
+            for (size_t slot = begin; slot < end; slot += 2) {
+                const GenomeType &parent1 = m_genomes[m_selection(fitness, random)];
+                const GenomeType &parent2 = m_genomes[m_selection(fitness, random)];
+                const bool pair = slot + 1 < end;
+                GenomeType &child2 = pair ? m_offspring[slot + 1] : m_spares[block];
+                m_crossover(parent1, parent2, m_offspring[slot], child2, random);
+
+                for (size_t child = slot; child < std::min(end, slot + 2); child++) {
+                    if (drawUnit(random) < m_mutationChance) {
+                        m_mutation(m_offspring[child], random);
+                    }
+                    m_offspringFitness[child] = static_cast<double>(m_evaluation(m_offspring[child]));
+                }
+            }
+        }
+
+    public:
+        /**
+         * @brief Constructs the algorithm for the given initial genomes and operators.
+         *
+         * @param genomes Initial generation, evaluated by `initialize`.
+         * @param evaluation Evaluation of the genomes.
+         * @param selection Selection of the parents.
+         * @param crossover Crossover of the parents.
+         * @param mutation Mutation of the children.
+         * @param seed Seed of the breeding streams.
+         */
+        GeneticAlgorithmStatic(std::vector<GenomeType> genomes, EvaluationType evaluation,
+                               SelectionType selection, CrossoverType crossover, MutationType mutation,
+                               std::uint64_t seed = 0)
+            : m_genomes{std::move(genomes)}, m_evaluation{std::move(evaluation)},
+              m_selection{std::move(selection)}, m_crossover{std::move(crossover)},
+              m_mutation{std::move(mutation)}, m_seed{seed} {
+        }
+
+        /**
+         * @brief Evaluates the current generation.
+         */
+        void initialize() {
+            m_fitness.resize(m_genomes.size());
+            for (size_t i = 0; i < m_genomes.size(); i++) {
+                m_fitness[i] = static_cast<double>(m_evaluation(m_genomes[i]));
+            }
+        }
+
+        /**
+         * @brief Replaces the current generation and evaluates it.
+         *
+         * @param genomes The new generation.
+         */
+        void setGenomes(std::vector<GenomeType> genomes) {
+            m_genomes = std::move(genomes);
+            initialize();
+        }
+
+        /**
+         * @brief Breeds, mutates and evaluates the next generation and makes it current.
+         *
+         * @throws std::logic_error If the current generation was not evaluated by `initialize`.
+         */
+        void step() {
+            const size_t size = m_genomes.size();
+            if (m_fitness.size() != size) {
+                throw std::logic_error("The genomes have to be evaluated by initialize first");
+            }
+            if (size == 0) {
+                m_iteration++;
+                return;
+            }
+            m_offspring.resize(size);
+            m_offspringFitness.resize(size);
+
+            const size_t elites = std::min(m_elites, size);
+            partitionBest(m_fitness, elites, m_maximize, m_order);
+            for (size_t i = 0; i < elites; i++) {
+                m_offspring[i] = m_genomes[m_order[i]];
+                m_offspringFitness[i] = m_fitness[m_order[i]];
+            }
+
+            const size_t blocksNumber = (size - elites + m_blockSize - 1) / m_blockSize;
+            if (m_spares.size() < blocksNumber) {
+                m_spares.resize(blocksNumber);
+            }
+            std::atomic<size_t> nextBlock{0};
+            std::exception_ptr failure;
+            std::mutex failureMutex;
+            auto worker = [&]() {
+                try {
+                    for (size_t block = nextBlock++; block < blocksNumber; block = nextBlock++) {
+                        const size_t begin = elites + block * m_blockSize;
+                        breedBlock(block, begin, std::min(size, begin + m_blockSize));
+                    }
+                } catch (...) {
+                    std::lock_guard lock(failureMutex);
+                    if (!failure) {
+                        failure = std::current_exception();
+                    }
+                    nextBlock = blocksNumber;
+                }
+            };
+
+            const size_t threadsNumber = std::min<size_t>(m_threads, blocksNumber);
+            std::vector<std::jthread> threads;
+            for (size_t t = 1; t < threadsNumber; t++) {
+                threads.emplace_back(worker);
+            }
+            worker();
+            threads.clear(); // joins
+            if (failure) {
+                std::rethrow_exception(failure);
+            }
+
+            std::swap(m_genomes, m_offspring);
+            std::swap(m_fitness, m_offspringFitness);
+            m_iteration++;
+        }
+
+        /**
+         * @brief Executes the given number of generations.
+         */
+        void step(size_t steps) {
+            for (size_t i = 0; i < steps; i++) {
+                step();
+            }
+        }
+
+        /**
+         * @brief Executes generations until the predicate, checked after every generation, holds.
+         *
+         * @param stop Predicate called with the algorithm.
+         */
+        template<std::predicate<const GeneticAlgorithmStatic &> StopType>
+        void evolve(StopType stop) {
+            do {
+                step();
+            } while (!stop(*this));
+        }
+
+        /**
+         * @brief Sets the probability of mutating a child.
+         *
+         * @throws std::invalid_argument If the probability is not within [0, 1].
+         */
+        void setMutationChance(double mutationChance) {
+            if (!(mutationChance >= 0.0 && mutationChance <= 1.0)) {
+                throw std::invalid_argument("Mutation chance must be within [0, 1]");
+            }
+            m_mutationChance = mutationChance;
+        }
+
+        /**
+         * @brief Sets the number of best genomes copied unchanged to the next generation.
+         *
+         * @param elites Number of elites, 0 by default.
+         * @param maximize Whether the best genomes have the highest fitness.
+         */
+        void setElitism(size_t elites, bool maximize = true) {
+            m_elites = elites;
+            m_maximize = maximize;
+        }
+
+        /**
+         * @brief Breeds the blocks of every generation on several threads.
+         *
+         * @param threadsNumber Number of threads; 0 uses the hardware concurrency.
+         * @param blockSize Number of slots bred from one engine stream; must be greater than 0. Changing it
+         *        changes the bred generations, the number of threads does not.
+         *
+         * @throws std::invalid_argument If the block size is 0.
+         */
+        void setThreads(unsigned int threadsNumber, size_t blockSize = 64) {
+            if (blockSize == 0) {
+                throw std::invalid_argument("Breeding block size must be greater than 0");
+            }
+            m_threads = threadsNumber == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threadsNumber;
+            m_blockSize = blockSize;
+        }
+
+        /// Returns the current generation.
+        std::span<const GenomeType> getGenomes() const {
+            return m_genomes;
+        }
+
+        /// Returns the fitness of the current generation, empty before `initialize`.
+        std::span<const double> getFitness() const {
+            return m_fitness;
+        }
+
+        /// Returns the number of generations bred.
+        size_t getIteration() const {
+            return m_iteration;
+        }
+    };
+
+    /**
+     * @class GeneticAlgorithmStaticWrapper
+     * @brief Exposes a `GeneticAlgorithmStatic` through the `GeneticAlgorithm` interface.
+     *
+     * Evolves a single population whose genomes expose their genes as a `Genome1DView<T>`. `initialize` runs the
+     * initialization schema, if set, and copies the genes into the static algorithm; after every generation the
+     * genes and the fitness are copied back into the individuals, whose phenomes are invalidated, so stopping
+     * criteria and observers see an ordinary population. The operators are fixed at compile time, hence the
+     * setters of the other operators throw.
+     *
+     * @tparam T Type of the genes, the static genomes are `std::vector<GeneStorage<T>>`.
+     * @tparam AlgorithmType Instantiation of `GeneticAlgorithmStatic`.
+     */
+    export template<typename T, typename AlgorithmType>
+        requires std::same_as<typename AlgorithmType::Genome, std::vector<GeneStorage<T>>>
+    class GeneticAlgorithmStaticWrapper : public GeneticAlgorithm, public PublisherPopulation {
+    private:
+        /**
+         * @enum event
+         * @brief Represents different stages of the genetic algorithm.
+         */
+        enum event { genDone, genStart, evalDone };
+
+        std::vector<std::unique_ptr<Population>> m_populations; ///< The single evolved population.
+        AlgorithmType m_algorithm; ///< The static algorithm doing the work.
+        std::unique_ptr<StoppingCriterionSchema> m_stoppingCriterionSchema;
+        std::unique_ptr<InitializationSchema> m_initializationSchema;
+
+        [[noreturn]] static void rejectOperator() {
+            throw std::logic_error("The operators of GeneticAlgorithmStatic are fixed at compile time");
+        }
+
+        Genome1DView<T> *viewOf(size_t index) {
+            auto view = asGenomeView<T>(m_populations.front()->getIndividual(index)->getGenome());
+            if (view == nullptr) {
+                throw std::invalid_argument("GeneticAlgorithmStaticWrapper requires genomes exposing their genes");
+            }
+            return view;
+        }
+
+        /// Copies the genes and the fitness of the static algorithm into the individuals.
+        void writeBack() {
+            auto &population = m_populations.front();
+            const auto genomes = m_algorithm.getGenomes();
+            const auto fitness = m_algorithm.getFitness();
+            for (size_t i = 0; i < genomes.size(); i++) {
+                auto values = viewOf(i)->getValues();
+                if (values.size() != genomes[i].size()) {
+                    throw std::logic_error("The static algorithm changed the size of a genome");
+                }
+                std::ranges::copy(genomes[i], values.begin());
+                auto individual = population->getIndividual(i);
+                individual->getGenome()->markDirty(0, values.size());
+                individual->invalidatePhenome();
+                individual->setFitness(fitness[i]);
+            }
+        }
+
+    public:
+        /**
+         * @brief Wraps the static algorithm.
+         *
+         * @param populations Vector holding the single population to evolve, moved into the wrapper.
+         * @param algorithm The static algorithm; its genomes are replaced by the population's on `initialize`.
+         * @param stoppingCriterion Stopping criterion of `evolve`, owned by the wrapper.
+         *
+         * @throws std::invalid_argument If the vector does not hold exactly one population.
+         */
+        GeneticAlgorithmStaticWrapper(std::vector<std::unique_ptr<Population>> *populations,
+                                      AlgorithmType algorithm, StoppingCriterionSchema *stoppingCriterion = nullptr)
+            : m_algorithm{std::move(algorithm)}, m_stoppingCriterionSchema{stoppingCriterion} {
+            if (populations->size() != 1) {
+                throw std::invalid_argument("GeneticAlgorithmStaticWrapper evolves exactly one population");
+            }
+            m_populations = std::move(*populations);
+        }
+
+        /// Returns the wrapped static algorithm.
+        AlgorithmType &getAlgorithm() {
+            return m_algorithm;
+        }
+
+        /// Returns the evolved population.
+        Population *getPopulation() {
+            return m_populations.front().get();
+        }
+
+        void step() override {
+            notify(genStart, &m_populations);
+            m_algorithm.step();
+            writeBack();
+            m_populations.front()->increaseIteration();
+            notify(genDone, &m_populations);
+        }
+
+        void step(int steps) override {
+            for (int i = 0; i < steps; i++) {
+                step();
+            }
+        }
+
+        /**
+         * @brief Executes generations until the stopping criterion holds for the population.
+         *
+         * @throws std::logic_error If no stopping criterion is set.
+         */
+        void evolve() override {
+            if (!m_stoppingCriterionSchema) {
+                throw std::logic_error("A stopping criterion is required to evolve");
+            }
+            do {
+                step();
+            } while (!m_stoppingCriterionSchema->check(m_populations.front().get()));
+        }
+
+        void initialize() override {
+            if (m_initializationSchema) {
+                m_initializationSchema->initialize(&m_populations);
+            }
+            auto &population = m_populations.front();
+            std::vector<std::vector<GeneStorage<T>>> genomes(population->getSize());
+            for (size_t i = 0; i < genomes.size(); i++) {
+                const auto values = viewOf(i)->getValues();
+                genomes[i].assign(values.begin(), values.end());
+            }
+            m_algorithm.setGenomes(std::move(genomes));
+            writeBack();
+        }
+
+        /// @throws std::logic_error The wrapper evolves exactly one population.
+        void addPopulation(Population *population) override {
+            throw std::logic_error("GeneticAlgorithmStaticWrapper evolves exactly one population");
+        }
+
+        /// @throws std::logic_error The evaluation is fixed at compile time.
+        void addEvaluation(Evaluation *evaluation) override {
+            rejectOperator();
+        }
+
+        /// @throws std::logic_error The replacement is fixed at compile time.
+        void setReplacementSchema(ReplacementSchema *replacementSchema) override {
+            rejectOperator();
+        }
+
+        void setStoppingCriterionSchema(StoppingCriterionSchema *stoppingCriterionSchema) override {
+            m_stoppingCriterionSchema = std::unique_ptr<StoppingCriterionSchema>(stoppingCriterionSchema);
+        }
+
+        /// @throws std::logic_error The selection is fixed at compile time.
+        void setSelectionSchema(SelectionSchema *selectionSchema) override {
+            rejectOperator();
+        }
+
+        void setInitializationSchema(InitializationSchema *initializationSchema) override {
+            m_initializationSchema = std::unique_ptr<InitializationSchema>(initializationSchema);
+        }
+
+        /// @throws std::logic_error The crossover is fixed at compile time.
+        void setCrossoverSchema(CrossoverSchema *crossoverSchema) override {
+            rejectOperator();
+        }
+
+        /// @throws std::logic_error The mutation is fixed at compile time.
+        void setMutationSchema(MutationSchema *mutationSchema) override {
+            rejectOperator();
+        }
+
+        /// @throws std::logic_error The fitness is not scaled.
+        void setScalingSchema(ScalingSchema *scalingSchema) override {
+            rejectOperator();
+        }
+
+        /// @throws std::logic_error The children are evaluated while they are bred.
+        void setDispatcher(Dispatcher *dispatcher) override {
+            rejectOperator();
+        }
+
+        /// @throws std::logic_error The random numbers come from the algorithm's own engines.
+        void setRandomNumbersGenerator(RandomRealFromRange *genReal) override {
+            rejectOperator();
+        }
+    };
+}
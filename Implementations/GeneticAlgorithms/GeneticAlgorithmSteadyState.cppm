@@ -0,0 +1,374 @@
+module GeneticAlgorithmSteadyState;
+
+namespace Geneticxx {
+    size_t FitnessTournamentTree::loser(size_t first, size_t second) const {
+        const double a = m_Fitness[first];
+        const double b = m_Fitness[second];
+        if (std::isnan(a) != std::isnan(b)) {
+            return std::isnan(a) ? first : second;
+        }
+        if (a < b || (!(b < a) && first < second)) {
+            return first;
+        }
+        return second;
+    }
+
+    void FitnessTournamentTree::build(std::span<const double> fitness) {
+        const size_t size = fitness.size();
+        m_Fitness.assign(fitness.begin(), fitness.end());
+        m_Tree.resize(2 * size);
+        for (size_t i = 0; i < size; i++) {
+            m_Tree[size + i] = i;
+        }
+        // every node below size has both children in [2, 2 * size), so node 1 covers all leaves
+        for (size_t node = size; node-- > 1;) {
+            m_Tree[node] = loser(m_Tree[2 * node], m_Tree[2 * node + 1]);
+        }
+    }
+
+    void FitnessTournamentTree::update(size_t index, double fitness) {
+        const size_t size = m_Fitness.size();
+        m_Fitness[index] = fitness;
+        for (size_t node = (size + index) / 2; node > 0; node /= 2) {
+            m_Tree[node] = loser(m_Tree[2 * node], m_Tree[2 * node + 1]);
+        }
+    }
+
+    size_t FitnessTournamentTree::worst() const {
+        if (m_Fitness.empty()) {
+            throw std::out_of_range("The tournament tree is empty");
+        }
+        // with a single individual its leaf is node 1 itself
+        return m_Tree[1];
+    }
+
+    double FitnessTournamentTree::getFitness(size_t index) const {
+        return m_Fitness[index];
+    }
+
+    size_t FitnessTournamentTree::getSize() const {
+        return m_Fitness.size();
+    }
+
+    GeneticAlgorithmSteadyState::GeneticAlgorithmSteadyState(
+        std::vector<std::unique_ptr<Population> > *populations,
+        Evaluation *evaluation,
+        CrossoverSchema *crossover,
+        MutationSchema *mutation,
+        ScalingSchema *scaling,
+        SelectionSchema *selection,
+        InitializationSchema *initialization,
+        StoppingCriterionSchema *stoppingCriterion,
+        Dispatcher *dispatcher,
+        RandomRealFromRange *genReal,
+        size_t offspringPerStep
+    ) {
+        setOffspringPerStep(offspringPerStep);
+        m_populations = std::move(*populations);
+        m_evaluation.push_back(std::unique_ptr<Evaluation>(evaluation));
+        m_stoppingCriterionSchema = std::unique_ptr<StoppingCriterionSchema>(stoppingCriterion);
+        m_selectionSchema = std::unique_ptr<SelectionSchema>(selection);
+        m_initializationSchema = std::unique_ptr<InitializationSchema>(initialization);
+        m_crossoverSchema = std::unique_ptr<CrossoverSchema>(crossover);
+        m_mutationSchema = std::unique_ptr<MutationSchema>(mutation);
+        m_scalingSchema = std::unique_ptr<ScalingSchema>(scaling);
+        m_dispatcher = dispatcher;
+        m_randomNumbersGeneratorReal = genReal;
+    }
+
+    GeneticAlgorithmSteadyState::~GeneticAlgorithmSteadyState() {
+        // the children in flight point to the evaluations and may still be evaluated by the dispatcher
+        cancelPending();
+        if (m_dispatcher != nullptr) { delete m_dispatcher; }
+    }
+
+    void GeneticAlgorithmSteadyState::step() {
+        if (!m_generationStarted) {
+            notify(genStart, &m_populations);
+            m_generationStarted = true;
+        }
+
+        bool generationDone = false;
+        if (m_inFlight > 0) {
+            generationDone = stepAsynchronous();
+        } else {
+            for (size_t populationIndex = 0; populationIndex < m_populations.size(); populationIndex++) {
+                generationDone = breedStep(populationIndex) || generationDone;
+            }
+        }
+
+        if (generationDone) {
+            notify(genDone, &m_populations);
+            m_generationStarted = false;
+        }
+    }
+
+    GeneticAlgorithmSteadyState::ReplacementState &GeneticAlgorithmSteadyState::synchronizeState(
+        size_t populationIndex) {
+        if (m_states.size() < m_populations.size()) {
+            m_states.resize(m_populations.size());
+        }
+        auto population = m_populations[populationIndex].get();
+        auto &state = m_states[populationIndex];
+        if (state.version != population->getVersion() || state.worst.getSize() != population->getSize()) {
+            // the population was changed outside of this algorithm, e.g. initialized or modified by an observer
+            std::vector<double> buffer;
+            state.worst.build(viewFitness(population, buffer));
+            state.version = population->getVersion();
+        }
+        return state;
+    }
+
+    void GeneticAlgorithmSteadyState::breedChildren(Population *population, size_t count,
+                                                    std::vector<std::unique_ptr<Individual>> &children) {
+        const size_t target = children.size() + count;
+        std::array<size_t, 2> parentIndices{};
+        while (children.size() < target) {
+            std::vector<std::unique_ptr<Genome>> childrenGenomes;
+            if (m_selectionSchema->selectIndices(population, parentIndices)) {
+                childrenGenomes = m_crossoverSchema->crossover(
+                    population->getIndividual(parentIndices[0])->getGenome(),
+                    population->getIndividual(parentIndices[1])->getGenome());
+            } else {
+                auto parent1 = std::move(m_selectionSchema->select(population, 1)[0]);
+                auto parent2 = std::move(m_selectionSchema->select(population, 1)[0]);
+                childrenGenomes = m_crossoverSchema->crossover(parent1->getGenome(), parent2->getGenome());
+            }
+
+            for (auto &childGenome: childrenGenomes) {
+                if (children.size() >= target) {
+                    break;
+                }
+                tryToMutate(childGenome.get());
+                auto child = std::unique_ptr<Individual>(population->getIndividual(0)->clone());
+                child->setGenome(childGenome.release());
+                child->invalidatePhenome();
+                children.push_back(std::move(child));
+            }
+        }
+    }
+
+    bool GeneticAlgorithmSteadyState::acceptChild(size_t populationIndex, std::unique_ptr<Individual> child) {
+        auto population = m_populations[populationIndex].get();
+        if (population->getSize() == 0) {
+            return false;
+        }
+        auto &state = synchronizeState(populationIndex);
+        const size_t worst = state.worst.worst();
+        const double fitness = child->getFitness();
+        if (!(fitness < state.worst.getFitness(worst)) && !std::isnan(fitness)) {
+            population->setIndividual(worst, child.release());
+            state.worst.update(worst, fitness);
+        }
+
+        bool generationDone = false;
+        if (++state.bred >= population->getSize()) {
+            state.bred = 0;
+            population->increaseIteration();
+            generationDone = true;
+        }
+        state.version = population->getVersion();
+        return generationDone;
+    }
+
+    bool GeneticAlgorithmSteadyState::breedStep(size_t populationIndex) {
+        auto population = m_populations[populationIndex].get();
+        if (population->getSize() == 0) {
+            return false;
+        }
+        // all children are bred before any of them replaces an individual, so their parents stay valid
+        std::vector<std::unique_ptr<Individual>> children;
+        breedChildren(population, m_offspringPerStep, children);
+
+        bool generationDone = false;
+        for (auto &child: children) {
+            evaluateIndividual(child.get(), &m_evaluation);
+            m_scalingSchema->scale(child.get());
+            generationDone = acceptChild(populationIndex, std::move(child)) || generationDone;
+        }
+        return generationDone;
+    }
+
+    bool GeneticAlgorithmSteadyState::stepAsynchronous() {
+        for (size_t populationIndex = 0; populationIndex < m_populations.size(); populationIndex++) {
+            submitChildren(populationIndex);
+        }
+        if (std::ranges::all_of(m_states, [](const ReplacementState &state) { return state.pending.empty(); })) {
+            return false;
+        }
+
+        std::vector<Individual *> completed;
+        {
+            std::unique_lock lock(m_completedMutex);
+            m_completedReady.wait(lock, [this] { return !m_completed.empty(); });
+            completed.swap(m_completed);
+        }
+
+        // every completed child is integrated even if one failed, otherwise its slot would stay in flight forever
+        bool generationDone = false;
+        std::exception_ptr failure;
+        for (auto evaluated: completed) {
+            for (size_t populationIndex = 0; populationIndex < m_states.size(); populationIndex++) {
+                auto &pending = m_states[populationIndex].pending;
+                auto found = std::ranges::find_if(pending, [evaluated](const PendingChild &entry) {
+                    return entry.child.get() == evaluated;
+                });
+                if (found == pending.end()) {
+                    continue;
+                }
+                auto entry = std::move(*found);
+                pending.erase(found);
+                try {
+                    entry.done.get();
+                    m_scalingSchema->scale(entry.child.get());
+                    generationDone = acceptChild(populationIndex, std::move(entry.child)) || generationDone;
+                } catch (...) {
+                    if (!failure) {
+                        failure = std::current_exception();
+                    }
+                }
+                break;
+            }
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+        return generationDone;
+    }
+
+    void GeneticAlgorithmSteadyState::submitChildren(size_t populationIndex) {
+        auto population = m_populations[populationIndex].get();
+        if (population->getSize() == 0) {
+            return;
+        }
+        auto &state = synchronizeState(populationIndex);
+        if (state.pending.size() >= m_inFlight) {
+            return;
+        }
+        std::vector<std::unique_ptr<Individual>> children;
+        breedChildren(population, m_inFlight - state.pending.size(), children);
+        for (auto &child: children) {
+            auto evaluated = child.get();
+            auto done = m_dispatcher->dispatchAsync(evaluated, &m_evaluation, [this](Individual *individual, bool) {
+                std::lock_guard lock(m_completedMutex);
+                m_completed.push_back(individual);
+                m_completedReady.notify_one();
+            });
+            state.pending.push_back(PendingChild{std::move(child), std::move(done)});
+        }
+    }
+
+    void GeneticAlgorithmSteadyState::cancelPending() {
+        for (auto &state: m_states) {
+            for (auto &entry: state.pending) {
+                entry.done.wait();
+            }
+            state.pending.clear();
+        }
+        std::lock_guard lock(m_completedMutex);
+        m_completed.clear();
+    }
+
+    void GeneticAlgorithmSteadyState::step(int steps) {
+        for (int i = 0; i < steps; i++) {
+            step();
+        }
+    }
+
+    void GeneticAlgorithmSteadyState::evolve() {
+        bool stop = false;
+        while (!stop) {
+            step();
+            for (auto &pop: m_populations) {
+                stop = stop || m_stoppingCriterionSchema->check(pop.get());
+            }
+        }
+    }
+
+    void GeneticAlgorithmSteadyState::initialize() {
+        cancelPending();
+        m_initializationSchema->initialize(&m_populations);
+        for (auto &pop: m_populations) {
+            m_dispatcher->dispatch(pop.get(), &m_evaluation);
+            m_scalingSchema->scale(pop.get());
+        }
+        m_states.clear();
+        m_generationStarted = false;
+    }
+
+    void GeneticAlgorithmSteadyState::addPopulation(Population *population) {
+        m_populations.push_back(std::unique_ptr<Population>(population));
+    }
+
+    void GeneticAlgorithmSteadyState::addEvaluation(Evaluation *evaluation) {
+        cancelPending();
+        m_evaluation.push_back(std::unique_ptr<Evaluation>(evaluation));
+    }
+
+    void GeneticAlgorithmSteadyState::setReplacementSchema(ReplacementSchema *replacementSchema) {
+        throw std::logic_error("GeneticAlgorithmSteadyState always replaces the worst individual");
+    }
+
+    void GeneticAlgorithmSteadyState::setStoppingCriterionSchema(StoppingCriterionSchema *stoppingCriterionSchema) {
+        m_stoppingCriterionSchema = std::unique_ptr<StoppingCriterionSchema>(stoppingCriterionSchema);
+    }
+
+    void GeneticAlgorithmSteadyState::setSelectionSchema(SelectionSchema *selectionSchema) {
+        m_selectionSchema = std::unique_ptr<SelectionSchema>(selectionSchema);
+    }
+
+    void GeneticAlgorithmSteadyState::setInitializationSchema(InitializationSchema *initializationSchema) {
+        m_initializationSchema = std::unique_ptr<InitializationSchema>(initializationSchema);
+    }
+
+    void GeneticAlgorithmSteadyState::setCrossoverSchema(CrossoverSchema *crossoverSchema) {
+        m_crossoverSchema = std::unique_ptr<CrossoverSchema>(crossoverSchema);
+    }
+
+    void GeneticAlgorithmSteadyState::setMutationSchema(MutationSchema *mutationSchema) {
+        m_mutationSchema = std::unique_ptr<MutationSchema>(mutationSchema);
+    }
+
+    void GeneticAlgorithmSteadyState::setScalingSchema(ScalingSchema *scalingSchema) {
+        m_scalingSchema = std::unique_ptr<ScalingSchema>(scalingSchema);
+    }
+
+    void GeneticAlgorithmSteadyState::setDispatcher(Dispatcher *dispatcher) {
+        m_dispatcher = dispatcher;
+    }
+
+    void GeneticAlgorithmSteadyState::setRandomNumbersGenerator(RandomRealFromRange *genReal) {
+        m_randomNumbersGeneratorReal = genReal;
+    }
+
+    void GeneticAlgorithmSteadyState::setMutationChance(double mutationChance) {
+        if (!(mutationChance >= 0.0 && mutationChance <= 1.0)) {
+            throw std::invalid_argument("Mutation chance must be within [0, 1]");
+        }
+        m_mutationChance = mutationChance;
+    }
+
+    double GeneticAlgorithmSteadyState::getMutationChance() const {
+        return m_mutationChance;
+    }
+
+    void GeneticAlgorithmSteadyState::setAsynchronousEvaluation(size_t inFlight) {
+        if (inFlight == 0) {
+            cancelPending();
+        }
+        m_inFlight = inFlight;
+    }
+
+    void GeneticAlgorithmSteadyState::setOffspringPerStep(size_t offspringPerStep) {
+        if (offspringPerStep == 0) {
+            throw std::invalid_argument("Number of offspring per step must be greater than 0");
+        }
+        m_offspringPerStep = offspringPerStep;
+    }
+
+    void GeneticAlgorithmSteadyState::tryToMutate(Genome *object) {
+        if (m_randomNumbersGeneratorReal->generate(0, 1) < m_mutationChance) {
+            m_mutationSchema->mutate(object);
+        }
+    }
+}
@@ -0,0 +1,358 @@
+export module GeneticAlgorithmSteadyState;
+
+export import GeneticAlgorithm;
+export import PublisherPopulation;
+import std;
+import std.compat;
+
+namespace Geneticxx {
+    /**
+     * @class FitnessTournamentTree
+     * @brief Index of the worst individual of a population, updated in O(log n) when one fitness changes.
+     *
+     * A tournament tree over the fitness values: the leaves hold the individuals' indices and every inner node
+     * holds the loser of its two children, so the root is the individual with the lowest fitness. Ties are
+     * broken towards the lower index and NaN is worse than any other value, so the result is deterministic.
+     */
+    export class FitnessTournamentTree {
+    private:
+        /// Fitness of every individual, indexed like the population.
+        std::vector<double> m_Fitness;
+
+        /// Nodes of the tree: node k has children 2k and 2k + 1, the leaves start at index m_Fitness.size().
+        std::vector<size_t> m_Tree;
+
+        /// Returns the worse of two individuals.
+        size_t loser(size_t first, size_t second) const;
+
+    public:
+        /**
+         * @brief Rebuilds the tree for the given fitness values in O(n).
+         *
+         * @param fitness Fitness of every individual, indexed like the population.
+         */
+        void build(std::span<const double> fitness);
+
+        /**
+         * @brief Changes the fitness of one individual and replays its path to the root in O(log n).
+         *
+         * @param index Index of the individual.
+         * @param fitness New fitness of the individual.
+         */
+        void update(size_t index, double fitness);
+
+        /**
+         * @brief Returns the index of the individual with the lowest fitness.
+         *
+         * @throws std::out_of_range If the tree is empty.
+         */
+        size_t worst() const;
+
+        /// Returns the fitness stored for an individual.
+        double getFitness(size_t index) const;
+
+        /// Returns the number of individuals in the tree.
+        size_t getSize() const;
+    };
+
+    /**
+     * @class GeneticAlgorithmSteadyState
+     * @brief A steady-state genetic algorithm, replacing a few individuals per step instead of whole generations.
+     *
+     * Every step breeds `offspringPerStep` children for each population, evaluates and scales them one by one
+     * and lets each child replace the current worst individual of its population unless it is worse. The worst
+     * individual is tracked with a `FitnessTournamentTree`, so a step costs O(offspringPerStep * log n) on top
+     * of the selection, crossover, mutation and evaluation of the children. With a selection that does not
+     * scan the population, such as `SelectorTournament`, no step touches the whole population.
+     *
+     * Once as many children as the population holds have been bred, the population's iteration is increased
+     * and the observers are notified, so stopping criteria and histories count generation equivalents.
+     * The tree is rebuilt whenever the population is changed by anything else, detected with
+     * `Population::getVersion`.
+     *
+     * By default the children are evaluated synchronously by the algorithm itself, and the dispatcher only
+     * evaluates the initial populations. In asynchronous mode, see `setAsynchronousEvaluation`, the children are
+     * submitted to `Dispatcher::dispatchAsync` instead and inserted as soon as their evaluation completes, so
+     * there is no barrier at all: slow evaluations only delay their own child, while the workers keep evaluating
+     * the children bred in the meantime. Higher fitness is better.
+     */
+    export class GeneticAlgorithmSteadyState : public GeneticAlgorithm, public PublisherPopulation {
+    private:
+        /**
+         * @enum event
+         * @brief Represents different stages of the genetic algorithm.
+         */
+        enum event { genDone, genStart, evalDone };
+
+        /// A child submitted to the dispatcher whose evaluation has not been integrated yet.
+        struct PendingChild {
+            /// The child, not accessed by the algorithm until its evaluation completes.
+            std::unique_ptr<Individual> child;
+
+            /// Future returned by `Dispatcher::dispatchAsync` for the child.
+            std::future<void> done;
+        };
+
+        /// Bookkeeping of the steady-state replacement of one population.
+        struct ReplacementState {
+            /// Index of the worst individual of the population.
+            FitnessTournamentTree worst;
+
+            /// Version of the population the tree was last synchronized with.
+            size_t version = 0;
+
+            /// Number of children bred since the population's iteration was last increased.
+            size_t bred = 0;
+
+            /// Children of the population being evaluated in asynchronous mode.
+            std::vector<PendingChild> pending;
+        };
+
+        double m_mutationChance = 0.1;
+
+        /// Number of children bred for every population in one step.
+        size_t m_offspringPerStep = 2;
+
+        /// Number of children of every population evaluated concurrently in asynchronous mode, 0 if disabled.
+        size_t m_inFlight = 0;
+
+        /// Guards m_completed, which is filled by the dispatcher's threads.
+        std::mutex m_completedMutex;
+
+        /// Signalled whenever a child is added to m_completed.
+        std::condition_variable m_completedReady;
+
+        /// Children whose evaluation completed and which are not integrated yet.
+        std::vector<Individual*> m_completed;
+
+        /// Whether the observers were notified of the start of the current generation.
+        bool m_generationStarted = false;
+
+        /// A vector of unique pointers to Population objects representing the evolving populations.
+        std::vector<std::unique_ptr<Population>> m_populations;
+
+        /// Replacement bookkeeping of every entry of m_populations.
+        std::vector<ReplacementState> m_states;
+
+        /// A vector of unique pointers to Evaluation objects responsible for evaluating individuals' fitness.
+        std::vector<std::unique_ptr<Evaluation>> m_evaluation;
+
+        /// A unique pointer to the StoppingCriterionSchema object specifying when the algorithm should terminate.
+        std::unique_ptr<StoppingCriterionSchema> m_stoppingCriterionSchema;
+
+        /// A unique pointer to the SelectionSchema object defining the individual selection method.
+        std::unique_ptr<SelectionSchema> m_selectionSchema;
+
+        /// A unique pointer to the InitializationSchema object defining how the initial population is created.
+        std::unique_ptr<InitializationSchema> m_initializationSchema;
+
+        /// A unique pointer to the CrossoverSchema object defining crossover operations.
+        std::unique_ptr<CrossoverSchema> m_crossoverSchema;
+
+        /// A unique pointer to the MutationSchema object defining mutation operations.
+        std::unique_ptr<MutationSchema> m_mutationSchema;
+
+        /// A unique pointer to the ScalingSchema object responsible for scaling fitness values.
+        std::unique_ptr<ScalingSchema> m_scalingSchema;
+
+        /// A pointer to the Dispatcher object evaluating the initial populations and the asynchronous children.
+        Dispatcher* m_dispatcher;
+
+        /// A pointer to a random number generator for real numbers.
+        RandomRealFromRange* m_randomNumbersGeneratorReal;
+
+        /**
+         * @brief Returns the replacement state of a population, rebuilding its tree if the population changed.
+         *
+         * @param populationIndex Index of the population in m_populations.
+         */
+        ReplacementState& synchronizeState(size_t populationIndex);
+
+        /**
+         * @brief Breeds children from the parents currently in a population.
+         *
+         * @param population Population the parents are selected from.
+         * @param count Number of children to breed.
+         * @param children Vector the children are appended to, with invalidated phenomes.
+         */
+        void breedChildren(Population* population, size_t count, std::vector<std::unique_ptr<Individual>>& children);
+
+        /**
+         * @brief Lets an evaluated and scaled child replace the worst individual of a population unless it is worse.
+         *
+         * @param populationIndex Index of the population in m_populations.
+         * @param child The child.
+         * @return True if the population completed a generation equivalent with this child.
+         */
+        bool acceptChild(size_t populationIndex, std::unique_ptr<Individual> child);
+
+        /**
+         * @brief Breeds m_offspringPerStep children for one population and lets them replace its worst individuals.
+         *
+         * @param populationIndex Index of the population in m_populations.
+         * @return True if the population completed a generation equivalent in this step.
+         */
+        bool breedStep(size_t populationIndex);
+
+        /**
+         * @brief Tops up the children in flight of every population, then integrates those completed so far.
+         *
+         * Waits until at least one child completed, unless no child is in flight.
+         *
+         * @return True if a population completed a generation equivalent in this step.
+         */
+        bool stepAsynchronous();
+
+        /**
+         * @brief Breeds and submits children of one population until m_inFlight of them are being evaluated.
+         *
+         * @param populationIndex Index of the population in m_populations.
+         */
+        void submitChildren(size_t populationIndex);
+
+        /**
+         * @brief Waits for all children in flight and discards them.
+         */
+        void cancelPending();
+
+    public:
+        /**
+         * @brief Constructs a GeneticAlgorithmSteadyState instance.
+         *
+         * Takes the same components as `GeneticAlgorithmSimple` except for the replacement schema, as the
+         * replacement is always done in place.
+         *
+         * @param populations The initial set of populations.
+         * @param evaluation The evaluation strategy for fitness measurement.
+         * @param crossover The crossover operation strategy.
+         * @param mutation The mutation operation strategy.
+         * @param scaling The scaling strategy for fitness values; it has to scale individuals independently.
+         * @param selection The selection method for choosing parents.
+         * @param initialization The initialization strategy for the population.
+         * @param stoppingCriterion The stopping condition for evolution.
+         * @param dispatcher Task manager evaluating the initial populations, and the children in asynchronous mode.
+         * @param genReal Random number generator.
+         * @param offspringPerStep Number of children bred for every population in one step; must be greater than 0.
+         *
+         * @throws std::invalid_argument If offspringPerStep is 0.
+         */
+        GeneticAlgorithmSteadyState(
+            std::vector<std::unique_ptr<Population>>* populations,
+            Evaluation* evaluation,
+            CrossoverSchema* crossover,
+            MutationSchema* mutation,
+            ScalingSchema* scaling,
+            SelectionSchema* selection,
+            InitializationSchema* initialization,
+            StoppingCriterionSchema* stoppingCriterion,
+            Dispatcher* dispatcher,
+            RandomRealFromRange* genReal,
+            size_t offspringPerStep = 2
+        );
+
+        /// Destructor for GeneticAlgorithmSteadyState.
+        ~GeneticAlgorithmSteadyState() override;
+
+        /// Breeds offspringPerStep children for every population, or integrates the completed ones in
+        /// asynchronous mode, and replaces their worst individuals.
+        void step() override;
+
+        /// Executes a given number of steps in the genetic algorithm.
+        /// @param steps The number of steps to execute.
+        void step(int steps) override;
+
+        /// Runs the evolution process until the stopping criterion is met.
+        void evolve() override;
+
+        /// Initializes the genetic algorithm by setting up populations and evaluating the initial state.
+        void initialize() override;
+
+        /// Adds a population to the algorithm.
+        /// @param population The population to add.
+        void addPopulation(Population* population) override;
+
+        /// Adds an evaluation function to the algorithm.
+        /// @param evaluation The evaluation function to add.
+        void addEvaluation(Evaluation* evaluation) override;
+
+        /// @throws std::logic_error The steady-state algorithm always replaces the worst individual.
+        void setReplacementSchema(ReplacementSchema* replacementSchema) override;
+
+        /// Sets the stopping criterion schema.
+        /// @param stoppingCriterionSchema The stopping criterion schema to use.
+        void setStoppingCriterionSchema(StoppingCriterionSchema* stoppingCriterionSchema) override;
+
+        /// Sets the selection schema.
+        /// @param selectionSchema The selection schema to use.
+        void setSelectionSchema(SelectionSchema* selectionSchema) override;
+
+        /// Sets the initialization schema.
+        /// @param initializationSchema The initialization schema to use.
+        void setInitializationSchema(InitializationSchema* initializationSchema) override;
+
+        /// Sets the crossover schema.
+        /// @param crossoverSchema The crossover schema to use.
+        void setCrossoverSchema(CrossoverSchema* crossoverSchema) override;
+
+        /// Sets the mutation schema.
+        /// @param mutationSchema The mutation schema to use.
+        void setMutationSchema(MutationSchema* mutationSchema) override;
+
+        /// Sets the scaling schema.
+        /// @param scalingSchema The scaling schema to use.
+        void setScalingSchema(ScalingSchema* scalingSchema) override;
+
+        /// Sets the dispatcher responsible for evaluating the initial populations and the asynchronous children.
+        /// @param dispatcher The dispatcher to use.
+        void setDispatcher(Dispatcher* dispatcher) override;
+
+        /// Sets the random number generator for real numbers.
+        /// @param genReal The random number generator to use.
+        void setRandomNumbersGenerator(RandomRealFromRange* genReal) override;
+
+        /**
+         * @brief Sets the probability of mutating a child.
+         *
+         * Mutations that apply their own probability to every gene, such as the per-gene mode of
+         * `Mutator1DPointBitFlip`, are meant to be used with a chance of 1.
+         *
+         * @param mutationChance Probability within [0, 1]; 0.1 by default.
+         *
+         * @throws std::invalid_argument If the probability is not within [0, 1].
+         */
+        void setMutationChance(double mutationChance);
+
+        /// Returns the probability of mutating a child.
+        double getMutationChance() const;
+
+        /**
+         * @brief Enables or disables the asynchronous evaluation of the children.
+         *
+         * When enabled, every step breeds new children until `inFlight` children of each population are submitted
+         * to `Dispatcher::dispatchAsync`, then waits until at least one of them completes and integrates all
+         * completed children, each replacing the current worst individual unless it is worse. Parents are always
+         * selected from the current population, so the evolution never waits for a whole generation. Use a
+         * dispatcher with worker threads, such as `DispatcherThreadPool`; with the default `dispatchAsync` the
+         * children are evaluated synchronously while being submitted.
+         *
+         * The order in which children complete depends on the evaluation times, so runs are not reproducible.
+         * The number of offspring per step is not used in this mode.
+         *
+         * @param inFlight Number of children of every population evaluated concurrently, 0 to disable.
+         */
+        void setAsynchronousEvaluation(size_t inFlight);
+
+        /**
+         * @brief Sets the number of children bred for every population in one step.
+         *
+         * @param offspringPerStep Number of children; must be greater than 0.
+         *
+         * @throws std::invalid_argument If offspringPerStep is 0.
+         */
+        void setOffspringPerStep(size_t offspringPerStep);
+
+        /// Attempts to mutate a given genome based on a predefined mutation probability.
+        /// @param object The genome to mutate.
+        void tryToMutate(Genome* object);
+    };
+}
@@ -5,47 +5,90 @@ namespace Geneticxx {
     GenomeBitVector::GenomeBitVector() {
     }
 
-    GenomeBitVector::GenomeBitVector(const GenomeBitVector &other) : m_Bits{other.m_Bits} {
+    GenomeBitVector::GenomeBitVector(size_t size)
+        : m_Words((size + BitsPerWord - 1) / BitsPerWord, 0), m_Size{size} {
+    }
+
+    GenomeBitVector::GenomeBitVector(const std::vector<bool> &bits) : m_Words{pack(bits)}, m_Size{bits.size()} {
+    }
+
+    GenomeBitVector::GenomeBitVector(const GenomeBitVector &other)
+        : m_Words{other.m_Words}, m_Size{other.m_Size}, m_Dirty{other.m_Dirty} {
     }
 
     GenomeBitVector::GenomeBitVector(GenomeBitVector &&other) noexcept
-        : m_Bits{std::move(other.m_Bits)} {
+        : m_Words{std::move(other.m_Words)}, m_Size{other.m_Size}, m_Dirty{other.m_Dirty} {
+        other.m_Size = 0;
     }
 
     GenomeBitVector& GenomeBitVector::operator=(const GenomeBitVector &other) {
         if (this != &other) {
-            m_Bits = other.m_Bits;
+            m_Words = other.m_Words;
+            m_Size = other.m_Size;
+            m_Dirty.markAll();
         }
         return *this;
     }
 
     GenomeBitVector& GenomeBitVector::operator=(GenomeBitVector &&other) noexcept {
         if (this != &other) {
-            m_Bits = std::move(other.m_Bits);
+            m_Words = std::move(other.m_Words);
+            m_Size = other.m_Size;
+            other.m_Size = 0;
+            m_Dirty.markAll();
         }
         return *this;
     }
 
     GenomeBitVector::~GenomeBitVector() = default;
 
-    std::vector<bool> GenomeBitVector::toGray(const std::vector<bool> &binary) {
-        std::vector<bool> gray(binary.size());
-        if (!binary.empty()) {
-            gray[0] = binary[0];
-            for (size_t i = 1; i < binary.size(); ++i)
-                gray[i] = binary[i - 1] ^ binary[i]; // operator XOR
+    void GenomeBitVector::toGray(std::span<std::uint64_t> words) {
+        // gray[i] = binary[i - 1] ^ binary[i], the previous bit of the first bit of a word is the last bit of the previous word
+        std::uint64_t carry = 0;
+        for (auto &word: words) {
+            const std::uint64_t last = word >> (BitsPerWord - 1);
+            word ^= (word << 1) | carry;
+            carry = last;
         }
-        return gray;
     }
 
-    std::vector<bool> GenomeBitVector::fromGray(const std::vector<bool> &gray) {
-        std::vector<bool> binary(gray.size());
-        if (!gray.empty()) {
-            binary[0] = gray[0];
-            for (size_t i = 1; i < gray.size(); ++i)
-                binary[i] = binary[i - 1] ^ gray[i]; // operator XOR
+    void GenomeBitVector::fromGray(std::span<std::uint64_t> words) {
+        // binary[i] is the XOR of gray[0..i], computed as a prefix XOR within each word and carried between words
+        std::uint64_t carry = 0;
+        for (auto &word: words) {
+            word ^= word << 1;
+            word ^= word << 2;
+            word ^= word << 4;
+            word ^= word << 8;
+            word ^= word << 16;
+            word ^= word << 32;
+            word ^= carry;
+            carry = std::uint64_t{0} - (word >> (BitsPerWord - 1));
+        }
+    }
+
+    std::vector<std::uint64_t> GenomeBitVector::pack(const std::vector<bool> &bits) {
+        std::vector<std::uint64_t> words((bits.size() + BitsPerWord - 1) / BitsPerWord, 0);
+        for (size_t i = 0; i < bits.size(); ++i) {
+            if (bits[i]) {
+                words[i / BitsPerWord] |= std::uint64_t{1} << (i % BitsPerWord);
+            }
+        }
+        return words;
+    }
+
+    std::vector<bool> GenomeBitVector::unpack(std::span<const std::uint64_t> words, size_t size) {
+        std::vector<bool> bits(size);
+        for (size_t i = 0; i < size; ++i) {
+            bits[i] = (words[i / BitsPerWord] >> (i % BitsPerWord)) & 1;
+        }
+        return bits;
+    }
+
+    void GenomeBitVector::clearPadding() {
+        if (!m_Words.empty()) {
+            m_Words.back() &= lowBits(m_Size - (m_Words.size() - 1) * BitsPerWord);
         }
-        return binary;
     }
 
     std::unique_ptr<Genome> GenomeBitVector::createNew() const {
@@ -53,66 +96,210 @@ namespace Geneticxx {
     }
 
     std::unique_ptr<Genome> GenomeBitVector::clone() const {
-        auto clone = new GenomeBitVector();
-        clone->m_Bits = this->m_Bits;
-        return std::unique_ptr<GenomeBitVector>(clone);
+        return std::make_unique<GenomeBitVector>(*this);
     }
 
     double GenomeBitVector::distance(Genome *otherBase) const {
-        auto other = dynamic_cast<Genome1D *>(otherBase); //TODO throw on incorrect types
-        double bitStringDistance = 0;
-        if (this->m_Bits.size() == other->getSize()) {
-            for (size_t i = 0; i < this->m_Bits.size(); i++) {
-                if (std::any_cast<bool>(other->getValue(i)) > std::any_cast<bool>(this->getValue(i))) {
-                    bitStringDistance += (std::any_cast<bool>(other->getValue(i)) - std::any_cast<
-                        bool>(this->getValue(i))) / std::any_cast<bool>(other->getValue(i));
-                }
-                else {
-                    bitStringDistance += (std::any_cast<bool>(this->getValue(i)) - std::any_cast<
-                        bool>(other->getValue(i))) / std::any_cast<bool>(this->getValue(i));
-                }
+        if (otherBase->getSize() != m_Size) {
+            return 1;
+        }
+        if (m_Size == 0) {
+            return 0;
+        }
+        if (auto bits = asGenomeBits(otherBase)) {
+            auto otherWords = bits->getWords();
+            size_t differing = 0;
+            for (size_t i = 0; i < m_Words.size(); ++i) {
+                differing += std::popcount(m_Words[i] ^ otherWords[i]);
             }
-            bitStringDistance /= this->m_Bits.size();
+            return static_cast<double>(differing) / m_Size;
         }
-        else {
-            bitStringDistance = 1;
+        auto other = dynamic_cast<Genome1D *>(otherBase); //TODO throw on incorrect types
+        size_t differing = 0;
+        for (size_t i = 0; i < m_Size; i++) {
+            if (std::any_cast<bool>(other->getValue(i)) != std::any_cast<bool>(this->getValue(i))) {
+                ++differing;
+            }
         }
-        return bitStringDistance;
+        return static_cast<double>(differing) / m_Size;
     }
 
     std::any GenomeBitVector::getValue(size_t position) const {
-        if (position >= this->m_Bits.size()) {
+        if (position >= m_Size) {
             return false;
         }
-        return this->m_Bits[position];
+        return static_cast<bool>((m_Words[position / BitsPerWord] >> (position % BitsPerWord)) & 1);
     }
 
     void GenomeBitVector::setValue(size_t position, std::any value) {
-        m_Bits[position] = std::any_cast<bool>(value);
+        if (position >= m_Size) {
+            throw std::out_of_range("GenomeBitVector::setValue position out of range");
+        }
+        const std::uint64_t bit = std::uint64_t{1} << (position % BitsPerWord);
+        if (std::any_cast<bool>(value)) {
+            m_Words[position / BitsPerWord] |= bit;
+        } else {
+            m_Words[position / BitsPerWord] &= ~bit;
+        }
+        m_Dirty.mark(position, position + 1);
+    }
+
+    bool GenomeBitVector::assign(const Genome *other) {
+        auto bits = asGenomeBits(other);
+        if (bits == nullptr) {
+            return false;
+        }
+        if (other != this) {
+            auto words = bits->getWords();
+            m_Words.assign(words.begin(), words.end());
+            m_Size = other->getSize();
+            m_Dirty.markAll();
+        }
+        return true;
+    }
+
+    std::optional<std::size_t> GenomeBitVector::hash() const {
+        return hashValues(getWords()) ^ std::hash<size_t>{}(m_Size);
+    }
+
+    bool GenomeBitVector::serialize(std::vector<std::byte> &buffer) const {
+        const std::uint64_t size = m_Size;
+        const auto header = std::as_bytes(std::span(&size, 1));
+        const auto words = std::as_bytes(std::span(m_Words));
+        buffer.insert(buffer.end(), header.begin(), header.end());
+        buffer.insert(buffer.end(), words.begin(), words.end());
+        return true;
+    }
+
+    bool GenomeBitVector::deserialize(std::span<const std::byte> bytes) {
+        std::uint64_t size;
+        if (bytes.size() < sizeof(size)) {
+            return false;
+        }
+        std::memcpy(&size, bytes.data(), sizeof(size));
+        const std::uint64_t words = size / BitsPerWord + (size % BitsPerWord != 0);
+        if (bytes.size() - sizeof(size) != words * sizeof(std::uint64_t)) {
+            return false;
+        }
+        m_Words.resize(words);
+        if (words > 0) {
+            std::memcpy(m_Words.data(), bytes.data() + sizeof(size), words * sizeof(std::uint64_t));
+        }
+        m_Size = size;
+        clearPadding();
+        m_Dirty.markAll();
+        return true;
+    }
+
+    std::span<const std::uint64_t> GenomeBitVector::getWords() const {
+        return m_Words;
+    }
+
+    std::span<std::uint64_t> GenomeBitVector::getWords() {
+        return m_Words;
+    }
+
+    size_t GenomeBitVector::countOnes() const {
+        size_t count = 0;
+        for (const auto word: m_Words) {
+            count += std::popcount(word);
+        }
+        return count;
+    }
+
+    size_t GenomeBitVector::hammingDistance(const GenomeBitVector &other) const {
+        if (other.m_Size != m_Size) {
+            throw std::invalid_argument("Genomes must have the same size");
+        }
+        size_t count = 0;
+        for (size_t i = 0; i < m_Words.size(); ++i) {
+            count += std::popcount(m_Words[i] ^ other.m_Words[i]);
+        }
+        return count;
+    }
+
+    void GenomeBitVector::flipMasked(std::span<const std::uint64_t> mask) {
+        const size_t words = std::min(mask.size(), m_Words.size());
+        size_t first = words;
+        size_t last = 0;
+        for (size_t i = 0; i < words; ++i) {
+            if (mask[i] != 0) {
+                m_Words[i] ^= mask[i];
+                first = std::min(first, i);
+                last = i + 1;
+            }
+        }
+        clearPadding();
+        if (first < last) {
+            m_Dirty.mark(first * BitsPerWord, std::min(last * BitsPerWord, m_Size));
+        }
+    }
+
+    void GenomeBitVector::blendMasked(const GenomeBitVector &donor, std::span<const std::uint64_t> mask) {
+        if (donor.m_Size != m_Size) {
+            throw std::invalid_argument("Genomes must have the same size");
+        }
+        const size_t words = std::min(mask.size(), m_Words.size());
+        size_t first = words;
+        size_t last = 0;
+        for (size_t i = 0; i < words; ++i) {
+            const std::uint64_t blended = (m_Words[i] & ~mask[i]) | (donor.m_Words[i] & mask[i]);
+            if (blended != m_Words[i]) {
+                m_Words[i] = blended;
+                first = std::min(first, i);
+                last = i + 1;
+            }
+        }
+        if (first < last) {
+            m_Dirty.mark(first * BitsPerWord, std::min(last * BitsPerWord, m_Size));
+        }
+    }
+
+    void GenomeBitVector::markDirty(size_t begin, size_t end) {
+        m_Dirty.mark(begin, end);
+    }
+
+    std::pair<size_t, size_t> GenomeBitVector::getDirtyRange() const {
+        return m_Dirty.get(m_Size);
+    }
+
+    void GenomeBitVector::clearDirty() {
+        m_Dirty.clear();
     }
 
     size_t GenomeBitVector::getSize() const {
-        return m_Bits.size();
+        return m_Size;
     }
 
     bool GenomeBitVector::operator==(Genome *otherBase) const {
+        if (otherBase->getSize() != m_Size) {
+            return false;
+        }
+        if (auto bits = asGenomeBits(otherBase)) {
+            // padding bits are always zero, so whole words can be compared
+            return m_Words.empty() ||
+                   std::memcmp(m_Words.data(), bits->getWords().data(), m_Words.size() * sizeof(std::uint64_t)) == 0;
+        }
         auto other = dynamic_cast<Genome1D *>(otherBase);
-        if (this->m_Bits.size() == other->getSize()) {
-            for (size_t i = 0; i < this->m_Bits.size(); i++) {
-                if (std::any_cast<bool>(other->getValue(i)) != std::any_cast<bool>(this->getValue(i))) {
-                    return false;
-                }
+        for (size_t i = 0; i < m_Size; i++) {
+            if (std::any_cast<bool>(other->getValue(i)) != std::any_cast<bool>(this->getValue(i))) {
+                return false;
             }
-            return true;
         }
-        return false;
+        return true;
     }
 
     void GenomeBitVector::setGrayRepresentation(const std::vector<bool> &grayBits) {
-        m_Bits = fromGray(grayBits);
+        m_Words = pack(grayBits);
+        m_Size = grayBits.size();
+        fromGray(m_Words);
+        clearPadding();
+        m_Dirty.markAll();
     }
 
     std::vector<bool> GenomeBitVector::getGrayRepresentation() const {
-        return toGray(m_Bits);
+        auto gray = m_Words;
+        toGray(gray);
+        return unpack(gray, m_Size);
     }
 }
@@ -12,29 +12,54 @@ namespace Geneticxx {
      *
      * This class provides functionalities to create, manipulate, and compare genome bit vectors.
      * It also includes methods for cloning, copying, moving, and calculating the similarity between genomes.
+     * The bits are packed into 64-bit words exposed through `GenomeBitsView`, so comparisons, Gray coding and
+     * the built-in operators process 64 bits at a time.
      */
-    export class GenomeBitVector : public Genome1D {
+    export class GenomeBitVector : public Genome1D, public GenomeBitsView {
     private:
         /**
          * @brief Stores the binary representation of the genome.
          *
-         * A vector of booleans where each element represents a bit (true = 1, false = 0) of the genome.
+         * Bit `i` of the genome is bit `i % 64` of word `i / 64`; the bits of the last word past `m_Size` are zero.
          */
-        std::vector<bool> m_Bits{};
+        std::vector<std::uint64_t> m_Words{};
 
         /**
-         * @brief Converts a binary sequence to its Gray code representation.
-         * @param binary The binary sequence to convert.
-         * @return The Gray code representation of the binary sequence.
+         * @brief Number of bits in the genome.
          */
-        static std::vector<bool> toGray(const std::vector<bool> &binary);
+        size_t m_Size = 0;
 
         /**
-         * @brief Converts a Gray code sequence back to binary.
-         * @param gray The Gray code sequence to convert.
-         * @return The binary representation of the Gray code sequence.
+         * @brief Bits modified since the phenome was last decoded from this genome.
          */
-        static std::vector<bool> fromGray(const std::vector<bool> &gray);
+        GenomeDirtyRange m_Dirty{};
+
+        /**
+         * @brief Converts packed binary words to their Gray code representation in place.
+         * @param words The binary words to convert; the padding bits of the last word are left to the caller.
+         */
+        static void toGray(std::span<std::uint64_t> words);
+
+        /**
+         * @brief Converts packed Gray code words back to binary in place.
+         * @param words The Gray code words to convert; the padding bits of the last word are left to the caller.
+         */
+        static void fromGray(std::span<std::uint64_t> words);
+
+        /**
+         * @brief Packs a sequence of bits into words.
+         */
+        static std::vector<std::uint64_t> pack(const std::vector<bool> &bits);
+
+        /**
+         * @brief Unpacks the first `size` bits of the words.
+         */
+        static std::vector<bool> unpack(std::span<const std::uint64_t> words, size_t size);
+
+        /**
+         * @brief Zeroes the bits of the last word past the end of the genome.
+         */
+        void clearPadding();
 
     public:
         /**
@@ -44,6 +69,22 @@ namespace Geneticxx {
          */
         GenomeBitVector();
 
+        /**
+         * @brief Constructor with specified size.
+         *
+         * Initializes the genome with `size` bits set to zero.
+         *
+         * @param size The number of bits in the genome.
+         */
+        explicit GenomeBitVector(size_t size);
+
+        /**
+         * @brief Constructor with specified data.
+         *
+         * @param bits The bits of the genome.
+         */
+        explicit GenomeBitVector(const std::vector<bool> &bits);
+
         /**
          * @brief Copy constructor.
          *
@@ -108,7 +149,7 @@ namespace Geneticxx {
          * The similarity is based on the number of differing bits between the two genomes.
          *
          * @param other The genome to compare with.
-         * @return A value representing the similarity between the two genomes, where 0 means identical.
+         * @return The fraction of differing bits, where 0 means identical; 1 for genomes of different sizes.
          */
         double distance(Genome *otherBase) const override;
 
@@ -132,6 +173,105 @@ namespace Geneticxx {
          */
         void setValue(size_t position, std::any value) override;
 
+        /**
+         * @brief Copies the bits of another genome exposing `GenomeBitsView`, reusing the existing storage.
+         *
+         * @param other The genome to copy from.
+         * @return True if the bits were copied, false if `other` does not expose packed bits.
+         */
+        bool assign(const Genome *other) override;
+
+        /**
+         * @brief Returns a hash of the bits.
+         *
+         * @return Hash of the bit vector.
+         */
+        std::optional<std::size_t> hash() const override;
+
+        /**
+         * @brief Appends the number of bits followed by the packed words.
+         *
+         * @param buffer Buffer the serialized genome is appended to.
+         * @return True.
+         */
+        bool serialize(std::vector<std::byte> &buffer) const override;
+
+        /**
+         * @brief Reads bits written by `serialize`, reusing the existing storage.
+         *
+         * @param bytes Bytes written by `serialize` of a `GenomeBitVector`.
+         * @return True if the bits were read, false for malformed bytes.
+         */
+        bool deserialize(std::span<const std::byte> bytes) override;
+
+        /**
+         * @brief Returns a read-only view of the packed words.
+         *
+         * @return Span over the words.
+         */
+        std::span<const std::uint64_t> getWords() const override;
+
+        /**
+         * @brief Returns a mutable view of the packed words.
+         *
+         * @return Span over the words.
+         */
+        std::span<std::uint64_t> getWords() override;
+
+        /**
+         * @brief Counts the bits set to one.
+         *
+         * @return The number of set bits.
+         */
+        size_t countOnes() const;
+
+        /**
+         * @brief Counts the bits differing from another genome of the same size.
+         *
+         * @param other The genome to compare with.
+         * @return The Hamming distance between the genomes.
+         * @throws std::invalid_argument If the genomes differ in size.
+         */
+        size_t hammingDistance(const GenomeBitVector &other) const;
+
+        /**
+         * @brief Flips every bit set in the mask, one word of the mask per word of the genome.
+         *
+         * Bits of the mask past the end of the genome are ignored.
+         *
+         * @param mask The words selecting the bits to flip; missing trailing words flip nothing.
+         */
+        void flipMasked(std::span<const std::uint64_t> mask);
+
+        /**
+         * @brief Replaces the bits selected by the mask with the bits of a donor of the same size.
+         *
+         * @param donor The genome providing the bits.
+         * @param mask The words selecting the bits to take from the donor; missing trailing words take nothing.
+         * @throws std::invalid_argument If the genomes differ in size.
+         */
+        void blendMasked(const GenomeBitVector &donor, std::span<const std::uint64_t> mask);
+
+        /**
+         * @brief Marks the bits in [begin, end) as modified.
+         *
+         * @param begin Index of the first modified bit.
+         * @param end Index one past the last modified bit.
+         */
+        void markDirty(size_t begin, size_t end) override;
+
+        /**
+         * @brief Returns the range of bits modified since the last call to `clearDirty`.
+         *
+         * @return Pair [begin, end) of bit indices.
+         */
+        std::pair<size_t, size_t> getDirtyRange() const override;
+
+        /**
+         * @brief Marks all bits as unmodified.
+         */
+        void clearDirty() override;
+
         /**
          * @brief Returns the size of the genome (number of bits).
          *
@@ -142,7 +282,8 @@ namespace Geneticxx {
         /**
          * @brief Compares two genomes for equality.
          *
-         * This method checks if two genomes are identical based on their binary representation.
+         * This method checks if two genomes are identical based on their binary representation, comparing
+         * whole words when the other genome exposes `GenomeBitsView`.
          *
          * @param other The genome to compare with.
          * @return True if the genomes are identical, false otherwise.
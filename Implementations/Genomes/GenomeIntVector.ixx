@@ -11,16 +11,24 @@ namespace Geneticxx {
      *
      * This class provides functionalities to create, manipulate, and compare genomes represented by integer vectors.
      * It includes methods for cloning, copying, moving, and calculating the similarity between genomes.
+     * The genes are stored contiguously and exposed through `Genome1DView<T>`, which operators use instead of
+     * the `std::any` based accessors.
      */
     export template <typename T>
-    class GenomeVector : public Genome1D {
+    class GenomeVector : public Genome1D, public Genome1DView<T> {
     private:
         /**
          * @brief The data representing the genome, stored as a vector of integers.
          *
-         * Each integer in the vector represents a component of the genome.
+         * Each integer in the vector represents a component of the genome. Boolean genes are stored one per byte.
+         * The genes are allocated from the object resource current when the genome is constructed.
          */
-        std::vector<T> data{};
+        std::pmr::vector<GeneStorage<T>> data = std::pmr::vector<GeneStorage<T>>(getObjectResource());
+
+        /**
+         * @brief Genes modified since the phenome was last decoded from this genome.
+         */
+        GenomeDirtyRange m_Dirty{};
 
     public:
         /**
@@ -54,10 +62,7 @@ namespace Geneticxx {
          */
         GenomeVector(std::vector<T> data)
         {
-            //size_t i = data.size();
-            //i++;
-            //this->data.resize(data.size());
-            this->data = data;
+            this->data.assign(data.begin(), data.end());
         }
 
         /**
@@ -67,7 +72,7 @@ namespace Geneticxx {
          *
          * @param other The genome to copy.
          */
-        GenomeVector(const GenomeVector& other) : data{other.data}
+        GenomeVector(const GenomeVector& other) : data(other.data, getObjectResource()), m_Dirty{other.m_Dirty}
         {
             
         }
@@ -79,7 +84,7 @@ namespace Geneticxx {
          *
          * @param other The genome to move.
          */
-        GenomeVector(GenomeVector&& other) noexcept : data{std::move(other.data)}
+        GenomeVector(GenomeVector&& other) noexcept : data{std::move(other.data)}, m_Dirty{other.m_Dirty}
         {
             
         }
@@ -96,6 +101,7 @@ namespace Geneticxx {
         {
             if (this != &other) {
                 data = other.data;
+                m_Dirty.markAll();
             }
             return *this;
         }
@@ -112,6 +118,7 @@ namespace Geneticxx {
         {
             if (this != &other) {
                 data = std::move(other.data);
+                m_Dirty.markAll();
             }
             return *this;
         }
@@ -144,6 +151,7 @@ namespace Geneticxx {
         {
             auto clone = new GenomeVector();
             clone->data = this->data;
+            clone->m_Dirty = this->m_Dirty;
             return std::unique_ptr<GenomeVector>(clone);
         }
 
@@ -186,7 +194,7 @@ namespace Geneticxx {
          */
         std::any getValue(size_t position) const override
         {
-            return this->data[position];
+            return static_cast<T>(this->data[position]);
         }
 
         /**
@@ -200,6 +208,137 @@ namespace Geneticxx {
         void setValue(size_t position, std::any value) override
         {
             this->data.at(position) = std::any_cast<T>(value);
+            m_Dirty.mark(position, position + 1);
+        }
+
+        /**
+         * @brief Returns a read-only view of all genes.
+         *
+         * @return Span over the genes.
+         */
+        std::span<const GeneStorage<T>> getValues() const override
+        {
+            return this->data;
+        }
+
+        /**
+         * @brief Returns a mutable view of all genes.
+         *
+         * @return Span over the genes.
+         */
+        std::span<GeneStorage<T>> getValues() override
+        {
+            return this->data;
+        }
+
+        /**
+         * @brief Copies the genes of another genome exposing a view of the same type.
+         *
+         * The existing buffer is reused, so no allocation happens when both genomes have the same size.
+         *
+         * @param other The genome to copy from.
+         * @return True if the genes were copied, false if `other` does not expose `Genome1DView<T>`.
+         */
+        bool assign(const Genome *other) override
+        {
+            if (other == this) {
+                return true;
+            }
+            if (auto typed = asGenomeView<T>(other)) {
+                auto values = typed->getValues();
+                this->data.assign(values.begin(), values.end());
+                m_Dirty.markAll();
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Returns a hash of the genes.
+         *
+         * @return Hash combining the hashes of all genes.
+         */
+        std::optional<std::size_t> hash() const override
+        {
+            return hashValues(getValues());
+        }
+
+        /**
+         * @brief Appends the number of genes followed by their raw bytes.
+         *
+         * @param buffer Buffer the serialized genome is appended to.
+         * @return True for trivially copyable gene types, false otherwise.
+         */
+        bool serialize(std::vector<std::byte> &buffer) const override
+        {
+            if constexpr (std::is_trivially_copyable_v<GeneStorage<T>>) {
+                const std::uint64_t size = this->data.size();
+                const auto header = std::as_bytes(std::span(&size, 1));
+                const auto genes = std::as_bytes(std::span(this->data));
+                buffer.insert(buffer.end(), header.begin(), header.end());
+                buffer.insert(buffer.end(), genes.begin(), genes.end());
+                return true;
+            } else {
+                return false;
+            }
+        }
+
+        /**
+         * @brief Reads genes written by `serialize`, reusing the existing buffer.
+         *
+         * @param bytes Bytes written by `serialize` of a `GenomeVector<T>`.
+         * @return True if the genes were read, false for other gene types or malformed bytes.
+         */
+        bool deserialize(std::span<const std::byte> bytes) override
+        {
+            if constexpr (std::is_trivially_copyable_v<GeneStorage<T>>) {
+                std::uint64_t size;
+                if (bytes.size() < sizeof(size)) {
+                    return false;
+                }
+                std::memcpy(&size, bytes.data(), sizeof(size));
+                if (size > (bytes.size() - sizeof(size)) / sizeof(GeneStorage<T>) ||
+                    bytes.size() - sizeof(size) != size * sizeof(GeneStorage<T>)) {
+                    return false;
+                }
+                this->data.resize(size);
+                if (size > 0) {
+                    std::memcpy(this->data.data(), bytes.data() + sizeof(size), size * sizeof(GeneStorage<T>));
+                }
+                m_Dirty.markAll();
+                return true;
+            } else {
+                return false;
+            }
+        }
+
+        /**
+         * @brief Marks the genes in [begin, end) as modified.
+         *
+         * @param begin Index of the first modified gene.
+         * @param end Index one past the last modified gene.
+         */
+        void markDirty(size_t begin, size_t end) override
+        {
+            m_Dirty.mark(begin, end);
+        }
+
+        /**
+         * @brief Returns the range of genes modified since the last call to `clearDirty`.
+         *
+         * @return Pair [begin, end) of gene indices.
+         */
+        std::pair<size_t, size_t> getDirtyRange() const override
+        {
+            return m_Dirty.get(this->data.size());
+        }
+
+        /**
+         * @brief Marks all genes as unmodified.
+         */
+        void clearDirty() override
+        {
+            m_Dirty.clear();
         }
 
         /**
@@ -222,6 +361,9 @@ namespace Geneticxx {
          */
         bool operator==(Genome *otherBase) const override
         {
+            if (auto typed = dynamic_cast<const Genome1DView<T> *>(otherBase)) {
+                return std::ranges::equal(this->data, typed->getValues());
+            }
             auto other = dynamic_cast<Genome1D *>(otherBase);
             if (this->data.size() == other->getSize()) {
                 for (size_t i = 0; i < this->data.size(); i++) {
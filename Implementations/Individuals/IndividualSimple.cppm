@@ -14,7 +14,9 @@ namespace Geneticxx {
     IndividualSimple::IndividualSimple(const IndividualSimple& individual) : m_Fitness{individual.m_Fitness},
                                                                              m_ObjectiveScore{
                                                                                  individual.m_ObjectiveScore
-                                                                             } {
+                                                                             },
+                                                                             m_PhenomeStale{individual.m_PhenomeStale},
+                                                                             m_PhenomeSynced{individual.m_PhenomeSynced} {
         if (individual.m_Genome) {
             m_Genome = std::unique_ptr<Genome>(individual.m_Genome->clone());
         }
@@ -32,7 +34,9 @@ namespace Geneticxx {
     IndividualSimple::IndividualSimple(IndividualSimple&& individual) : m_Fitness{individual.m_Fitness},
                                                                         m_ObjectiveScore{individual.m_ObjectiveScore},
                                                                         m_Genome{std::move(individual.m_Genome)},
-                                                                        m_Phenome{std::move(individual.m_Phenome)} {
+                                                                        m_Phenome{std::move(individual.m_Phenome)},
+                                                                        m_PhenomeStale{individual.m_PhenomeStale},
+                                                                        m_PhenomeSynced{individual.m_PhenomeSynced} {
         individual.m_Fitness = 0.0;
         individual.m_ObjectiveScore = {0};
     }
@@ -41,6 +45,8 @@ namespace Geneticxx {
         if (this != &individual) {
             m_Fitness = individual.m_Fitness;
             m_ObjectiveScore = individual.m_ObjectiveScore;
+            m_PhenomeStale = individual.m_PhenomeStale;
+            m_PhenomeSynced = individual.m_PhenomeSynced;
 
             if (individual.m_Genome) {
                 m_Genome = std::unique_ptr<Genome>(individual.m_Genome->clone());
@@ -62,6 +68,8 @@ namespace Geneticxx {
         if (this != &individual) {
             m_Fitness = individual.m_Fitness;
             m_ObjectiveScore = individual.m_ObjectiveScore;
+            m_PhenomeStale = individual.m_PhenomeStale;
+            m_PhenomeSynced = individual.m_PhenomeSynced;
             m_Genome = std::move(individual.m_Genome);
             m_Phenome = std::move(individual.m_Phenome);
             individual.m_Fitness = 0.0;
@@ -80,6 +88,8 @@ namespace Geneticxx {
         auto cloned = new IndividualSimple();
         cloned->m_Fitness = this->m_Fitness;
         cloned->m_ObjectiveScore = this->m_ObjectiveScore;
+        cloned->m_PhenomeStale = this->m_PhenomeStale;
+        cloned->m_PhenomeSynced = this->m_PhenomeSynced;
 
         // Cloning genotype and phenome
         cloned->m_Genome = std::unique_ptr<Genome>(this->m_Genome->clone());
@@ -109,9 +119,26 @@ namespace Geneticxx {
     }
 
     void IndividualSimple::updatePhenome() {
-        if (m_Genome && m_Phenome) {
+        decodePhenome();
+    }
+
+    void IndividualSimple::invalidatePhenome() {
+        m_PhenomeStale = true;
+    }
+
+    void IndividualSimple::decodePhenome() const {
+        m_PhenomeStale = false;
+        if (!m_Genome || !m_Phenome) {
+            return;
+        }
+        if (!m_PhenomeSynced) {
             m_Phenome->updatePhenome(m_Genome.get());
         }
+        else if (auto [begin, end] = m_Genome->getDirtyRange(); begin < end) {
+            m_Phenome->updatePhenomeRange(m_Genome.get(), begin, end);
+        }
+        m_Genome->clearDirty();
+        m_PhenomeSynced = true;
     }
 
     // Const getter for Genome
@@ -131,10 +158,14 @@ namespace Geneticxx {
     void IndividualSimple::setGenome(Genome* genome) {
         // Przeniesienie własności do unique_ptr m_Genome
         m_Genome = std::unique_ptr<Genome>(genome);
+        m_PhenomeSynced = false;
     }
 
     // Getter for Phenome
     Phenome* IndividualSimple::getPhenome() const {
+        if (m_PhenomeStale) {
+            decodePhenome();
+        }
         return this->m_Phenome.get();
     }
 
@@ -145,5 +176,6 @@ namespace Geneticxx {
 
     void IndividualSimple::setPhenome(Phenome* phenome) {
         m_Phenome = std::unique_ptr<Phenome>(phenome);
+        m_PhenomeSynced = false;
     }
 }
@@ -41,6 +41,23 @@ namespace Geneticxx {
          */
         std::unique_ptr<Phenome> m_Phenome{};
 
+        /**
+         * @brief True if the phenome was invalidated and has to be decoded before it is read.
+         */
+        mutable bool m_PhenomeStale = false;
+
+        /**
+         * @brief True if the phenome was decoded from the current genome, so that only its modified genes need decoding.
+         *
+         * Reset whenever the genome or the phenome is replaced.
+         */
+        mutable bool m_PhenomeSynced = false;
+
+        /**
+         * @brief Decodes the phenome from the genome, limited to the modified genes once they are in sync.
+         */
+        void decodePhenome() const;
+
     public:
         /**
          * @brief Default constructor.
@@ -161,10 +178,16 @@ namespace Geneticxx {
         /**
          * @brief Updates the phenome of the individual based on its genome.
          *
-         * This method synchronizes the phenome with the current state of the genome.
+         * This method synchronizes the phenome with the current state of the genome. Once the phenome has been
+         * decoded from the genome, later updates only decode the genes reported by `Genome::getDirtyRange`.
          */
         void updatePhenome() override;
 
+        /**
+         * @brief Marks the phenome as out of date, deferring decoding until the phenome is read by `getPhenome`.
+         */
+        void invalidatePhenome() override;
+
         /**
          * @brief Gets the genome of the individual.
          *
@@ -196,6 +219,8 @@ namespace Geneticxx {
          * @brief Gets the phenome of the individual.
          *
          * This method retrieves the phenome of the individual, which represents its behavior or traits.
+         * A phenome invalidated by `invalidatePhenome` is decoded first, so concurrent calls on the same
+         * individual must be synchronized by the caller.
          *
          * @return A pointer to the phenome of the individual.
          */
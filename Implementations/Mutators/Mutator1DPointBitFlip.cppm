@@ -1,21 +1,124 @@
 module Mutator1DPointBitFlip;
 
 namespace Geneticxx {
-    Mutator1DPointBitFlip::Mutator1DPointBitFlip(RandomIntFromRange *genInt)
-        : m_RandomNumbersGeneratorInt{genInt} {
+    namespace {
+        /// Flip mask of the mutation in progress, per thread because islands mutate concurrently.
+        thread_local std::vector<std::uint64_t> flipWords;
+    }
 
+    Mutator1DPointBitFlip::Mutator1DPointBitFlip(RandomIntFromRange *genInt, double geneProbability)
+        : m_RandomNumbersGeneratorInt{genInt}, m_GeneProbability{geneProbability} {
+        if (!(geneProbability >= 0.0 && geneProbability <= 1.0)) {
+            throw std::invalid_argument("Gene mutation probability must be within [0, 1]");
+        }
     }
 
 
     Mutator1DPointBitFlip::~Mutator1DPointBitFlip() = default;
 
     void Mutator1DPointBitFlip::mutate(Genome *genome) {
+        if (m_GeneProbability > 0.0) {
+            flipMasked(genome, nullptr);
+            return;
+        }
         // flip the bit at a random index
         if (!validate(genome)) throw std::invalid_argument("Invalid genome");
+        flipAt(genome, m_RandomNumbersGeneratorInt->generate(0, genome->getSize() - 1));
+    }
+
+    bool Mutator1DPointBitFlip::mutateTracked(Genome *genome, std::vector<GeneChange> &changes) {
+        if (m_GeneProbability > 0.0) {
+            flipMasked(genome, &changes);
+            return true;
+        }
+        if (!validate(genome)) throw std::invalid_argument("Invalid genome");
+        const size_t index = m_RandomNumbersGeneratorInt->generate(0, genome->getSize() - 1);
+        changes.push_back({index, flipAt(genome, index)});
+        return true;
+    }
+
+    bool Mutator1DPointBitFlip::flipAt(Genome *genome, size_t index) {
+        if (auto typed = asGenomeView<bool>(genome)) {
+            auto values = typed->getValues();
+            const bool previous = values[index];
+            values[index] = !previous;
+            genome->markDirty(index, index + 1);
+            return previous;
+        }
+        if (auto bits = asGenomeBits(genome)) {
+            auto &word = bits->getWords()[index / GenomeBitsView::BitsPerWord];
+            const std::uint64_t bit = std::uint64_t{1} << (index % GenomeBitsView::BitsPerWord);
+            const bool previous = (word & bit) != 0;
+            word ^= bit;
+            genome->markDirty(index, index + 1);
+            return previous;
+        }
         auto temp = dynamic_cast<Genome1D *>(genome);
-        size_t index = m_RandomNumbersGeneratorInt->generate(0, temp->getSize() - 1);
-        temp->setValue(index, !std::any_cast<bool>(temp->getValue(index)));
+        const bool previous = std::any_cast<bool>(temp->getValue(index));
+        temp->setValue(index, !previous);
+        return previous;
+    }
 
+    bool Mutator1DPointBitFlip::mutateAt(Genome *genome, size_t position, std::vector<GeneChange> *changes) {
+        const bool previous = flipAt(genome, position);
+        if (changes != nullptr) {
+            changes->push_back({position, previous});
+        }
+        return true;
+    }
+
+    void Mutator1DPointBitFlip::flipMasked(Genome *genome, std::vector<GeneChange> *changes) {
+        if (!validate(genome)) throw std::invalid_argument("Invalid genome");
+        const size_t size = genome->getSize();
+        flipWords.resize((size + GenomeBitsView::BitsPerWord - 1) / GenomeBitsView::BitsPerWord);
+        m_RandomNumbersGeneratorInt->generateMask(m_GeneProbability, flipWords);
+        // the padding bits of packed genomes have to stay zero
+        if (size % GenomeBitsView::BitsPerWord != 0) {
+            flipWords.back() &= (std::uint64_t{1} << (size % GenomeBitsView::BitsPerWord)) - 1;
+        }
+
+        size_t first = size;
+        size_t last = 0;
+        auto bits = asGenomeBits(genome);
+        auto typed = bits == nullptr ? asGenomeView<bool>(genome) : nullptr;
+        auto temp = dynamic_cast<Genome1D *>(genome);
+        for (size_t word = 0; word < flipWords.size(); word++) {
+            const std::uint64_t mask = flipWords[word];
+            if (mask == 0) {
+                continue;
+            }
+            const size_t base = word * GenomeBitsView::BitsPerWord;
+            first = std::min(first, base + std::countr_zero(mask));
+            last = base + GenomeBitsView::BitsPerWord - std::countl_zero(mask);
+            if (bits != nullptr && changes == nullptr) {
+                bits->getWords()[word] ^= mask;
+                continue;
+            }
+            for (std::uint64_t rest = mask; rest != 0; rest &= rest - 1) {
+                const size_t index = base + std::countr_zero(rest);
+                if (bits != nullptr) {
+                    auto &target = bits->getWords()[word];
+                    const std::uint64_t bit = std::uint64_t{1} << (index % GenomeBitsView::BitsPerWord);
+                    changes->push_back({index, (target & bit) != 0});
+                    target ^= bit;
+                } else if (typed != nullptr) {
+                    auto values = typed->getValues();
+                    if (changes != nullptr) {
+                        changes->push_back({index, static_cast<bool>(values[index])});
+                    }
+                    values[index] = !values[index];
+                } else {
+                    const bool previous = std::any_cast<bool>(temp->getValue(index));
+                    if (changes != nullptr) {
+                        changes->push_back({index, previous});
+                    }
+                    temp->setValue(index, !previous);
+                }
+            }
+        }
+        if (first < last) {
+            genome->markDirty(first, last);
+        }
     }
 
     bool Mutator1DPointBitFlip::validate(Genome *genome) const {
@@ -26,7 +129,11 @@ namespace Geneticxx {
 
     MutationSchema *Mutator1DPointBitFlip::clone() const {
         // Create a unique copy of the mutator
-        auto cloneMutator = new Mutator1DPointBitFlip(m_RandomNumbersGeneratorInt);
+        auto cloneMutator = new Mutator1DPointBitFlip(m_RandomNumbersGeneratorInt, m_GeneProbability);
         return cloneMutator;
     }
+
+    double Mutator1DPointBitFlip::getGeneProbability() const {
+        return m_GeneProbability;
+    }
 }
@@ -23,6 +23,22 @@ namespace Geneticxx {
          */
         RandomIntFromRange* m_RandomNumbersGeneratorInt{};
 
+        /// Probability of flipping every single bit in the per-gene mode, 0 in the point mode.
+        double m_GeneProbability = 0.0;
+
+        /**
+         * @brief Flips the bit at the given index and returns its previous value.
+         */
+        bool flipAt(Genome* genome, size_t index);
+
+        /**
+         * @brief Flips every bit selected by a Bernoulli mask drawn in bulk.
+         *
+         * @param genome Genome to mutate.
+         * @param changes Vector receiving the flipped positions with their previous values, or nullptr.
+         */
+        void flipMasked(Genome* genome, std::vector<GeneChange>* changes);
+
     public:
         /**
          * @brief Constructor to initialize the mutation schema with random number generators.
@@ -30,9 +46,16 @@ namespace Geneticxx {
          * This constructor initializes the mutation schema by accepting random number generators for integer
          * and real number generation. The mutation range is set to default values (0.0 for min and 60.0 for max).
          *
+         * In the per-gene mode every bit is flipped independently with the given probability, the flips being
+         * drawn as 64-bit masks with `RandomIntFromRange::generateMask` rather than one draw per gene. Use it
+         * together with a mutation chance of 1, since the probability already applies to every gene.
+         *
          * @param genInt Pointer to the random integer generator.
+         * @param geneProbability Probability of flipping every bit, or 0 to flip exactly one random bit.
+         *
+         * @throws std::invalid_argument If the probability is not within [0, 1].
          */
-        Mutator1DPointBitFlip(RandomIntFromRange* genInt);
+        Mutator1DPointBitFlip(RandomIntFromRange* genInt, double geneProbability = 0.0);
 
         /**
          * @brief Destructor.
@@ -50,6 +73,11 @@ namespace Geneticxx {
          */
         [[nodiscard]] MutationSchema* clone() const override;
 
+        /**
+         * @brief Returns the probability of flipping every bit, 0 if exactly one random bit is flipped.
+         */
+        double getGeneProbability() const;
+
         /**
          * @brief Mutates the genome by replacing a value at a random index (or the specified index).
          *
@@ -60,6 +88,23 @@ namespace Geneticxx {
          */
         void mutate(Genome* genome) override;
 
+        /**
+         * @brief Flips the bit at a random index, or the bits selected per gene, and reports the flipped positions.
+         *
+         * @param genome Pointer to the genome to mutate.
+         * @param changes Vector receiving the flipped positions with their previous values.
+         *
+         * @return True, the flipped position is always known.
+         */
+        bool mutateTracked(Genome* genome, std::vector<GeneChange>& changes) override;
+
+        /**
+         * @brief Flips the bit at the given position.
+         *
+         * @return True, every position can be flipped.
+         */
+        bool mutateAt(Genome* genome, size_t position, std::vector<GeneChange>* changes) override;
+
         /**
          * @brief Validates the genome for mutation.
          *
@@ -88,12 +88,42 @@ namespace Geneticxx {
          */
         void mutate(Genome* genomeBase) override
         {
+            int pos = m_RandomNumbersGeneratorInt->generate(0, static_cast<int>(genomeBase->getSize()) - 1);
+            mutateAt(genomeBase, pos, nullptr);
+        }
+
+        /**
+         * @brief Adds a random value from the range to the value at the given position.
+         *
+         * Only genes of a floating-point type are changed in place. Any other type goes through the `std::any`
+         * accessors, which reject the real-valued sum instead of silently truncating it.
+         *
+         * @param genomeBase Pointer to the genome to mutate.
+         * @param pos Index of the value to change.
+         * @param changes Vector receiving the changed value with its previous value, or nullptr.
+         *
+         * @return True, every position can be changed.
+         */
+        bool mutateAt(Genome* genomeBase, size_t pos, std::vector<GeneChange>* changes) override
+        {
+            if constexpr (std::floating_point<T>) {
+                if (auto typed = asGenomeView<T>(genomeBase)) {
+                    auto &value = typed->getValues()[pos];
+                    if (changes != nullptr) {
+                        changes->push_back({pos, value});
+                    }
+                    value += static_cast<T>(m_RandomNumbersGeneratorReal->generate(minValue, maxValue));
+                    genomeBase->markDirty(pos, pos + 1);
+                    return true;
+                }
+            }
             auto genome = dynamic_cast<Genome1D*>(genomeBase);
-            int pos = m_RandomNumbersGeneratorInt->generate(0, static_cast<int>(genome->getSize()) - 1);
-            genome->setValue(
-                pos,
-                std::any_cast<T>(genome->getValue(pos)) + m_RandomNumbersGeneratorReal->generate(minValue, maxValue)
-            );
+            const T previous = std::any_cast<T>(genome->getValue(pos));
+            if (changes != nullptr) {
+                changes->push_back({pos, previous});
+            }
+            genome->setValue(pos, previous + m_RandomNumbersGeneratorReal->generate(minValue, maxValue));
+            return true;
         }
 
 
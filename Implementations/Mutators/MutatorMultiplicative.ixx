@@ -82,6 +82,14 @@ namespace Geneticxx {
         {
             auto genome = dynamic_cast<Genome1D*>(genomeBase);
             int pos = m_RandomNumbersGeneratorInt->generate(0, static_cast<int>(genome->getSize()) - 1);
+            // integral genes would silently truncate the product, they are rejected by the std::any path below
+            if constexpr (std::floating_point<T>) {
+                if (auto typed = asGenomeView<T>(genomeBase)) {
+                    typed->getValues()[pos] *= static_cast<T>(m_RandomNumbersGeneratorReal->generate(0.3, 1.7));
+                    genomeBase->markDirty(pos, pos + 1);
+                    return;
+                }
+            }
             genome->setValue(
                 pos,
                 std::any_cast<T>(genome->getValue(pos)) * m_RandomNumbersGeneratorReal->generate(0.3, 1.7)
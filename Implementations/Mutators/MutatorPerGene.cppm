@@ -0,0 +1,67 @@
+module MutatorPerGene;
+
+namespace Geneticxx {
+    MutatorPerGene::MutatorPerGene(MutationSchema *mutation, RandomRealFromRange *genReal, double geneProbability)
+        : m_Mutation{mutation}, m_RandomNumbersGeneratorReal{genReal}, m_GeneProbability{geneProbability},
+          m_LogComplement{std::log1p(-geneProbability)} {
+        if (mutation == nullptr) {
+            throw std::invalid_argument("Wrapped mutation must not be null");
+        }
+        if (!(geneProbability >= 0.0 && geneProbability <= 1.0)) {
+            throw std::invalid_argument("Gene mutation probability must be within [0, 1]");
+        }
+    }
+
+    MutatorPerGene::~MutatorPerGene() = default;
+
+    MutationSchema *MutatorPerGene::clone() const {
+        return new MutatorPerGene(m_Mutation->clone(), m_RandomNumbersGeneratorReal, m_GeneProbability);
+    }
+
+    size_t MutatorPerGene::drawSkip() {
+        if (m_GeneProbability >= 1.0) {
+            return 0;
+        }
+        // inverse transform of the geometric distribution, 1 - u lies within (0, 1]
+        const double u = m_RandomNumbersGeneratorReal->generate(0, 1);
+        const double skip = std::floor(std::log1p(-u) / m_LogComplement);
+        if (!(skip < static_cast<double>(std::numeric_limits<size_t>::max() / 2))) {
+            return std::numeric_limits<size_t>::max() / 2;
+        }
+        return static_cast<size_t>(skip);
+    }
+
+    void MutatorPerGene::mutateSelected(Genome *genome, std::vector<GeneChange> *changes) {
+        if (m_GeneProbability <= 0.0) {
+            return;
+        }
+        // the positions strictly increase, so every gene is mutated and reported at most once
+        const size_t size = genome->getSize();
+        for (size_t position = drawSkip(); position < size; position += 1 + drawSkip()) {
+            if (!m_Mutation->mutateAt(genome, position, changes)) {
+                throw std::invalid_argument("Wrapped mutation cannot mutate a given gene");
+            }
+        }
+    }
+
+    void MutatorPerGene::mutate(Genome *genome) {
+        mutateSelected(genome, nullptr);
+    }
+
+    bool MutatorPerGene::mutateTracked(Genome *genome, std::vector<GeneChange> &changes) {
+        mutateSelected(genome, &changes);
+        return true;
+    }
+
+    bool MutatorPerGene::mutateAt(Genome *genome, size_t position, std::vector<GeneChange> *changes) {
+        return m_Mutation->mutateAt(genome, position, changes);
+    }
+
+    bool MutatorPerGene::validate(Genome *genome) const {
+        return m_Mutation->validate(genome);
+    }
+
+    double MutatorPerGene::getGeneProbability() const {
+        return m_GeneProbability;
+    }
+}
@@ -0,0 +1,94 @@
+export module MutatorPerGene;
+
+export import MutationSchema;
+import RandomRealFromRange;
+import std;
+
+namespace Geneticxx {
+    /**
+     * @class MutatorPerGene
+     * @brief A mutation schema mutating every gene independently with a given probability.
+     *
+     * Wraps a point mutation, such as `Mutator1DPointBitFlip`, `MutatorPointReplacement` or
+     * `Mutator1DRandomValueAddition`, and applies it with `MutationSchema::mutateAt` to the selected genes. Instead
+     * of a Bernoulli trial per gene, the distance to the next mutated gene is drawn from the geometric
+     * distribution, so a mutation costs one random number per mutated gene rather than one per gene; with the
+     * usual probability of 1/L only a single gene of a genome of length L is mutated on average.
+     *
+     * Since the probability applies to every gene, use it with a mutation chance of 1.
+     */
+    export class MutatorPerGene : public MutationSchema {
+    private:
+        std::unique_ptr<MutationSchema> m_Mutation; ///< Point mutation applied to every selected gene.
+        RandomRealFromRange* m_RandomNumbersGeneratorReal{}; ///< Generator of the skips between mutated genes.
+        double m_GeneProbability; ///< Probability of mutating every single gene.
+        double m_LogComplement; ///< Logarithm of the probability of not mutating a gene.
+
+        /**
+         * @brief Draws the number of genes skipped before the next mutated gene.
+         */
+        size_t drawSkip();
+
+        /**
+         * @brief Applies the wrapped mutation to the genes selected by the geometric skips.
+         */
+        void mutateSelected(Genome* genome, std::vector<GeneChange>* changes);
+
+    public:
+        /**
+         * @brief Constructor wrapping a point mutation.
+         *
+         * @param mutation Point mutation applied to every selected gene, owned by the wrapper.
+         * @param genReal Pointer to the random real number generator drawing the skips.
+         * @param geneProbability Probability of mutating every single gene, e.g. 1/L for genomes of length L.
+         *
+         * @throws std::invalid_argument If the mutation is null or the probability is not within [0, 1].
+         */
+        MutatorPerGene(MutationSchema* mutation, RandomRealFromRange* genReal, double geneProbability);
+
+        ~MutatorPerGene() override;
+
+        /**
+         * @brief Clones the wrapper together with the wrapped mutation.
+         *
+         * @return A pointer to the cloned mutation schema.
+         */
+        [[nodiscard]] MutationSchema* clone() const override;
+
+        /**
+         * @brief Mutates every gene independently with the gene probability.
+         *
+         * @param genome Pointer to the genome to mutate.
+         *
+         * @throws std::invalid_argument If the wrapped mutation cannot mutate a given gene.
+         */
+        void mutate(Genome* genome) override;
+
+        /**
+         * @brief Mutates every gene independently with the gene probability and reports the mutated genes.
+         *
+         * @param genome Pointer to the genome to mutate.
+         * @param changes Vector receiving the mutated genes with their previous values.
+         *
+         * @return True, every mutated gene is reported.
+         *
+         * @throws std::invalid_argument If the wrapped mutation cannot mutate a given gene.
+         */
+        bool mutateTracked(Genome* genome, std::vector<GeneChange>& changes) override;
+
+        /**
+         * @brief Applies the wrapped mutation to the gene at the given position.
+         */
+        bool mutateAt(Genome* genome, size_t position, std::vector<GeneChange>* changes) override;
+
+        /**
+         * @brief Validates the genome with the wrapped mutation.
+         */
+        bool validate(Genome* genome) const override;
+
+        /**
+         * @brief Returns the probability of mutating every single gene.
+         */
+        double getGeneProbability() const;
+    };
+}
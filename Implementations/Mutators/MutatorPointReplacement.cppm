@@ -19,23 +19,35 @@ namespace Geneticxx {
     MutatorPointReplacement::~MutatorPointReplacement() = default;
 
     void MutatorPointReplacement::mutate(Genome *genome) {
-        // Replace the value with a new random value
-        auto temp = dynamic_cast<Genome1D *>(genome);
+        size_t position;
         if (m_index > -1 && m_index < genome->getSize()) {
-            temp->setValue(
-                m_index,
-                m_RandomNumbersGeneratorReal->generate( // TODO: types should match genome vector type?
-                    m_MinValue,
-                    m_MaxValue)
-            );
+            position = m_index;
+        } else {
+            position = m_RandomNumbersGeneratorInt->generate(0, genome->getSize() - 1);
+        }
+        mutateAt(genome, position, nullptr);
+    }
+
+    bool MutatorPointReplacement::mutateAt(Genome *genome, size_t position, std::vector<GeneChange> *changes) {
+        // Replace the value with a new random value
+        double value = m_RandomNumbersGeneratorReal->generate( // TODO: types should match genome vector type?
+            m_MinValue,
+            m_MaxValue);
+        if (auto typed = asGenomeView<double>(genome)) {
+            auto &target = typed->getValues()[position];
+            if (changes != nullptr) {
+                changes->push_back({position, target});
+            }
+            target = value;
+            genome->markDirty(position, position + 1);
         } else {
-            temp->setValue(
-                m_RandomNumbersGeneratorInt->generate(0, genome->getSize() - 1),
-                m_RandomNumbersGeneratorReal->generate( // TODO: types should match genome vector type?
-                    m_MinValue,
-                    m_MaxValue)
-            );
+            auto temp = dynamic_cast<Genome1D *>(genome);
+            if (changes != nullptr) {
+                changes->push_back({position, temp->getValue(position)});
+            }
+            temp->setValue(position, value);
         }
+        return true;
     }
 
     double MutatorPointReplacement::getMinVal() const {
@@ -103,6 +103,13 @@ namespace Geneticxx {
          */
         void mutate(Genome* genome) override;
 
+        /**
+         * @brief Replaces the value at the given position with a random value from the range.
+         *
+         * @return True, every position can be replaced.
+         */
+        bool mutateAt(Genome* genome, size_t position, std::vector<GeneChange>* changes) override;
+
         /**
          * @brief Gets the minimum value for mutation.
          *
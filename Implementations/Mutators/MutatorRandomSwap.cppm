@@ -7,7 +7,15 @@ namespace Geneticxx {
     MutatorRandomSwap::~MutatorRandomSwap() = default;
 
     void MutatorRandomSwap::mutate(Genome *genomeBase) {
-        // Replace the value with a new random value
+        swapRandom(genomeBase, nullptr);
+    }
+
+    bool MutatorRandomSwap::mutateTracked(Genome *genomeBase, std::vector<GeneChange> &changes) {
+        swapRandom(genomeBase, &changes);
+        return true;
+    }
+
+    void MutatorRandomSwap::swapRandom(Genome *genomeBase, std::vector<GeneChange> *changes) {
         auto genome = dynamic_cast<Genome1D*>(genomeBase);
         if (validate(genome))
         {
@@ -17,9 +25,27 @@ namespace Geneticxx {
                 // ensure we're not swapping the same index
                 target2 = m_RandomNumbersGeneratorInt->generate(0, static_cast<int>(genome->getSize()) - 1);
             }
-            auto tempVal = genome->getValue(target1); //TODO if get value doesn't copy this can be replaced with std swap
-            genome->setValue(target1, genome->getValue(target2));
-            genome->setValue(target2, tempVal);
+            const bool typed = visitCommonValues([target1, target2, changes](auto values) {
+                if (changes != nullptr) {
+                    using Value = typename decltype(values)::value_type;
+                    changes->push_back({static_cast<size_t>(target1), Value(values[target1])});
+                    changes->push_back({static_cast<size_t>(target2), Value(values[target2])});
+                }
+                std::swap(values[target1], values[target2]);
+            }, genomeBase);
+            if (typed) {
+                genomeBase->markDirty(target1, target1 + 1);
+                genomeBase->markDirty(target2, target2 + 1);
+            } else {
+                auto tempVal = genome->getValue(target1);
+                auto otherVal = genome->getValue(target2);
+                if (changes != nullptr) {
+                    changes->push_back({static_cast<size_t>(target1), tempVal});
+                    changes->push_back({static_cast<size_t>(target2), otherVal});
+                }
+                genome->setValue(target1, otherVal);
+                genome->setValue(target2, tempVal);
+            }
             return;
         }
         //TODO throw error or not? maybe it should be thrown in validate function?
@@ -21,6 +21,11 @@ namespace Geneticxx {
          */
         RandomIntFromRange* m_RandomNumbersGeneratorInt{};
 
+        /**
+         * @brief Swaps two random values in the genome, recording them in `changes` unless it is null.
+         */
+        void swapRandom(Genome* genome, std::vector<GeneChange>* changes);
+
     public:
         /**
          * @brief Constructor to initialize the mutation schema with a random number generator.
@@ -50,6 +55,19 @@ namespace Geneticxx {
          */
         void mutate(Genome* genome) override;
 
+        /**
+         * @brief Swaps two random values in the genome and reports both swapped positions.
+         *
+         * The swap keeps the multiset of values, so evaluations of permutations, e.g. the travelling salesman
+         * route, update their scores from the four edges around the swapped positions.
+         *
+         * @param genome Pointer to the genome to mutate.
+         * @param changes Vector receiving the two swapped positions with their previous values.
+         *
+         * @return True, the swapped positions are always known.
+         */
+        bool mutateTracked(Genome* genome, std::vector<GeneChange>& changes) override;
+
         /**
          * @brief Validates the genome for mutation.
          *
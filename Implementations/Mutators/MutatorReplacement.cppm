@@ -14,11 +14,14 @@ namespace Geneticxx {
     void MutatorReplacement::mutate(Genome *genomeBase) {
         auto genome = dynamic_cast<Genome1D*>(genomeBase);
         int pos = m_RandomNumbersGeneratorInt->generate(0, static_cast<int>(genome->getSize()) - 1);
-        genome->setValue(
-            pos,
-            m_RandomNumbersGeneratorReal->generate( // TODO: types should match genome vector type?
-                m_MaxValue, m_MinValue)
-        );
+        double value = m_RandomNumbersGeneratorReal->generate( // TODO: types should match genome vector type?
+            m_MaxValue, m_MinValue);
+        if (auto typed = asGenomeView<double>(genomeBase)) {
+            typed->getValues()[pos] = value;
+            genomeBase->markDirty(pos, pos + 1);
+        } else {
+            genome->setValue(pos, value);
+        }
     }
 
     double MutatorReplacement::getMinVal() const {
@@ -0,0 +1,115 @@
+module ObserverRemoteMigration;
+
+namespace Geneticxx {
+    ObserverRemoteMigration::ObserverRemoteMigration(MigrationTransport *transport, MigrationPolicy policy,
+                                                     RandomIntFromRange *genInt, size_t populationIndex)
+        : m_Transport{transport}, m_Policy{policy}, m_RandomNumbersGeneratorInt{genInt},
+          m_PopulationIndex{populationIndex} {
+        if (m_Transport == nullptr) {
+            throw std::invalid_argument("Remote migration requires a transport");
+        }
+        if (policy.topology == MigrationTopology::Random && genInt == nullptr) {
+            throw std::invalid_argument("Random migration topology requires a random numbers generator");
+        }
+    }
+
+    ObserverRemoteMigration::~ObserverRemoteMigration() = default;
+
+    int ObserverRemoteMigration::generationDone(std::vector<std::unique_ptr<Population> > *population) {
+        if (m_PopulationIndex >= population->size() || m_Policy.interval == 0) {
+            return 0;
+        }
+        auto observed = (*population)[m_PopulationIndex].get();
+        const size_t iteration = observed->getIteration();
+        if (iteration % m_Policy.interval != 0 || m_LastMigration == iteration) {
+            return 0;
+        }
+        m_LastMigration = iteration;
+        return static_cast<int>(sendMigrants(observed));
+    }
+
+    int ObserverRemoteMigration::generationStart(std::vector<std::unique_ptr<Population> > *population) {
+        if (m_PopulationIndex >= population->size()) {
+            return 0;
+        }
+        return static_cast<int>(receiveMigrants((*population)[m_PopulationIndex].get()));
+    }
+
+    int ObserverRemoteMigration::evaluationDone(std::vector<std::unique_ptr<Population> > *population) {
+        return 0;
+    }
+
+    size_t ObserverRemoteMigration::sendMigrants(Population *population) {
+        std::vector<size_t> order(population->getSize());
+        std::iota(order.begin(), order.end(), 0);
+        const size_t count = std::min(m_Policy.migrants, order.size());
+        std::ranges::partial_sort(order, order.begin() + count, [this, population](size_t first, size_t second) {
+            return isBetterMigrant(population->getIndividual(first), population->getIndividual(second),
+                                   m_Policy.maximize);
+        });
+
+        // a message holds the number of migrants followed by the migrants
+        m_Message.assign(sizeof(std::uint64_t), std::byte{0});
+        std::uint64_t serialized = 0;
+        for (size_t i = 0; i < count; i++) {
+            const Individual *individual = population->getIndividual(order[i]);
+            if (individual != nullptr && serializeIndividual(individual, m_Message)) {
+                ++serialized;
+            }
+        }
+        if (serialized == 0) {
+            return 0;
+        }
+        std::memcpy(m_Message.data(), &serialized, sizeof(serialized));
+
+        size_t sent = 0;
+        for (size_t target: migrationTargets(m_Policy.topology, m_Transport->getIslandIndex(),
+                                             m_Transport->getIslandsNumber(), m_RandomNumbersGeneratorInt)) {
+            sent += m_Transport->send(target, m_Message);
+        }
+        return sent;
+    }
+
+    size_t ObserverRemoteMigration::receiveMigrants(Population *population) {
+        std::vector<std::unique_ptr<Individual>> migrants;
+        while (m_Transport->receive(m_Message)) {
+            if (population->getSize() == 0 || population->getIndividual(0) == nullptr) {
+                continue;
+            }
+            std::uint64_t count;
+            if (m_Message.size() < sizeof(count)) {
+                continue;
+            }
+            std::memcpy(&count, m_Message.data(), sizeof(count));
+            std::span<const std::byte> remaining = std::span<const std::byte>(m_Message).subspan(sizeof(count));
+            for (std::uint64_t i = 0; i < count; i++) {
+                std::unique_ptr<Individual> migrant(population->getIndividual(0)->clone());
+                const size_t read = deserializeIndividual(remaining, migrant.get());
+                if (read == 0) {
+                    break;
+                }
+                remaining = remaining.subspan(read);
+                migrants.push_back(std::move(migrant));
+            }
+        }
+
+        const size_t count = std::min({m_Policy.migrants, migrants.size(), population->getSize()});
+        if (count == 0) {
+            return 0;
+        }
+        // best migrants first, worst individuals first
+        std::ranges::stable_sort(migrants, [this](const auto &first, const auto &second) {
+            return isBetterMigrant(first.get(), second.get(), m_Policy.maximize);
+        });
+        std::vector<size_t> order(population->getSize());
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::partial_sort(order, order.begin() + count, [this, population](size_t first, size_t second) {
+            return isBetterMigrant(population->getIndividual(second), population->getIndividual(first),
+                                   m_Policy.maximize);
+        });
+        for (size_t i = 0; i < count; i++) {
+            population->setIndividual(order[i], migrants[i].release());
+        }
+        return count;
+    }
+}
@@ -0,0 +1,97 @@
+export module ObserverRemoteMigration;
+
+export import Observers;
+export import MigrationTransport;
+export import PopulationMigratory;
+import RandomIntFromRange;
+import std;
+import std.compat;
+
+namespace Geneticxx {
+    /**
+     * @class ObserverRemoteMigration
+     * @brief Observer exchanging migrants with islands living in other processes.
+     *
+     * Attached to the algorithm of every process of a multi-process island model, it turns the process into an
+     * island connected to the others by a `MigrationTransport`. When a generation is done, every
+     * `MigrationPolicy::interval` iterations it serializes the best `MigrationPolicy::migrants` individuals of the
+     * observed population and sends them to the targets given by the topology. When a generation starts it
+     * reads the received migrants into clones of the population's individuals, which then replace the worst ones.
+     *
+     * Genomes have to support `Genome::serialize`; migrants whose genome cannot be serialized are skipped.
+     */
+    export class ObserverRemoteMigration : public AlgorithmObserver {
+    private:
+        /// Transport connecting this island to the others, owned by the observer.
+        std::unique_ptr<MigrationTransport> m_Transport;
+
+        /// Topology, interval and size of the migrations.
+        MigrationPolicy m_Policy;
+
+        /// Generator drawing the targets of the random topology.
+        RandomIntFromRange *m_RandomNumbersGeneratorInt;
+
+        /// Index of the observed population among the populations of the algorithm.
+        size_t m_PopulationIndex;
+
+        /// Iteration of the last migration, so that a population is sent at most once per iteration.
+        std::optional<size_t> m_LastMigration;
+
+        /// Buffer reused for the sent and received messages.
+        std::vector<std::byte> m_Message;
+
+    public:
+        /**
+         * @brief Creates the observer of one island.
+         *
+         * @param transport Transport of the island; the observer takes ownership of it.
+         * @param policy Topology, interval and size of the migrations.
+         * @param genInt Generator drawing the targets of the random topology, may be null for other topologies.
+         * @param populationIndex Index of the observed population among the populations of the algorithm.
+         *
+         * @throws std::invalid_argument If the transport is null, or the topology is random without a generator.
+         */
+        ObserverRemoteMigration(MigrationTransport *transport, MigrationPolicy policy,
+                                RandomIntFromRange *genInt = nullptr, size_t populationIndex = 0);
+
+        ~ObserverRemoteMigration() override;
+
+        /**
+         * @brief Sends the best individuals of the observed population if a migration is due.
+         *
+         * @return Number of messages handed over to the transport.
+         */
+        int generationDone(std::vector<std::unique_ptr<Population>> *population) override;
+
+        /**
+         * @brief Replaces the worst individuals of the observed population with the received migrants.
+         *
+         * @return Number of replaced individuals.
+         */
+        int generationStart(std::vector<std::unique_ptr<Population>> *population) override;
+
+        /**
+         * @brief Does nothing, migration happens between generations.
+         *
+         * @return 0.
+         */
+        int evaluationDone(std::vector<std::unique_ptr<Population>> *population) override;
+
+        /**
+         * @brief Sends clones of the best individuals of a population to the target islands.
+         *
+         * @param population Population the migrants are selected from.
+         * @return Number of messages handed over to the transport.
+         */
+        size_t sendMigrants(Population *population);
+
+        /**
+         * @brief Reads all received messages and replaces the worst individuals with the best migrants.
+         *
+         * @param population Population receiving the migrants; it must hold at least one individual, whose
+         *        clones receive the migrants' genomes.
+         * @return Number of replaced individuals.
+         */
+        size_t receiveMigrants(Population *population);
+    };
+}
@@ -7,14 +7,16 @@ import std.compat;
 namespace Geneticxx {
 
     export template<class T>
-    class Phenome1DNoTranslation : public Phenome1D {
+    class Phenome1DNoTranslation : public Phenome1D, public Phenome1DView<T> {
     private:
         /**
          * @brief A vector of double values representing the phenome's data.
          *
-         * This vector holds the double values that define the phenome.
+         * This vector holds the double values that define the phenome. Boolean values are stored one per byte,
+         * so that the data can be exposed as a contiguous `Phenome1DView<T>`. The values are allocated from the
+         * object resource current when the phenome is constructed.
          */
-        std::vector<T> m_data;
+        std::pmr::vector<GeneStorage<T>> m_data = std::pmr::vector<GeneStorage<T>>(getObjectResource());
 
     public:
         Phenome1DNoTranslation()
@@ -24,7 +26,7 @@ namespace Geneticxx {
 
         Phenome1DNoTranslation(std::vector<T> data)
         {
-          m_data = data;
+          m_data.assign(data.begin(), data.end());
         }
 
 
@@ -84,6 +86,11 @@ namespace Geneticxx {
          */
         void updatePhenome(const Genome* genomeBase) override
         {
+            if (auto typed = asGenomeView<T>(genomeBase)) {
+                // fast path, genes of the same type are copied without boxing them into std::any
+                m_data.assign(typed->getValues().begin(), typed->getValues().end());
+                return;
+            }
             auto genome = dynamic_cast<const Genome1D*>(genomeBase); //TODO check if it's the correct type
             if (m_data.size() <= genome->getSize())
             {
@@ -95,6 +102,29 @@ namespace Geneticxx {
 
         }
 
+        /**
+         * @brief Updates the values copied from the genes in [begin, end).
+         *
+         * Falls back to `updatePhenome` when the genome has no typed view of the same type or its size differs.
+         *
+         * @param genome A pointer to the genome object that provides the data to update the phenome.
+         * @param begin Index of the first modified gene.
+         * @param end Index one past the last modified gene.
+         */
+        void updatePhenomeRange(const Genome* genomeBase, size_t begin, size_t end) override
+        {
+            auto typed = asGenomeView<T>(genomeBase);
+            if (typed == nullptr || typed->getValues().size() != m_data.size()) {
+                updatePhenome(genomeBase);
+                return;
+            }
+            auto values = typed->getValues();
+            end = std::min(end, values.size());
+            if (begin < end) {
+                std::copy(values.begin() + begin, values.begin() + end, m_data.begin() + begin);
+            }
+        }
+
         /**
          * @brief Creates a new instance of `PhenomeBoolToDouble`.
          *
@@ -116,7 +146,7 @@ namespace Geneticxx {
          */
         Phenome* clone() const override
         {
-            auto temp = new Phenome1DNoTranslation(*this);
+            auto temp = new Phenome1DNoTranslation();
             temp->m_data = m_data;
             return temp;
         }
@@ -131,7 +161,7 @@ namespace Geneticxx {
          */
         std::any getValue(size_t position) const override
         {
-            return m_data[position];
+            return static_cast<T>(m_data[position]);
         }
 
         /**
@@ -147,6 +177,16 @@ namespace Geneticxx {
             m_data[position] = std::any_cast<T>(value); //TODO any cast again, check for type before casting or catch errors
         }
 
+        /**
+         * @brief Retrieves a read-only view of the phenome's data vector.
+         *
+         * @return Span over the phenome's data.
+         */
+        std::span<const GeneStorage<T>> getValues() const override
+        {
+            return m_data;
+        }
+
         /**
          * @brief Retrieves the size of the phenome's data vector.
          *
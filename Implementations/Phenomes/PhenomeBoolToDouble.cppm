@@ -1,6 +1,39 @@
 module PhenomeBoolToDouble;
 
 namespace Geneticxx {
+    namespace {
+        /**
+         * @brief Decodes every block of (exponentSize + mantissaSize) bits overlapping the bits in [begin, end).
+         *
+         * The exponent bits (most significant first) form the integer part of the value, and each following
+         * mantissa bit j contributes 1/2^(j+1) to its fractional part.
+         *
+         * @param bitAt Callable returning the bit at the given index, false past the end of the genome.
+         */
+        template<typename BitAt>
+        void decodeBlocks(BitAt &&bitAt, size_t begin, size_t end, unsigned int exponentSize,
+                          unsigned int mantissaSize, std::vector<double> &data) {
+            const size_t blockSize = exponentSize + mantissaSize;
+            for (size_t i = begin / blockSize * blockSize; i < end && i / blockSize < data.size(); i += blockSize) {
+                unsigned long long int exponentValue = 0;
+                for (size_t j = 0; j < exponentSize; ++j) {
+                    exponentValue = (exponentValue << 1) | (bitAt(i + j) ? 1ULL : 0ULL);
+                }
+
+                double mantissaValue = 0.0;
+                double fraction = 0.5;
+                for (size_t j = exponentSize; j < blockSize; ++j) {
+                    if (bitAt(i + j)) {
+                        mantissaValue += fraction;
+                    }
+                    fraction *= 0.5;
+                }
+
+                data[i / blockSize] = static_cast<double>(exponentValue) + mantissaValue;
+            }
+        }
+    }
+
     PhenomeBoolToDouble::PhenomeBoolToDouble() {
     }
 
@@ -19,15 +52,19 @@ namespace Geneticxx {
         this->m_data = m_data;
     }
 
-    PhenomeBoolToDouble::PhenomeBoolToDouble(const PhenomeBoolToDouble &other) : m_data{other.m_data} {
+    PhenomeBoolToDouble::PhenomeBoolToDouble(const PhenomeBoolToDouble &other) : m_data{other.m_data},
+        m_exponentSize{other.m_exponentSize}, m_mantissaSize{other.m_mantissaSize} {
     }
 
-    PhenomeBoolToDouble::PhenomeBoolToDouble(PhenomeBoolToDouble &&other) : m_data{std::move(other.m_data)} {
+    PhenomeBoolToDouble::PhenomeBoolToDouble(PhenomeBoolToDouble &&other) : m_data{std::move(other.m_data)},
+        m_exponentSize{other.m_exponentSize}, m_mantissaSize{other.m_mantissaSize} {
     }
 
     PhenomeBoolToDouble &PhenomeBoolToDouble::operator=(const PhenomeBoolToDouble &other) {
         if (this != &other) {
             m_data = other.m_data;
+            m_exponentSize = other.m_exponentSize;
+            m_mantissaSize = other.m_mantissaSize;
         }
         return *this;
     }
@@ -35,6 +72,8 @@ namespace Geneticxx {
     PhenomeBoolToDouble &PhenomeBoolToDouble::operator=(PhenomeBoolToDouble &&other) noexcept {
         if (this != &other) {
             m_data = std::move(other.m_data);
+            m_exponentSize = other.m_exponentSize;
+            m_mantissaSize = other.m_mantissaSize;
         }
         return *this;
     }
@@ -43,48 +82,40 @@ namespace Geneticxx {
     }
 
     void PhenomeBoolToDouble::updatePhenome(const Genome *genomeBase) {
-        auto genome = dynamic_cast<const Genome1D*>(genomeBase); //TODO check if it's the correct type
-        // if (this->m_data.size() != genome->getSize()) {
-        //     return;
-        // }
+        decode(genomeBase, 0, std::numeric_limits<size_t>::max());
+    }
+
+    void PhenomeBoolToDouble::updatePhenomeRange(const Genome *genomeBase, size_t begin, size_t end) {
+        decode(genomeBase, begin, end);
+    }
+
+    void PhenomeBoolToDouble::decode(const Genome *genomeBase, size_t begin, size_t end) {
         if (m_exponentSize == 0 || m_mantissaSize == 0 ) {
             throw std::invalid_argument("Neither m_exponentSize or m_mantissaSize can be 0.");
         }
 
-        if (genome->getValue(0).type() == typeid(bool)) { // Check if the genome values are booleans
-            int countDataIndex = 0;
-            double value;
-            unsigned long long int exponentValue;
-            double mantissaValue;
-
-            // Iterate through the genome in blocks of (m_exponentSize + m_mantissaSize) bits
-            for (int i = 0; i < genome->getSize(); i += m_mantissaSize + m_exponentSize) {
-                // Reset values for this group
-                exponentValue = 0;
-                mantissaValue = 0.0;
-
-                // Process exponent bits (most significant bits)
-                for (int j = 0; j < m_exponentSize; ++j) {
-                    bool bit = std::any_cast<bool>(genome->getValue(i + j));
-                    exponentValue = (exponentValue << 1) | (bit ? 1ULL : 0ULL);
-                }
+        if (auto typed = asGenomeView<bool>(genomeBase)) {
+            // fast path, bits stored one per byte are read without boxing them into std::any
+            auto bits = typed->getValues();
+            decodeBlocks([bits](size_t i) { return i < bits.size() && bits[i] != 0; },
+                         begin, std::min(end, bits.size()), m_exponentSize, m_mantissaSize, m_data);
+            return;
+        }
 
-                // Process mantissa bits as fractional part.
-                // Each bit j corresponds to a fractional value of 1/2^(j+1)
-                double fraction = 0.5;
-                for (int j = m_exponentSize; j < m_exponentSize + m_mantissaSize; ++j) {
-                    bool bit = std::any_cast<bool>(genome->getValue(i + j));
-                    if (bit) {
-                        mantissaValue += fraction;
-                    }
-                    fraction *= 0.5;
-                }
+        if (auto packed = asGenomeBits(genomeBase)) {
+            auto words = packed->getWords();
+            const size_t size = genomeBase->getSize();
+            decodeBlocks([words, size](size_t i) {
+                return i < size && ((words[i / GenomeBitsView::BitsPerWord] >> (i % GenomeBitsView::BitsPerWord)) & 1) != 0;
+            }, begin, std::min(end, size), m_exponentSize, m_mantissaSize, m_data);
+            return;
+        }
 
-                // Combine the computed exponent and mantissa values.
-                value = static_cast<double>(exponentValue) + mantissaValue;
-                m_data[countDataIndex] = value;
-                ++countDataIndex;
-            }
+        auto genome = dynamic_cast<const Genome1D*>(genomeBase); //TODO check if it's the correct type
+        if (genome->getValue(0).type() == typeid(bool)) { // Check if the genome values are booleans
+            const size_t size = genome->getSize();
+            decodeBlocks([genome, size](size_t i) { return i < size && std::any_cast<bool>(genome->getValue(i)); },
+                         begin, std::min(end, size), m_exponentSize, m_mantissaSize, m_data);
         }
     }
 
@@ -95,6 +126,8 @@ namespace Geneticxx {
     Phenome *PhenomeBoolToDouble::clone() const {
         auto clone = new PhenomeBoolToDouble();
         clone->m_data = this->m_data;
+        clone->m_exponentSize = this->m_exponentSize;
+        clone->m_mantissaSize = this->m_mantissaSize;
         return clone;
     }
 
@@ -20,8 +20,17 @@ namespace Geneticxx {
          * This vector holds the double values that define the phenome.
          */
         std::vector<double> m_data;
-        unsigned int m_exponentSize;
-        unsigned int m_mantissaSize;
+        unsigned int m_exponentSize = 12;
+        unsigned int m_mantissaSize = 20;
+
+        /**
+         * @brief Decodes the values whose blocks of bits overlap the bits in [begin, end).
+         *
+         * @param genome A pointer to the genome object that provides the bits.
+         * @param begin Index of the first bit to decode.
+         * @param end Index one past the last bit to decode.
+         */
+        void decode(const Genome* genome, size_t begin, size_t end);
 
     public:
         /**
@@ -109,6 +118,15 @@ namespace Geneticxx {
          */
         void updatePhenome(const Genome* genome) override;
 
+        /**
+         * @brief Updates only the values whose blocks of bits overlap the modified bits in [begin, end).
+         *
+         * @param genome A pointer to the genome object that provides the data to update the phenome.
+         * @param begin Index of the first modified bit.
+         * @param end Index one past the last modified bit.
+         */
+        void updatePhenomeRange(const Genome* genome, size_t begin, size_t end) override;
+
         /**
          * @brief Creates a new instance of `PhenomeBoolToDouble`.
          *
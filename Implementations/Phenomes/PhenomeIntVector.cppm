@@ -39,6 +39,12 @@ namespace Geneticxx {
     }
 
     void PhenomeIntVector::updatePhenome(const Genome *genomeBase) {
+        if (auto typed = asGenomeView<int>(genomeBase)) {
+            if (this->m_data.size() == typed->getValues().size()) {
+                std::ranges::copy(typed->getValues(), m_data.begin());
+            }
+            return;
+        }
         auto genome = dynamic_cast<const Genome1D*>(genomeBase); //TODO check if it's the correct type
         if (this->m_data.size() != genome->getSize()) {
             return;
@@ -50,6 +56,19 @@ namespace Geneticxx {
             }
     }
 
+    void PhenomeIntVector::updatePhenomeRange(const Genome *genomeBase, size_t begin, size_t end) {
+        auto typed = asGenomeView<int>(genomeBase);
+        if (typed == nullptr || typed->getValues().size() != m_data.size()) {
+            updatePhenome(genomeBase);
+            return;
+        }
+        auto values = typed->getValues();
+        end = std::min(end, values.size());
+        if (begin < end) {
+            std::copy(values.begin() + begin, values.begin() + end, m_data.begin() + begin);
+        }
+    }
+
     Phenome *PhenomeIntVector::createNew() const {
         return new PhenomeIntVector();
     }
@@ -74,6 +93,10 @@ namespace Geneticxx {
         }
     }
 
+    std::span<const int> PhenomeIntVector::getValues() const {
+        return this->m_data;
+    }
+
     int PhenomeIntVector::getSize() const {
         return this->m_data.size();
     }
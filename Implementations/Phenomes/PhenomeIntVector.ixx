@@ -12,7 +12,7 @@ namespace Geneticxx {
      * updating, cloning, and managing the phenome's data, including operations like accessing and modifying specific values
      * in the vector.
      */
-    export class PhenomeIntVector : public Phenome1D {
+    export class PhenomeIntVector : public Phenome1D, public Phenome1DView<int> {
     private:
         /**
          * @brief A vector of integer values representing the phenome's data.
@@ -103,6 +103,15 @@ namespace Geneticxx {
          */
         void updatePhenome(const Genome* genome) override;
 
+        /**
+         * @brief Updates the values copied from the genes in [begin, end).
+         *
+         * @param genome A pointer to the genome object that provides the data to update the phenome.
+         * @param begin Index of the first modified gene.
+         * @param end Index one past the last modified gene.
+         */
+        void updatePhenomeRange(const Genome* genome, size_t begin, size_t end) override;
+
         /**
          * @brief Creates a new instance of `PhenomeIntVector`.
          *
@@ -141,6 +150,13 @@ namespace Geneticxx {
          */
         void setValue(size_t position, std::any value) override;
 
+        /**
+         * @brief Retrieves a read-only view of the phenome's data vector.
+         *
+         * @return Span over the phenome's data.
+         */
+        std::span<const int> getValues() const override;
+
         /**
          * @brief Retrieves the size of the phenome's data vector.
          *
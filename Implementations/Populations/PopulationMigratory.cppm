@@ -2,9 +2,110 @@ module PopulationMigratory;
 
 namespace Geneticxx
 {
-    PopulationMigratory::PopulationMigratory() {
+    MigrationMailbox::~MigrationMailbox() {
+        Parcel *parcel = m_Head.exchange(nullptr);
+        while (parcel != nullptr) {
+            delete std::exchange(parcel, parcel->next);
+        }
+    }
+
+    void MigrationMailbox::post(size_t source, std::vector<std::unique_ptr<Individual>> migrants) {
+        auto parcel = new Parcel{source, std::move(migrants), m_Head.load(std::memory_order_relaxed)};
+        // on failure the current head is written to parcel->next, so the parcel is relinked and retried
+        while (!m_Head.compare_exchange_weak(parcel->next, parcel, std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+        }
+    }
+
+    std::vector<std::unique_ptr<Individual>> MigrationMailbox::collect() {
+        // the whole stack is detached at once, afterwards it is owned by this thread only
+        Parcel *parcel = m_Head.exchange(nullptr, std::memory_order_acquire);
+        std::vector<std::unique_ptr<Parcel>> parcels;
+        while (parcel != nullptr) {
+            parcels.emplace_back(std::exchange(parcel, parcel->next));
+        }
+        // the stack holds the latest parcel first, restore the posting order before ordering by source
+        std::ranges::reverse(parcels);
+        std::ranges::stable_sort(parcels, {}, &Parcel::source);
+
+        std::vector<std::unique_ptr<Individual>> migrants;
+        for (auto &current: parcels) {
+            std::ranges::move(current->migrants, std::back_inserter(migrants));
+        }
+        return migrants;
+    }
+
+    bool MigrationMailbox::empty() const {
+        return m_Head.load(std::memory_order_acquire) == nullptr;
+    }
+
+    PopulationMigratory::PopulationMigratory() : m_Mailbox{std::make_shared<MigrationMailbox>()} {
+    }
+
+    PopulationMigratory::PopulationMigratory(std::shared_ptr<MigrationMailbox> mailbox)
+        : m_Mailbox{std::move(mailbox)} {
     }
 
     PopulationMigratory::~PopulationMigratory() {
     }
-}
\ No newline at end of file
+
+    std::unique_ptr<Population> PopulationMigratory::createNew() const {
+        return std::make_unique<PopulationMigratory>(m_Mailbox);
+    }
+
+    std::unique_ptr<Population> PopulationMigratory::clone() const {
+        auto newPopulation = std::make_unique<PopulationMigratory>();
+        newPopulation->m_Iteration = m_Iteration;
+        newPopulation->m_PopulationVector.resize(m_PopulationVector.size());
+        for (size_t i = 0; i < m_PopulationVector.size(); i++) {
+            if (m_PopulationVector[i]) {
+                newPopulation->m_PopulationVector[i] = std::unique_ptr<Individual>(m_PopulationVector[i]->clone());
+            }
+        }
+        return newPopulation;
+    }
+
+    std::shared_ptr<MigrationMailbox> PopulationMigratory::getMailbox() const {
+        return m_Mailbox;
+    }
+
+    std::vector<std::unique_ptr<Individual>> PopulationMigratory::selectEmigrants(size_t count, bool maximize) {
+        std::vector<size_t> order(m_PopulationVector.size());
+        std::iota(order.begin(), order.end(), 0);
+        count = std::min(count, order.size());
+        std::ranges::partial_sort(order, order.begin() + count, [this, maximize](size_t first, size_t second) {
+            return isBetterMigrant(m_PopulationVector[first].get(), m_PopulationVector[second].get(), maximize);
+        });
+
+        std::vector<std::unique_ptr<Individual>> emigrants;
+        emigrants.reserve(count);
+        for (size_t i = 0; i < count && m_PopulationVector[order[i]]; i++) {
+            emigrants.emplace_back(m_PopulationVector[order[i]]->clone());
+        }
+        return emigrants;
+    }
+
+    size_t PopulationMigratory::immigrate(const MigrationPolicy &policy) {
+        auto migrants = m_Mailbox->collect();
+        const size_t count = std::min({policy.migrants, migrants.size(), m_PopulationVector.size()});
+        if (count == 0) {
+            return 0;
+        }
+        auto better = [&policy](const std::unique_ptr<Individual> &first, const std::unique_ptr<Individual> &second) {
+            return isBetterMigrant(first.get(), second.get(), policy.maximize);
+        };
+        // best migrants first, ties keep the order of the source islands
+        std::ranges::stable_sort(migrants, better);
+
+        std::vector<size_t> order(m_PopulationVector.size());
+        std::iota(order.begin(), order.end(), 0);
+        // worst individuals first
+        std::ranges::partial_sort(order, order.begin() + count, [this, &better](size_t first, size_t second) {
+            return better(m_PopulationVector[second], m_PopulationVector[first]);
+        });
+        for (size_t i = 0; i < count; i++) {
+            setIndividual(order[i], migrants[i].release());
+        }
+        return count;
+    }
+}
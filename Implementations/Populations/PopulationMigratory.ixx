@@ -1,12 +1,214 @@
 export module PopulationMigratory;
 
-import Population;
+export import PopulationSimple;
+import RandomIntFromRange;
+import std;
+import std.compat;
 
 namespace Geneticxx
 {
-	export class PopulationMigratory : public Population {
+	/**
+	 * @brief Describes which islands receive the migrants of an island.
+	 */
+	export enum class MigrationTopology {
+		Ring, ///< Island i sends its migrants to island (i + 1) mod n.
+		FullyConnected, ///< Every island sends its migrants to all other islands.
+		Random ///< Every migration picks one other island at random.
+	};
+
+	/**
+	 * @struct MigrationPolicy
+	 * @brief Settings of the migration between islands.
+	 *
+	 * Every `interval` generations an island sends clones of its best `migrants` individuals to the islands
+	 * given by `topology`. At the start of its next generation each island replaces its worst `migrants`
+	 * individuals with the best `migrants` individuals it received.
+	 */
+	export struct MigrationPolicy {
+		/// Islands receiving the migrants of an island.
+		MigrationTopology topology = MigrationTopology::Ring;
+
+		/// Number of generations between two migrations, 0 disables migration.
+		size_t interval = 10;
+
+		/// Number of individuals sent by an island to each target, and replaced on arrival.
+		size_t migrants = 2;
+
+		/// True if higher fitness is better, false if lower fitness is better.
+		bool maximize = true;
+	};
+
+	/**
+	 * @brief Orders individuals from the best to the worst by fitness, null individuals last.
+	 *
+	 * @param first Individual compared, may be null.
+	 * @param second Individual compared with, may be null.
+	 * @param maximize True if higher fitness is better, false if lower fitness is better.
+	 * @return True if `first` is strictly better than `second`.
+	 */
+	export inline bool isBetterMigrant(const Individual *first, const Individual *second, bool maximize) {
+		if (first == nullptr || second == nullptr) {
+			return second == nullptr && first != nullptr;
+		}
+		return maximize ? first->getFitness() > second->getFitness() : first->getFitness() < second->getFitness();
+	}
+
+	/**
+	 * @brief Returns the indices of the islands receiving the migrants of an island.
+	 *
+	 * @param topology Topology connecting the islands.
+	 * @param island Index of the sending island.
+	 * @param islands Number of islands.
+	 * @param genInt Generator drawing the target of the random topology, unused by the other topologies.
+	 * @return Indices of the target islands, empty if there is no other island.
+	 */
+	export inline std::vector<size_t> migrationTargets(MigrationTopology topology, size_t island, size_t islands,
+	                                                   RandomIntFromRange *genInt) {
+		std::vector<size_t> targets;
+		if (islands < 2) {
+			return targets;
+		}
+		switch (topology) {
+			case MigrationTopology::Ring:
+				targets.push_back((island + 1) % islands);
+				break;
+			case MigrationTopology::FullyConnected:
+				for (size_t target = 0; target < islands; target++) {
+					if (target != island) {
+						targets.push_back(target);
+					}
+				}
+				break;
+			case MigrationTopology::Random: {
+				// draw among the other islands, skipping the island itself
+				const size_t target = genInt->generate(0, static_cast<int>(islands) - 2);
+				targets.push_back(target >= island ? target + 1 : target);
+				break;
+			}
+		}
+		return targets;
+	}
+
+	/**
+	 * @class MigrationMailbox
+	 * @brief Lock-free mailbox receiving migrants sent to an island by other islands.
+	 *
+	 * Any number of islands may `post` concurrently, while the owning island `collect`s the whole content at
+	 * once. Parcels are kept in an intrusive stack updated with compare-and-swap; collecting detaches the whole
+	 * stack with a single exchange, so no parcel is ever removed while another thread reads it.
+	 */
+	export class MigrationMailbox {
+	private:
+		/// Migrants sent by one island in one migration.
+		struct Parcel {
+			size_t source;
+			std::vector<std::unique_ptr<Individual>> migrants;
+			Parcel *next;
+		};
+
+		/// Most recently posted parcel, linked to the earlier ones.
+		std::atomic<Parcel *> m_Head{nullptr};
+
+	public:
+		MigrationMailbox() = default;
+
+		MigrationMailbox(const MigrationMailbox &) = delete;
+
+		MigrationMailbox &operator=(const MigrationMailbox &) = delete;
+
+		/**
+		 * @brief Destroys the mailbox together with the migrants that were never collected.
+		 */
+		~MigrationMailbox();
+
+		/**
+		 * @brief Adds migrants to the mailbox. Safe to call concurrently with `post` and `collect`.
+		 *
+		 * @param source Index of the sending island, used to order the migrants deterministically.
+		 * @param migrants Individuals sent to the island.
+		 */
+		void post(size_t source, std::vector<std::unique_ptr<Individual>> migrants);
+
+		/**
+		 * @brief Removes and returns all migrants posted so far, ordered by the index of their source island.
+		 *
+		 * @return The migrants, empty if nothing was posted since the last call.
+		 */
+		std::vector<std::unique_ptr<Individual>> collect();
+
+		/**
+		 * @brief Checks whether any migrants are waiting in the mailbox.
+		 *
+		 * @return True if nothing was posted since the last `collect`.
+		 */
+		bool empty() const;
+	};
+
+	/**
+	 * @class PopulationMigratory
+	 * @brief Population of a single island of the island model.
+	 *
+	 * Stores its individuals like `PopulationSimple` and additionally owns the mailbox through which other islands
+	 * send it migrants. Populations obtained from `createNew` share the mailbox of the population they were created
+	 * from, so the offspring populations of an island, e.g. double-buffered ones, keep receiving its migrants.
+	 * `clone` creates an independent population with an empty mailbox.
+	 */
+	export class PopulationMigratory : public PopulationSimple {
+	private:
+		/// Mailbox of the island, shared with the populations created by `createNew`.
+		std::shared_ptr<MigrationMailbox> m_Mailbox;
+
 	public:
 		PopulationMigratory();
+
+		/**
+		 * @brief Creates a population receiving migrants through the given mailbox.
+		 *
+		 * @param mailbox Mailbox of the island the population belongs to.
+		 */
+		explicit PopulationMigratory(std::shared_ptr<MigrationMailbox> mailbox);
+
 		~PopulationMigratory() override;
+
+		/**
+		 * @brief Creates an empty population of the same island, sharing the mailbox.
+		 *
+		 * @return A unique pointer to the new population.
+		 */
+		[[nodiscard]] std::unique_ptr<Population> createNew() const override;
+
+		/**
+		 * @brief Creates a deep copy of the individuals with a new, empty mailbox.
+		 *
+		 * @return A unique pointer to the copy.
+		 */
+		[[nodiscard]] std::unique_ptr<Population> clone() const override;
+
+		/**
+		 * @brief Returns the mailbox of the island, through which other islands send it migrants.
+		 *
+		 * @return Shared pointer to the mailbox.
+		 */
+		std::shared_ptr<MigrationMailbox> getMailbox() const;
+
+		/**
+		 * @brief Returns clones of the best individuals of the population.
+		 *
+		 * @param count Number of individuals to return, at most the size of the population.
+		 * @param maximize True if higher fitness is better, false if lower fitness is better.
+		 * @return Clones of the best individuals, the best first.
+		 */
+		std::vector<std::unique_ptr<Individual>> selectEmigrants(size_t count, bool maximize);
+
+		/**
+		 * @brief Replaces the worst individuals with the best migrants waiting in the mailbox.
+		 *
+		 * At most `policy.migrants` individuals are replaced, and never more than the number of migrants
+		 * received. Migrants keep the objective scores and fitness they had on their home island.
+		 *
+		 * @param policy Migration policy providing the number of replaced individuals and the fitness order.
+		 * @return Number of replaced individuals.
+		 */
+		size_t immigrate(const MigrationPolicy &policy);
 	};
-}
\ No newline at end of file
+}
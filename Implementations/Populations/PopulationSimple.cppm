@@ -35,6 +35,7 @@ namespace Geneticxx {
         }
       }
       m_PopulationVector = std::move(newVector);
+      m_Version++;
     }
     return *this;
   }
@@ -44,6 +45,8 @@ namespace Geneticxx {
       m_Iteration = other.m_Iteration;
       m_PopulationVector = std::move(other.m_PopulationVector);
       other.m_Iteration = 0;
+      m_Version++;
+      other.m_Version++;
     }
     return *this;
   }
@@ -67,6 +70,23 @@ namespace Geneticxx {
 
   void PopulationSimple::setIndividual(size_t i, Individual *individual) {
     this->m_PopulationVector[i] = std::unique_ptr<Individual>(individual);
+    m_Version++;
+  }
+
+  Individual *PopulationSimple::releaseIndividual(size_t i) {
+    m_Version++;
+    return this->m_PopulationVector[i].release();
+  }
+
+  bool PopulationSimple::swapIndividuals(Population *other) {
+    auto same = dynamic_cast<PopulationSimple *>(other);
+    if (same == nullptr) {
+      return false;
+    }
+    std::swap(m_PopulationVector, same->m_PopulationVector);
+    m_Version++;
+    same->m_Version++;
+    return true;
   }
 
   /// TODO: simple addIndividual? (simple push_back)
@@ -86,13 +106,20 @@ namespace Geneticxx {
 
   void PopulationSimple::increaseIteration() {
     this->m_Iteration++;
+    m_Version++;
   }
 
   void PopulationSimple::resize(size_t size) {
     m_PopulationVector.resize(size);
+    m_Version++;
   }
 
   void PopulationSimple::clear() {
     m_PopulationVector.clear();
+    m_Version++;
+  }
+
+  size_t PopulationSimple::getVersion() const {
+    return m_Version;
   }
 }
@@ -29,6 +29,13 @@ namespace Geneticxx {
          */
         std::vector<std::unique_ptr<Individual>> m_PopulationVector;
 
+        /**
+         * @brief Counter increased on every change of the set of individuals, returned by `getVersion`.
+         *
+         * Atomic, as distinct slots may be set concurrently, e.g. during parallel breeding.
+         */
+        std::atomic<size_t> m_Version{0};
+
     public:
         /**
          * @brief Default constructor.
@@ -125,6 +132,22 @@ namespace Geneticxx {
          */
         void setIndividual(size_t i, Individual* individual) override;
 
+        /**
+         * @brief Takes an individual out of the population without copying it.
+         *
+         * @param i The index of the individual to take; the slot is left empty.
+         * @return A pointer to the `Individual`, owned by the caller.
+         */
+        Individual* releaseIndividual(size_t i) override;
+
+        /**
+         * @brief Exchanges the vectors of individuals with another `PopulationSimple` in O(1).
+         *
+         * @param other The population to exchange the individuals with.
+         * @return True if `other` is a `PopulationSimple`, false otherwise.
+         */
+        bool swapIndividuals(Population* other) override;
+
         /**
          * @brief Retrieves the size of the population.
          *
@@ -165,5 +188,13 @@ namespace Geneticxx {
          * This method removes all individuals from the population, resetting it to an empty state.
          */
         void clear() override;
+
+        /**
+         * @brief Returns the version of the population.
+         *
+         * @return A number increased whenever an individual is set or the population is resized, cleared
+         *         or advanced to the next iteration.
+         */
+        size_t getVersion() const override;
     };
 }
@@ -0,0 +1,472 @@
+export module PopulationSoA;
+
+export import Population;
+export import Phenome1D;
+import GenomeVector;
+import IndividualSimple;
+import std;
+import std.compat;
+
+namespace Geneticxx {
+    export template<typename T>
+    class PopulationSoA;
+
+    /**
+     * @class GenomeSoARow
+     * @brief Genome viewing one row of the gene column of a `PopulationSoA`.
+     *
+     * The row does not own any genes: reads and writes go straight to the population's contiguous buffer.
+     * `clone` and `createNew` return standalone `GenomeVector<T>` objects, so genomes taken out of the
+     * population by operators (e.g. crossover children) are independent of it.
+     */
+    template<typename T>
+    class GenomeSoARow : public Genome1D, public Genome1DView<T> {
+    private:
+        PopulationSoA<T> *m_population;
+        size_t m_index;
+
+    public:
+        GenomeSoARow(PopulationSoA<T> *population, size_t index) : m_population{population}, m_index{index} {
+        }
+
+        ~GenomeSoARow() override = default;
+
+        std::unique_ptr<Genome> createNew() const override {
+            return std::make_unique<GenomeVector<T> >(getSize());
+        }
+
+        std::unique_ptr<Genome> clone() const override {
+            auto values = getValues();
+            return std::make_unique<GenomeVector<T> >(std::vector<T>(values.begin(), values.end()));
+        }
+
+        size_t getSize() const override {
+            return m_population->getGenomeLength();
+        }
+
+        /**
+         * @brief Fraction of positions at which the two genomes differ, 1 if they cannot be compared.
+         */
+        double distance(Genome *otherBase) const override {
+            auto other = dynamic_cast<const Genome1DView<T> *>(otherBase);
+            if (other == nullptr || other->getValues().size() != getSize() || getSize() == 0) {
+                return 1;
+            }
+            auto values = getValues();
+            auto otherValues = other->getValues();
+            size_t different = 0;
+            for (size_t i = 0; i < values.size(); i++) {
+                different += values[i] != otherValues[i];
+            }
+            return static_cast<double>(different) / static_cast<double>(values.size());
+        }
+
+        std::any getValue(size_t position) const override {
+            return static_cast<T>(getValues()[position]);
+        }
+
+        void setValue(size_t position, std::any value) override {
+            getValues()[position] = std::any_cast<T>(value);
+        }
+
+        std::optional<std::size_t> hash() const override {
+            return hashValues(getValues());
+        }
+
+        /**
+         * @brief Copies the genes of a genome of the same type and length into the row.
+         */
+        bool assign(const Genome *other) override {
+            auto typed = asGenomeView<T>(other);
+            if (typed == nullptr || typed->getValues().size() != getSize()) {
+                return false;
+            }
+            std::ranges::copy(typed->getValues(), getValues().begin());
+            return true;
+        }
+
+        std::span<const GeneStorage<T> > getValues() const override {
+            return m_population->getGenes(m_index);
+        }
+
+        std::span<GeneStorage<T> > getValues() override {
+            return m_population->getGenes(m_index);
+        }
+
+        bool operator==(Genome *otherBase) const override {
+            if (auto other = dynamic_cast<const Genome1DView<T> *>(otherBase)) {
+                return std::ranges::equal(getValues(), other->getValues());
+            }
+            auto other = dynamic_cast<Genome1D *>(otherBase);
+            if (other == nullptr || other->getSize() != getSize()) {
+                return false;
+            }
+            for (size_t i = 0; i < getSize(); i++) {
+                if (std::any_cast<T>(other->getValue(i)) != std::any_cast<T>(getValue(i))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    /**
+     * @class IndividualSoARow
+     * @brief Individual viewing one row of a `PopulationSoA`.
+     *
+     * Fitness, objective scores and genes are read from and written to the population's column buffers.
+     * The phenome is the only per-individual object and is owned by the population. `clone` returns a
+     * standalone `IndividualSimple`, so individuals taken out of the population do not depend on it.
+     */
+    template<typename T>
+    class IndividualSoARow : public Individual {
+    private:
+        PopulationSoA<T> *m_population;
+        size_t m_index;
+        GenomeSoARow<T> m_genome;
+
+    public:
+        IndividualSoARow(PopulationSoA<T> *population, size_t index)
+            : m_population{population}, m_index{index}, m_genome{population, index} {
+        }
+
+        ~IndividualSoARow() override = default;
+
+        Individual *createNew() const override {
+            return new IndividualSimple();
+        }
+
+        Individual *clone() const override {
+            auto phenome = getPhenome();
+            auto individual = new IndividualSimple(phenome ? phenome->clone() : nullptr, m_genome.clone().release());
+            individual->setFitness(getFitness());
+            auto scores = getObjectiveScore();
+            individual->setObjectiveScore(&scores);
+            return individual;
+        }
+
+        double getFitness() const override {
+            return m_population->getFitnessValues()[m_index];
+        }
+
+        void setFitness(double fitness) override {
+            m_population->setFitness(m_index, fitness);
+        }
+
+        std::vector<double> getObjectiveScore() const override {
+            auto scores = m_population->getObjectiveScores(m_index);
+            return {scores.begin(), scores.end()};
+        }
+
+        /**
+         * @brief Stores the objective scores in the population's score column.
+         *
+         * @throws std::invalid_argument if the number of scores differs from the population's number of objectives.
+         */
+        void setObjectiveScore(std::vector<double> *objectiveScore) override {
+            auto scores = m_population->getObjectiveScores(m_index);
+            if (objectiveScore == nullptr) {
+                std::ranges::fill(scores, 0.0);
+                return;
+            }
+            if (objectiveScore->size() != scores.size()) {
+                throw std::invalid_argument("Number of objective scores does not match the population's layout");
+            }
+            std::ranges::copy(*objectiveScore, scores.begin());
+        }
+
+        void updatePhenome() override {
+            if (auto phenome = m_population->getPhenome(m_index)) {
+                phenome->updatePhenome(&m_genome);
+            }
+        }
+
+        const Genome *getGenome() const override {
+            return &m_genome;
+        }
+
+        Genome *getGenome() override {
+            return &m_genome;
+        }
+
+        /**
+         * @brief Copies the genes of `genome` into the population and deletes it.
+         */
+        void setGenome(Genome *genome) override {
+            std::unique_ptr<Genome> owned{genome};
+            m_population->assignGenes(m_index, owned.get());
+        }
+
+        const Phenome *getPhenome() const override {
+            return m_population->getPhenome(m_index);
+        }
+
+        void setPhenome(Phenome *phenome) override {
+            m_population->setPhenome(m_index, phenome);
+        }
+    };
+
+    /**
+     * @class PopulationSoA
+     * @brief A population storing its individuals as a structure of arrays.
+     *
+     * Instead of one heap object per individual, each holding its own genome, phenome and objective score
+     * vector, `PopulationSoA` keeps fitness, objective scores and fixed-length genes in three contiguous
+     * column buffers. Individuals returned by `getIndividual` are lightweight views of a row, created once
+     * per slot, so the population can be used through the regular `Population` interface by every operator.
+     * Fitness is additionally exposed through `PopulationFitnessView`, which lets selectors and statistics
+     * scan it as a flat array.
+     *
+     * Individuals passed to `setIndividual` are copied into the columns and deleted; their phenome is only
+     * cloned if the slot has none yet, otherwise the slot's phenome is updated from the copied genes.
+     * Writes to distinct slots are independent, so dispatchers may evaluate individuals concurrently.
+     *
+     * @tparam T Type of the genes.
+     */
+    export template<typename T>
+    class PopulationSoA : public Population, public PopulationFitnessView {
+    private:
+        size_t m_Iteration = 0;
+        std::atomic<size_t> m_Version{0};
+        size_t m_GenomeLength;
+        size_t m_ObjectivesNumber;
+
+        /// Prototype of the phenome created for every new slot, may be null.
+        std::unique_ptr<Phenome> m_PhenomePrototype;
+
+        std::vector<double> m_Fitness;
+        std::vector<double> m_ObjectiveScores;
+        std::vector<GeneStorage<T> > m_Genes;
+        std::vector<std::unique_ptr<Phenome> > m_Phenomes;
+
+        /// Row views handed out by getIndividual, their addresses stay stable while the population lives.
+        std::vector<std::unique_ptr<IndividualSoARow<T> > > m_Rows;
+
+        /// Adds or drops row views so that there is one for every slot of the columns.
+        void synchronizeRows() {
+            const size_t oldSize = m_Rows.size();
+            m_Rows.resize(getSize());
+            for (size_t i = oldSize; i < m_Rows.size(); i++) {
+                m_Rows[i] = std::make_unique<IndividualSoARow<T> >(this, i);
+            }
+        }
+
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param genomeLength Number of genes of every individual.
+         * @param objectivesNumber Number of objective scores stored for every individual.
+         * @param phenomePrototype Phenome cloned into every new slot; ownership is taken. May be null.
+         */
+        explicit PopulationSoA(size_t genomeLength, size_t objectivesNumber = 1, Phenome *phenomePrototype = nullptr)
+            : m_GenomeLength{genomeLength}, m_ObjectivesNumber{objectivesNumber},
+              m_PhenomePrototype{phenomePrototype} {
+        }
+
+        PopulationSoA(const PopulationSoA &) = delete;
+
+        PopulationSoA &operator=(const PopulationSoA &) = delete;
+
+        ~PopulationSoA() override = default;
+
+        [[nodiscard]] std::unique_ptr<Population> createNew() const override {
+            return std::make_unique<PopulationSoA>(m_GenomeLength, m_ObjectivesNumber,
+                                                   m_PhenomePrototype ? m_PhenomePrototype->clone() : nullptr);
+        }
+
+        [[nodiscard]] std::unique_ptr<Population> clone() const override {
+            auto population = std::make_unique<PopulationSoA>(m_GenomeLength, m_ObjectivesNumber,
+                                                              m_PhenomePrototype
+                                                                  ? m_PhenomePrototype->clone()
+                                                                  : nullptr);
+            population->resize(getSize());
+            population->m_Iteration = m_Iteration;
+            population->m_Fitness = m_Fitness;
+            population->m_ObjectiveScores = m_ObjectiveScores;
+            population->m_Genes = m_Genes;
+            for (size_t i = 0; i < m_Phenomes.size(); i++) {
+                population->m_Phenomes[i].reset(m_Phenomes[i] ? m_Phenomes[i]->clone() : nullptr);
+            }
+            return population;
+        }
+
+        Individual *getIndividual(size_t i) override {
+            return m_Rows[i].get();
+        }
+
+        /**
+         * @brief Copies the individual into slot `i` and deletes it.
+         *
+         * The population grows if `i` is past its end.
+         *
+         * @throws std::invalid_argument if the individual's genome length or number of objective scores does not
+         *         match the population's layout.
+         */
+        void setIndividual(size_t i, Individual *individual) override {
+            if (i >= getSize()) {
+                resize(i + 1);
+            }
+            if (individual == m_Rows[i].get()) {
+                return;
+            }
+            std::unique_ptr<Individual> owned{individual};
+            m_Version++;
+            m_Fitness[i] = owned->getFitness();
+            auto scores = owned->getObjectiveScore();
+            m_Rows[i]->setObjectiveScore(&scores);
+            assignGenes(i, owned->getGenome());
+            if (m_Phenomes[i]) {
+                m_Phenomes[i]->updatePhenome(m_Rows[i]->getGenome());
+            } else if (auto phenome = owned->getPhenome()) {
+                m_Phenomes[i].reset(phenome->clone());
+            }
+        }
+
+        size_t getSize() const override {
+            return m_Fitness.size();
+        }
+
+        size_t getIteration() const override {
+            return m_Iteration;
+        }
+
+        void increaseIteration() override {
+            m_Iteration++;
+            m_Version++;
+        }
+
+        size_t getVersion() const override {
+            return m_Version;
+        }
+
+        /**
+         * @brief Resizes all columns; new slots get zeroed values and a copy of the phenome prototype.
+         */
+        void resize(size_t size) override {
+            const size_t oldSize = getSize();
+            m_Version++;
+            m_Fitness.resize(size, 0.0);
+            m_ObjectiveScores.resize(size * m_ObjectivesNumber, 0.0);
+            m_Genes.resize(size * m_GenomeLength);
+            m_Phenomes.resize(size);
+            m_Rows.resize(size);
+            for (size_t i = oldSize; i < size; i++) {
+                if (m_PhenomePrototype) {
+                    m_Phenomes[i].reset(m_PhenomePrototype->clone());
+                }
+                m_Rows[i] = std::make_unique<IndividualSoARow<T> >(this, i);
+            }
+        }
+
+        void clear() override {
+            resize(0);
+        }
+
+        /**
+         * @brief Exchanges the columns with another `PopulationSoA` of the same layout in O(1).
+         *
+         * Row views stay bound to their population, rows are only added or dropped where the size changes.
+         *
+         * @return True if `other` is a `PopulationSoA` with the same genome length and number of objectives.
+         */
+        bool swapIndividuals(Population *other) override {
+            auto same = dynamic_cast<PopulationSoA *>(other);
+            if (same == nullptr || same->m_GenomeLength != m_GenomeLength ||
+                same->m_ObjectivesNumber != m_ObjectivesNumber) {
+                return false;
+            }
+            if (same == this) {
+                return true;
+            }
+            std::swap(m_Fitness, same->m_Fitness);
+            std::swap(m_ObjectiveScores, same->m_ObjectiveScores);
+            std::swap(m_Genes, same->m_Genes);
+            std::swap(m_Phenomes, same->m_Phenomes);
+            synchronizeRows();
+            same->synchronizeRows();
+            m_Version++;
+            same->m_Version++;
+            return true;
+        }
+
+        std::span<const double> getFitnessValues() const override {
+            return m_Fitness;
+        }
+
+        /**
+         * @brief Sets the fitness of the individual in slot `i`.
+         */
+        void setFitness(size_t i, double fitness) {
+            m_Fitness[i] = fitness;
+        }
+
+        /**
+         * @brief Returns the genes of the individual in slot `i`.
+         */
+        std::span<GeneStorage<T> > getGenes(size_t i) {
+            return std::span<GeneStorage<T> >(m_Genes).subspan(i * m_GenomeLength, m_GenomeLength);
+        }
+
+        /**
+         * @brief Returns the objective scores of the individual in slot `i`.
+         */
+        std::span<double> getObjectiveScores(size_t i) {
+            return std::span<double>(m_ObjectiveScores).subspan(i * m_ObjectivesNumber, m_ObjectivesNumber);
+        }
+
+        /**
+         * @brief Returns the phenome of the individual in slot `i`, may be null.
+         */
+        Phenome *getPhenome(size_t i) {
+            return m_Phenomes[i].get();
+        }
+
+        /**
+         * @brief Replaces the phenome of the individual in slot `i`, taking ownership of it.
+         */
+        void setPhenome(size_t i, Phenome *phenome) {
+            m_Phenomes[i].reset(phenome);
+        }
+
+        /**
+         * @brief Copies the genes of `genome` into slot `i`.
+         *
+         * Genomes exposing `Genome1DView<T>` are copied in bulk, other one-dimensional genomes value by value.
+         *
+         * @throws std::invalid_argument if the genome is not one-dimensional or its length differs from the
+         *         population's genome length.
+         */
+        void assignGenes(size_t i, const Genome *genome) {
+            auto genes = getGenes(i);
+            if (genome == nullptr || genome->getSize() != m_GenomeLength) {
+                throw std::invalid_argument("Genome length does not match the population's layout");
+            }
+            if (auto typed = asGenomeView<T>(genome)) {
+                std::ranges::copy(typed->getValues(), genes.begin());
+                return;
+            }
+            auto genome1D = dynamic_cast<const Genome1D *>(genome);
+            if (genome1D == nullptr) {
+                throw std::invalid_argument("PopulationSoA can only store one-dimensional genomes");
+            }
+            for (size_t j = 0; j < m_GenomeLength; j++) {
+                genes[j] = std::any_cast<T>(genome1D->getValue(j));
+            }
+        }
+
+        /**
+         * @brief Returns the number of genes of every individual.
+         */
+        size_t getGenomeLength() const {
+            return m_GenomeLength;
+        }
+
+        /**
+         * @brief Returns the number of objective scores stored for every individual.
+         */
+        size_t getObjectivesNumber() const {
+            return m_ObjectivesNumber;
+        }
+    };
+}
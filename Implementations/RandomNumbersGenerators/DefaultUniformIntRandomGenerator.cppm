@@ -10,4 +10,22 @@ namespace Geneticxx {
     int DefaultUniformIntRandomGenerator::generate(int min, int max) {
         return distribution(engine, std::uniform_int_distribution<>::param_type(min, max)); // TODO: check if it is not creating excessive overhead
     }
+
+    void DefaultUniformIntRandomGenerator::generateBits(std::span<std::uint64_t> words) {
+        std::uniform_int_distribution<std::uint64_t> bits;
+        for (auto &word: words) {
+            word = bits(engine);
+        }
+    }
+
+    std::unique_ptr<RandomIntFromRange> DefaultUniformIntRandomGenerator::split(std::uint64_t streamId) const {
+        return std::make_unique<DefaultUniformIntRandomGenerator>(
+            static_cast<unsigned int>(splitMix64(splitMix64(m_seed) + streamId)));
+    }
+
+    bool DefaultUniformIntRandomGenerator::reseed(std::uint64_t streamId) {
+        engine.seed(static_cast<unsigned int>(splitMix64(splitMix64(m_seed) + streamId)));
+        distribution.reset();
+        return true;
+    }
 }
@@ -49,5 +49,28 @@ namespace Geneticxx {
          * @return A randomly generated integer between `min` and `max`.
          */
         int generate(int min, int max) override;
+
+        using RandomIntFromRange::generate;
+
+        /**
+         * @brief Draws every word with one call to the engine's 64-bit distribution.
+         */
+        void generateBits(std::span<std::uint64_t> words) override;
+
+        /**
+         * @brief Creates a generator seeded from this generator's seed and the stream identifier.
+         *
+         * The standard engine has no notion of streams, so the streams are only as independent as two
+         * differently seeded engines; use the Philox generators where independence matters.
+         *
+         * @param streamId Identifier of the stream.
+         * @return A new `DefaultUniformIntRandomGenerator`.
+         */
+        [[nodiscard]] std::unique_ptr<RandomIntFromRange> split(std::uint64_t streamId) const override;
+
+        /**
+         * @brief Reseeds the engine like `split` seeds the new generator.
+         */
+        bool reseed(std::uint64_t streamId) override;
     };
 }
@@ -10,4 +10,15 @@ namespace Geneticxx {
     double DefaultUniformRealRandomGenerator::generate(double min, double max) {
         return distribution(engine, std::uniform_real_distribution<>::param_type(min, max)); // TODO: check if it is not creating excessive overhead
     }
+
+    std::unique_ptr<RandomRealFromRange> DefaultUniformRealRandomGenerator::split(std::uint64_t streamId) const {
+        return std::make_unique<DefaultUniformRealRandomGenerator>(
+            static_cast<unsigned int>(splitMix64(splitMix64(m_seed) + streamId)));
+    }
+
+    bool DefaultUniformRealRandomGenerator::reseed(std::uint64_t streamId) {
+        engine.seed(static_cast<unsigned int>(splitMix64(splitMix64(m_seed) + streamId)));
+        distribution.reset();
+        return true;
+    }
 }
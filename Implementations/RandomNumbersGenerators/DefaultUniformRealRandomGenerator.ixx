@@ -49,5 +49,23 @@ namespace Geneticxx {
          * @return A randomly generated real number between `min` and `max`.
          */
         double generate(double min, double max) override;
+
+        using RandomRealFromRange::generate;
+
+        /**
+         * @brief Creates a generator seeded from this generator's seed and the stream identifier.
+         *
+         * The standard engine has no notion of streams, so the streams are only as independent as two
+         * differently seeded engines; use the Philox generators where independence matters.
+         *
+         * @param streamId Identifier of the stream.
+         * @return A new `DefaultUniformRealRandomGenerator`.
+         */
+        [[nodiscard]] std::unique_ptr<RandomRealFromRange> split(std::uint64_t streamId) const override;
+
+        /**
+         * @brief Reseeds the engine like `split` seeds the new generator.
+         */
+        bool reseed(std::uint64_t streamId) override;
     };
 }
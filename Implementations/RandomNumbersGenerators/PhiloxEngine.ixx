@@ -0,0 +1,170 @@
+export module PhiloxEngine;
+
+import std;
+import std.compat;
+export import RandomIntFromRange;
+
+namespace Geneticxx {
+    /**
+     * @class PhiloxEngine
+     * @brief Counter-based Philox4x32-10 random bit engine (Salmon et al., "Parallel random numbers: as easy as
+     * 1, 2, 3").
+     *
+     * Every output block is a keyed bijection of a 128-bit counter, so the engine has no state besides the key and
+     * the counter. The key is the seed, the upper half of the counter is the stream and the lower half counts the
+     * blocks drawn, so every seed has 2^64 independent streams of 2^64 blocks each. Splitting a stream is just
+     * computing a new stream identifier, and jumping ahead is setting the counter.
+     *
+     * Satisfies `std::uniform_random_bit_generator`, so it can also drive the standard distributions.
+     */
+    export class PhiloxEngine {
+    public:
+        using result_type = std::uint64_t;
+        /// One output block of four 32-bit words.
+        using Block = std::array<std::uint32_t, 4>;
+
+    private:
+        static constexpr std::uint32_t Multiplier0 = 0xD2511F53u;
+        static constexpr std::uint32_t Multiplier1 = 0xCD9E8D57u;
+        static constexpr std::uint32_t Weyl0 = 0x9E3779B9u;
+        static constexpr std::uint32_t Weyl1 = 0xBB67AE85u;
+
+        std::uint64_t m_Seed; ///< Key of the bijection.
+        std::uint64_t m_Stream; ///< Upper half of the counter.
+        std::uint64_t m_Position = 0; ///< Lower half of the counter, the index of the next block.
+        Block m_Buffer{}; ///< Last block drawn.
+        unsigned m_Used = 4; ///< Number of words of the buffer already returned.
+
+        void refill() {
+            m_Buffer = block(m_Seed, m_Stream, m_Position++);
+            m_Used = 0;
+        }
+
+    public:
+        /**
+         * @brief Creates the engine at the start of a stream.
+         *
+         * @param seed Key of the engine.
+         * @param stream Stream of the key to draw from.
+         */
+        explicit PhiloxEngine(std::uint64_t seed = 0, std::uint64_t stream = 0) : m_Seed{seed}, m_Stream{stream} {
+        }
+
+        /**
+         * @brief Computes one block of the Philox4x32-10 bijection.
+         *
+         * @param seed Key of the bijection.
+         * @param stream Upper half of the counter.
+         * @param position Lower half of the counter.
+         * @return The four words of the block.
+         */
+        static constexpr Block block(std::uint64_t seed, std::uint64_t stream, std::uint64_t position) {
+            Block counter{
+                static_cast<std::uint32_t>(position), static_cast<std::uint32_t>(position >> 32),
+                static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)
+            };
+            std::uint32_t key0 = static_cast<std::uint32_t>(seed);
+            std::uint32_t key1 = static_cast<std::uint32_t>(seed >> 32);
+            for (int round = 0; round < 10; round++) {
+                if (round > 0) {
+                    key0 += Weyl0;
+                    key1 += Weyl1;
+                }
+                const std::uint64_t product0 = std::uint64_t{Multiplier0} * counter[0];
+                const std::uint64_t product1 = std::uint64_t{Multiplier1} * counter[2];
+                counter = {
+                    static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key0,
+                    static_cast<std::uint32_t>(product1),
+                    static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key1,
+                    static_cast<std::uint32_t>(product0)
+                };
+            }
+            return counter;
+        }
+
+        static constexpr result_type min() {
+            return 0;
+        }
+
+        static constexpr result_type max() {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        /**
+         * @brief Draws 64 random bits.
+         */
+        result_type operator()() {
+            const std::uint64_t low = next32();
+            return low | std::uint64_t{next32()} << 32;
+        }
+
+        /**
+         * @brief Draws 32 random bits.
+         */
+        std::uint32_t next32() {
+            if (m_Used == 4) {
+                refill();
+            }
+            return m_Buffer[m_Used++];
+        }
+
+        /**
+         * @brief Fills a buffer with random 64-bit words.
+         *
+         * Equivalent to calling the engine once per word, but whole blocks are written directly.
+         *
+         * @param words Buffer to fill.
+         */
+        void fill(std::span<std::uint64_t> words) {
+            size_t index = 0;
+            while (index < words.size() && m_Used != 4) {
+                words[index++] = (*this)();
+            }
+            for (; index + 2 <= words.size(); index += 2) {
+                const Block drawn = block(m_Seed, m_Stream, m_Position++);
+                words[index] = drawn[0] | std::uint64_t{drawn[1]} << 32;
+                words[index + 1] = drawn[2] | std::uint64_t{drawn[3]} << 32;
+            }
+            if (index < words.size()) {
+                words[index] = (*this)();
+            }
+        }
+
+        /**
+         * @brief Skips the given number of blocks, i.e. `4 * blocks` 32-bit words after the current block.
+         *
+         * @param blocks Number of blocks to skip.
+         */
+        void discardBlocks(std::uint64_t blocks) {
+            m_Position += blocks;
+            m_Used = 4;
+        }
+
+        /**
+         * @brief Creates the engine of an independent stream derived from this one.
+         *
+         * The stream only depends on this engine's seed and stream and on `streamId`, never on how much was drawn,
+         * and this engine is not advanced. Distinct identifiers give distinct streams.
+         *
+         * @param streamId Identifier of the derived stream, e.g. the index of a thread or an island.
+         * @return Engine at the start of the derived stream.
+         */
+        [[nodiscard]] PhiloxEngine split(std::uint64_t streamId) const {
+            return PhiloxEngine{m_Seed, splitMix64(m_Stream + splitMix64(streamId))};
+        }
+
+        /**
+         * @brief Returns the key of the engine.
+         */
+        std::uint64_t getSeed() const {
+            return m_Seed;
+        }
+
+        /**
+         * @brief Returns the stream the engine draws from.
+         */
+        std::uint64_t getStream() const {
+            return m_Stream;
+        }
+    };
+}
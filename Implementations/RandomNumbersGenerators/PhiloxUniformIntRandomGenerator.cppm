@@ -0,0 +1,62 @@
+module PhiloxUniformIntRandomGenerator;
+
+namespace Geneticxx {
+    namespace {
+        /// Draws uniformly from [min, max] with Lemire's nearly divisionless method.
+        int drawBounded(PhiloxEngine &engine, int min, int max) {
+            const std::uint64_t range = static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min) + 1;
+            std::uint32_t word = engine.next32();
+            if (range > std::numeric_limits<std::uint32_t>::max()) {
+                return static_cast<int>(static_cast<std::int64_t>(min) + word);
+            }
+            const auto bound = static_cast<std::uint32_t>(range);
+            std::uint64_t product = std::uint64_t{word} * bound;
+            if (static_cast<std::uint32_t>(product) < bound) {
+                const std::uint32_t threshold = (0u - bound) % bound;
+                while (static_cast<std::uint32_t>(product) < threshold) {
+                    word = engine.next32();
+                    product = std::uint64_t{word} * bound;
+                }
+            }
+            return static_cast<int>(static_cast<std::int64_t>(min) + static_cast<std::int64_t>(product >> 32));
+        }
+    }
+
+    PhiloxUniformIntRandomGenerator::PhiloxUniformIntRandomGenerator(unsigned int seed, std::uint64_t stream)
+        : RandomIntFromRange{seed}, m_Engine{seed, stream}, m_Origin{m_Engine} {
+    }
+
+    PhiloxUniformIntRandomGenerator::PhiloxUniformIntRandomGenerator(const PhiloxEngine &engine)
+        : RandomIntFromRange{static_cast<unsigned int>(engine.getSeed())}, m_Engine{engine}, m_Origin{engine} {
+    }
+
+    PhiloxUniformIntRandomGenerator::~PhiloxUniformIntRandomGenerator() {
+    }
+
+    int PhiloxUniformIntRandomGenerator::generate(int min, int max) {
+        return drawBounded(m_Engine, min, max);
+    }
+
+    void PhiloxUniformIntRandomGenerator::generate(int min, int max, std::span<int> values) {
+        for (auto &value: values) {
+            value = drawBounded(m_Engine, min, max);
+        }
+    }
+
+    void PhiloxUniformIntRandomGenerator::generateBits(std::span<std::uint64_t> words) {
+        m_Engine.fill(words);
+    }
+
+    std::unique_ptr<RandomIntFromRange> PhiloxUniformIntRandomGenerator::split(std::uint64_t streamId) const {
+        return std::make_unique<PhiloxUniformIntRandomGenerator>(m_Origin.split(streamId));
+    }
+
+    bool PhiloxUniformIntRandomGenerator::reseed(std::uint64_t streamId) {
+        m_Engine = m_Origin.split(streamId);
+        return true;
+    }
+
+    PhiloxEngine &PhiloxUniformIntRandomGenerator::getEngine() {
+        return m_Engine;
+    }
+}
@@ -0,0 +1,74 @@
+export module PhiloxUniformIntRandomGenerator;
+
+export import Individual;
+import std;
+import std.compat;
+export import RandomIntFromRange;
+export import PhiloxEngine;
+
+namespace Geneticxx {
+    /**
+     * @class PhiloxUniformIntRandomGenerator
+     * @brief A splittable random number generator that produces uniform integers within a specified range.
+     *
+     * Draws from a `PhiloxEngine`, so `split` creates independent, reproducible streams for threads, islands or
+     * individuals without any shared state. Integers are drawn with Lemire's multiply-shift method, which is
+     * unbiased and needs a division only in the rare case a draw is rejected.
+     */
+    export class PhiloxUniformIntRandomGenerator : public RandomIntFromRange {
+        PhiloxEngine m_Engine; ///< The engine the integers are drawn from.
+        PhiloxEngine m_Origin; ///< The engine as created, which streams are split from.
+
+    public:
+        /**
+         * @brief Constructor that initializes the generator at the start of a stream of the seed.
+         *
+         * @param seed The seed value, the key of the engine (default is `std::random_device{}`).
+         * @param stream The stream of the seed to draw from.
+         */
+        explicit PhiloxUniformIntRandomGenerator(unsigned int seed = std::random_device{}(), std::uint64_t stream = 0);
+
+        /**
+         * @brief Constructor that draws from the given engine, e.g. one split from another generator's engine.
+         *
+         * @param engine The engine to draw from.
+         */
+        explicit PhiloxUniformIntRandomGenerator(const PhiloxEngine &engine);
+
+        ~PhiloxUniformIntRandomGenerator() override;
+
+        /**
+         * @brief Generate a random integer within the specified range.
+         *
+         * @param min The minimum value (inclusive) that can be generated.
+         * @param max The maximum value (inclusive) that can be generated.
+         * @return A randomly generated integer between `min` and `max`.
+         */
+        int generate(int min, int max) override;
+
+        /**
+         * @brief Fills a buffer with random integers within the specified range, without a virtual call per value.
+         */
+        void generate(int min, int max, std::span<int> values) override;
+
+        /**
+         * @brief Fills the words directly from the engine's blocks.
+         */
+        void generateBits(std::span<std::uint64_t> words) override;
+
+        /**
+         * @brief Creates a generator drawing from the stream `streamId` split from this generator's stream.
+         */
+        [[nodiscard]] std::unique_ptr<RandomIntFromRange> split(std::uint64_t streamId) const override;
+
+        /**
+         * @brief Restarts the engine at the beginning of the stream `streamId` split from the original stream.
+         */
+        bool reseed(std::uint64_t streamId) override;
+
+        /**
+         * @brief Returns the engine the integers are drawn from.
+         */
+        PhiloxEngine &getEngine();
+    };
+}
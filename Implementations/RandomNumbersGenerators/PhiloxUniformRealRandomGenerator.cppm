@@ -0,0 +1,50 @@
+module PhiloxUniformRealRandomGenerator;
+
+namespace Geneticxx {
+    namespace {
+        /// Maps 64 random bits to [0, 1).
+        double toUnit(std::uint64_t bits) {
+            return static_cast<double>(bits >> 11) * 0x1.0p-53;
+        }
+    }
+
+    PhiloxUniformRealRandomGenerator::PhiloxUniformRealRandomGenerator(unsigned int seed, std::uint64_t stream)
+        : RandomRealFromRange{seed}, m_Engine{seed, stream}, m_Origin{m_Engine} {
+    }
+
+    PhiloxUniformRealRandomGenerator::PhiloxUniformRealRandomGenerator(const PhiloxEngine &engine)
+        : RandomRealFromRange{static_cast<unsigned int>(engine.getSeed())}, m_Engine{engine}, m_Origin{engine} {
+    }
+
+    PhiloxUniformRealRandomGenerator::~PhiloxUniformRealRandomGenerator() {
+    }
+
+    double PhiloxUniformRealRandomGenerator::generate(double min, double max) {
+        return min + (max - min) * toUnit(m_Engine());
+    }
+
+    void PhiloxUniformRealRandomGenerator::generate(double min, double max, std::span<double> values) {
+        std::array<std::uint64_t, 64> bits;
+        const double width = max - min;
+        for (size_t start = 0; start < values.size(); start += bits.size()) {
+            const size_t count = std::min(bits.size(), values.size() - start);
+            m_Engine.fill(std::span{bits.data(), count});
+            for (size_t index = 0; index < count; index++) {
+                values[start + index] = min + width * toUnit(bits[index]);
+            }
+        }
+    }
+
+    std::unique_ptr<RandomRealFromRange> PhiloxUniformRealRandomGenerator::split(std::uint64_t streamId) const {
+        return std::make_unique<PhiloxUniformRealRandomGenerator>(m_Origin.split(streamId));
+    }
+
+    bool PhiloxUniformRealRandomGenerator::reseed(std::uint64_t streamId) {
+        m_Engine = m_Origin.split(streamId);
+        return true;
+    }
+
+    PhiloxEngine &PhiloxUniformRealRandomGenerator::getEngine() {
+        return m_Engine;
+    }
+}
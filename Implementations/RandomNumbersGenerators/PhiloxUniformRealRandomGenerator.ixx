@@ -0,0 +1,68 @@
+export module PhiloxUniformRealRandomGenerator;
+
+export import Individual;
+import std;
+import std.compat;
+export import RandomRealFromRange;
+export import PhiloxEngine;
+
+namespace Geneticxx {
+    /**
+     * @class PhiloxUniformRealRandomGenerator
+     * @brief A splittable random number generator that produces uniform real numbers within a specified range.
+     *
+     * Draws from a `PhiloxEngine`, see `PhiloxUniformIntRandomGenerator`. Every number uses the upper 53 bits of
+     * one 64-bit draw, so all representable multiples of 2^-53 in [0, 1) are equally likely before scaling.
+     */
+    export class PhiloxUniformRealRandomGenerator : public RandomRealFromRange {
+        PhiloxEngine m_Engine; ///< The engine the numbers are drawn from.
+        PhiloxEngine m_Origin; ///< The engine as created, which streams are split from.
+
+    public:
+        /**
+         * @brief Constructor that initializes the generator at the start of a stream of the seed.
+         *
+         * @param seed The seed value, the key of the engine (default is `std::random_device{}`).
+         * @param stream The stream of the seed to draw from.
+         */
+        explicit PhiloxUniformRealRandomGenerator(unsigned int seed = std::random_device{}(), std::uint64_t stream = 0);
+
+        /**
+         * @brief Constructor that draws from the given engine, e.g. one split from another generator's engine.
+         *
+         * @param engine The engine to draw from.
+         */
+        explicit PhiloxUniformRealRandomGenerator(const PhiloxEngine &engine);
+
+        ~PhiloxUniformRealRandomGenerator() override;
+
+        /**
+         * @brief Generate a random real number within the specified range.
+         *
+         * @param min The minimum value (inclusive) that can be generated.
+         * @param max The maximum value (exclusive) that can be generated.
+         * @return A randomly generated number between `min` and `max`.
+         */
+        double generate(double min, double max) override;
+
+        /**
+         * @brief Fills a buffer with random real numbers within the specified range, drawing whole blocks at once.
+         */
+        void generate(double min, double max, std::span<double> values) override;
+
+        /**
+         * @brief Creates a generator drawing from the stream `streamId` split from this generator's stream.
+         */
+        [[nodiscard]] std::unique_ptr<RandomRealFromRange> split(std::uint64_t streamId) const override;
+
+        /**
+         * @brief Restarts the engine at the beginning of the stream `streamId` split from the original stream.
+         */
+        bool reseed(std::uint64_t streamId) override;
+
+        /**
+         * @brief Returns the engine the numbers are drawn from.
+         */
+        PhiloxEngine &getEngine();
+    };
+}
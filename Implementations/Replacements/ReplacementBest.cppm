@@ -2,14 +2,70 @@ module ReplacementBest;
 
 namespace Geneticxx
 {
-    ReplacementBest::ReplacementBest() {
+    namespace {
+        // scratch buffers, per thread as islands may replace their populations concurrently
+        thread_local std::vector<double> fitnessBuffer;
+        thread_local std::vector<double> pool;
+        thread_local std::vector<size_t> order;
+        thread_local std::vector<char> survives;
+    }
+
+    ReplacementBest::ReplacementBest(TruncationMode mode, bool maximize) : m_Mode{mode}, m_Maximize{maximize} {
     }
 
     ReplacementBest::~ReplacementBest() {
     }
 
     Population * ReplacementBest::replace(Population *originalPopulation, Population *replacingPopulation) {
+        const size_t parents = originalPopulation->getSize();
+        const size_t offspring = replacingPopulation->getSize();
+        const size_t size = parents > 0 ? parents : offspring;
+
+        if (m_Mode == TruncationMode::Comma) {
+            if (offspring < size) {
+                throw std::invalid_argument("(mu, lambda) replacement needs at least as many offspring as parents");
+            }
+            partitionBest(viewFitness(replacingPopulation, fitnessBuffer), size, m_Maximize, order);
+            if (parents != size) {
+                originalPopulation->resize(size);
+            }
+            for (size_t slot = 0; slot < size; slot++) {
+                originalPopulation->setIndividual(slot, replacingPopulation->releaseIndividual(order[slot]));
+            }
+            originalPopulation->increaseIteration();
+            return originalPopulation;
+        }
+
+        // the pool holds the parents first, followed by the offspring
+        pool.clear();
+        pool.append_range(viewFitness(originalPopulation, fitnessBuffer));
+        pool.append_range(viewFitness(replacingPopulation, fitnessBuffer));
+        partitionBest(pool, size, m_Maximize, order);
+        survives.assign(parents, 0);
+        for (size_t i = 0; i < size; i++) {
+            if (order[i] < parents) {
+                survives[order[i]] = 1;
+            }
+        }
+        if (parents != size) {
+            originalPopulation->resize(size);
+        }
+        // every slot of a discarded parent receives one surviving child
+        size_t slot = 0;
+        for (size_t i = 0; i < size; i++) {
+            if (order[i] < parents) {
+                continue;
+            }
+            while (slot < parents && survives[slot]) {
+                slot++;
+            }
+            originalPopulation->setIndividual(slot++, replacingPopulation->releaseIndividual(order[i] - parents));
+        }
+        originalPopulation->increaseIteration();
+        return originalPopulation;
+    }
 
-        return replacingPopulation;
+    TruncationMode ReplacementBest::getMode() const {
+        return m_Mode;
     }
 }
\ No newline at end of file
@@ -1,14 +1,59 @@
 export module ReplacementBest;
 
-import ReplacementSchema;
+export import ReplacementSchema;
+import std;
+import std.compat;
 
 namespace Geneticxx
 {
+    /**
+     * @enum TruncationMode
+     * @brief Pool the survivors of a `ReplacementBest` are chosen from.
+     */
+    export enum class TruncationMode {
+        Plus, ///< (mu + lambda): the best of the parents and the offspring together.
+        Comma ///< (mu, lambda): the best of the offspring only, which must be at least as many as the parents.
+    };
+
+    /**
+     * @class ReplacementBest
+     * @brief A truncation replacement keeping the best individuals, in (mu + lambda) or (mu, lambda) mode.
+     *
+     * The size of the original population, mu, is kept; an empty original population takes the size of the
+     * replacing one. The survivors are found with `partitionBest` in O(mu + lambda) instead of sorting, surviving
+     * parents stay in their slots and surviving offspring are moved with `Population::releaseIndividual`
+     * instead of being cloned, so the replacing population has to be discarded afterwards.
+     */
     export class ReplacementBest final : public ReplacementSchema {
+    private:
+        TruncationMode m_Mode; ///< Pool the survivors are chosen from.
+        bool m_Maximize; ///< Whether a higher fitness is better.
+
     public:
-        ReplacementBest();
+        /**
+         * @brief Constructs a truncation replacement.
+         *
+         * @param mode Pool the survivors are chosen from.
+         * @param maximize True if a higher fitness is better.
+         */
+        explicit ReplacementBest(TruncationMode mode = TruncationMode::Plus, bool maximize = true);
+
         ~ReplacementBest() override;
 
+        /**
+         * @brief Keeps the best individuals of the pool in the original population.
+         *
+         * Increases the iteration count of the original population.
+         *
+         * @param originalPopulation The parents, receiving the survivors.
+         * @param replacingPopulation The offspring, left with released slots.
+         * @return A pointer to the modified `originalPopulation`.
+         *
+         * @throws std::invalid_argument In (mu, lambda) mode, if there are fewer offspring than parents.
+         */
         Population* replace(Population* originalPopulation, Population* replacingPopulation) override;
+
+        /// Returns the pool the survivors are chosen from.
+        TruncationMode getMode() const;
     };
 }
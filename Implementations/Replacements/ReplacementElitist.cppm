@@ -2,15 +2,58 @@ module ReplacementElitist;
 
 namespace Geneticxx
 {
-    ReplacementElitist::ReplacementElitist() {
+    namespace {
+        // scratch buffers, per thread as islands may replace their populations concurrently
+        thread_local std::vector<double> fitnessBuffer;
+        thread_local std::vector<size_t> order;
+        thread_local std::vector<char> isElite;
+    }
+
+    ReplacementElitist::ReplacementElitist(size_t elites, bool maximize) : m_Elites{elites}, m_Maximize{maximize} {
     }
 
     ReplacementElitist::~ReplacementElitist() {
     }
 
+    Population * ReplacementElitist::replace(Population *originalPopulation, Population *replacingPopulation) {
+        const size_t parents = originalPopulation->getSize();
+        const size_t size = replacingPopulation->getSize();
+        const size_t elites = std::min({m_Elites, parents, size});
+
+        partitionBest(viewFitness(originalPopulation, fitnessBuffer), elites, m_Maximize, order);
+        isElite.assign(parents, 0);
+        for (size_t i = 0; i < elites; i++) {
+            isElite[order[i]] = 1;
+        }
+        // elites beyond the new size move down into the slots of discarded parents
+        size_t free = 0;
+        for (size_t slot = size; slot < parents; slot++) {
+            if (!isElite[slot]) {
+                continue;
+            }
+            while (isElite[free]) {
+                free++;
+            }
+            originalPopulation->setIndividual(free, originalPopulation->releaseIndividual(slot));
+            isElite[free] = 1;
+        }
+        if (parents != size) {
+            originalPopulation->resize(size);
+        }
 
+        partitionBest(viewFitness(replacingPopulation, fitnessBuffer), size - elites, m_Maximize, order);
+        size_t next = 0;
+        for (size_t slot = 0; slot < size; slot++) {
+            if (slot < parents && isElite[slot]) {
+                continue;
+            }
+            originalPopulation->setIndividual(slot, replacingPopulation->releaseIndividual(order[next++]));
+        }
+        originalPopulation->increaseIteration();
+        return originalPopulation;
+    }
 
-    Population * ReplacementElitist::replace(Population *originalPopulation, Population *replacingPopulation) {
-        return originalPopulation; //TODO
+    size_t ReplacementElitist::getElites() const {
+        return m_Elites;
     }
 }
\ No newline at end of file
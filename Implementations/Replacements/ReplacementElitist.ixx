@@ -1,14 +1,49 @@
 export module ReplacementElitist;
 
-import ReplacementSchema;
+export import ReplacementSchema;
+import std;
+import std.compat;
 
 namespace Geneticxx
 {
+	/**
+	 * @class ReplacementElitist
+	 * @brief A replacement schema passing the offspring to the next generation, except for a few elite parents.
+	 *
+	 * The best `elites` parents survive in their slots; every other slot of the original population receives
+	 * one of the best offspring, so the worst offspring make room for the elites. The new generation has the
+	 * size of the replacing population. Both selections use `partitionBest`, so a replacement runs in O(n)
+	 * and the offspring are moved with `Population::releaseIndividual` instead of being cloned; the replacing
+	 * population has to be discarded afterwards.
+	 */
 	export class ReplacementElitist final : public ReplacementSchema {
+	private:
+		size_t m_Elites; ///< Number of parents surviving into the next generation.
+		bool m_Maximize; ///< Whether a higher fitness is better.
+
 	public:
-		ReplacementElitist();
+		/**
+		 * @brief Constructs an elitist replacement.
+		 *
+		 * @param elites Number of parents surviving into the next generation.
+		 * @param maximize True if a higher fitness is better.
+		 */
+		explicit ReplacementElitist(size_t elites = 1, bool maximize = true);
+
 		~ReplacementElitist() override;
 
+		/**
+		 * @brief Replaces all but the elite parents with the best offspring.
+		 *
+		 * Increases the iteration count of the original population.
+		 *
+		 * @param originalPopulation The parents, receiving the new generation.
+		 * @param replacingPopulation The offspring, left with released slots.
+		 * @return A pointer to the modified `originalPopulation`.
+		 */
 		Population* replace(Population* originalPopulation, Population* replacingPopulation) override;
+
+		/// Returns the number of parents surviving into the next generation.
+		size_t getElites() const;
 	};
 }
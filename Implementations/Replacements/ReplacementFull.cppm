@@ -10,12 +10,12 @@ namespace Geneticxx
   }
 
   Population* ReplacementFull::replace(Population* originalPopulation, Population* replacingPopulation) {
-    if (originalPopulation->getSize() != replacingPopulation->getSize()) {
-      originalPopulation->clear();
-    }
-    for (int i = 0; i < replacingPopulation->getSize(); i++) {
-      originalPopulation->setIndividual(i, replacingPopulation->getIndividual(i)->clone());
-
+    // the replacing population is discarded afterwards, so its individuals are taken over instead of copied
+    if (!originalPopulation->swapIndividuals(replacingPopulation)) {
+      originalPopulation->resize(replacingPopulation->getSize());
+      for (size_t i = 0; i < replacingPopulation->getSize(); i++) {
+        originalPopulation->setIndividual(i, replacingPopulation->releaseIndividual(i));
+      }
     }
     originalPopulation->increaseIteration();
     return originalPopulation;
@@ -32,9 +32,11 @@ namespace Geneticxx {
         /**
          * @brief Replaces the original population with the replacing population.
          *
-         * This method performs a full replacement of the original population with the new population.
-         * It ensures that both populations have the same size. If the sizes differ, the original population
-         * is cleared before the replacement.
+         * This method performs a full replacement of the original population with the new population, which
+         * takes the size of the replacing one. The individuals are transferred rather than copied: populations
+         * supporting `Population::swapIndividuals` exchange their storage in O(1), so the replacing population
+         * ends up holding the previous generation; otherwise every individual is moved with
+         * `Population::releaseIndividual`. Either way the replacing population is meant to be discarded.
          *
          * @param originalPopulation The population to be replaced.
          * @param replacingPopulation The new population that will replace the original.
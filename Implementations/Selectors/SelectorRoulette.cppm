@@ -2,53 +2,121 @@ module SelectorRoulette;
 
 namespace Geneticxx {
   SelectorRoulette::SelectorRoulette(RandomRealFromRange *genReal) : m_RandomNumbersGeneratorReal{genReal} {
-    m_PartialSums_Size = 0;
   }
 
   SelectorRoulette::~SelectorRoulette() {
   }
 
 
-  void SelectorRoulette::updatePartialSums(Population *population) {
-    if (population->getSize() > 0) {
-      if (m_PartialSums_Size < population->getSize()) {
-        m_PartialSums.resize(population->getSize());
-      }
-      m_PartialSums_Size = population->getSize();
-      m_PartialSums[0] = population->getIndividual(0)->getFitness();
-      for (int i = 1; i < population->getSize(); ++i) {
-        m_PartialSums[i] = m_PartialSums[i - 1] + population->getIndividual(i)->getFitness();
+  void SelectorRoulette::updateAliasTable(Population *population) {
+    auto fitness = viewFitness(population, m_FitnessBuffer);
+    const size_t size = fitness.size();
+    m_Probabilities.resize(size);
+    m_Aliases.resize(size);
+    m_CachedPopulation = population;
+    m_CachedVersion = population->getVersion();
+
+    double total = 0;
+    for (double value: fitness) {
+      total += std::max(value, 0.0);
+    }
+    if (!(total > 0) || !std::isfinite(total)) {
+      // nothing to weigh the wheel with, every individual is equally likely
+      std::ranges::fill(m_Probabilities, 1.0);
+      std::iota(m_Aliases.begin(), m_Aliases.end(), size_t{0});
+      return;
+    }
+
+    // Vose's alias method: scale the weights to a mean of 1, then pair every underfull slot with an overfull one
+    m_Small.clear();
+    m_Large.clear();
+    const double scale = static_cast<double>(size) / total;
+    for (size_t i = 0; i < size; i++) {
+      m_Probabilities[i] = std::max(fitness[i], 0.0) * scale;
+      m_Aliases[i] = i;
+      (m_Probabilities[i] < 1.0 ? m_Small : m_Large).push_back(i);
+    }
+    while (!m_Small.empty() && !m_Large.empty()) {
+      const size_t small = m_Small.back();
+      m_Small.pop_back();
+      const size_t large = m_Large.back();
+      m_Aliases[small] = large;
+      m_Probabilities[large] += m_Probabilities[small] - 1.0;
+      if (m_Probabilities[large] < 1.0) {
+        m_Large.pop_back();
+        m_Small.push_back(large);
       }
-    } else {
-      m_PartialSums_Size = 0;
+    }
+    // whatever is left over is full up to rounding errors
+    for (size_t i: m_Small) {
+      m_Probabilities[i] = 1.0;
+    }
+    for (size_t i: m_Large) {
+      m_Probabilities[i] = 1.0;
+    }
+  }
+
+  void SelectorRoulette::invalidate() {
+    m_CachedPopulation = nullptr;
+  }
+
+  bool SelectorRoulette::isTableCurrent(const Population *population) const {
+    return m_CachedPopulation == population && m_CachedVersion == population->getVersion() &&
+           m_Probabilities.size() == population->getSize();
+  }
+
+  void SelectorRoulette::draw(std::span<size_t> indices, RandomRealFromRange *genReal) const {
+    const size_t size = m_Probabilities.size();
+    for (auto &index: indices) {
+      // one draw gives both the slot (integer part) and the acceptance coin (fractional part)
+      const double draw = genReal->generate(0, static_cast<double>(size));
+      const size_t slot = std::min(static_cast<size_t>(draw), size - 1);
+      index = draw - static_cast<double>(slot) < m_Probabilities[slot] ? slot : m_Aliases[slot];
     }
   }
 
+  bool SelectorRoulette::selectIndices(Population *population, std::span<size_t> indices) {
+    if (indices.empty()) {
+      return true;
+    }
+    if (population->getSize() == 0) {
+      throw std::invalid_argument("Cannot select individuals from an empty population");
+    }
+    prepare(population);
+    draw(indices, m_RandomNumbersGeneratorReal);
+    return true;
+  }
+
+  void SelectorRoulette::prepare(Population *population) {
+    if (!isTableCurrent(population)) {
+      updateAliasTable(population);
+    }
+  }
+
+  bool SelectorRoulette::selectIndicesWith(Population *population, std::span<size_t> indices,
+                                           RandomIntFromRange *genInt, RandomRealFromRange *genReal) const {
+    if (genReal == nullptr || !isTableCurrent(population)) {
+      return false;
+    }
+    if (indices.empty()) {
+      return true;
+    }
+    if (population->getSize() == 0) {
+      throw std::invalid_argument("Cannot select individuals from an empty population");
+    }
+    draw(indices, genReal);
+    return true;
+  }
+
   std::vector<std::unique_ptr<Individual> > SelectorRoulette::select(Population *population, size_t size) {
+    std::vector<std::unique_ptr<Individual> > results {};
     if (population->getSize() > 0) {
-      updatePartialSums(population);
-      std::vector<std::unique_ptr<Individual> > results;
-      for (size_t j = 0; j < size; ++j) {
-        double cutoff = m_RandomNumbersGeneratorReal->generate(0,  m_PartialSums[m_PartialSums_Size - 1]);
-        int i;
-        int lower = 0;
-        int upper = m_PartialSums_Size - 1;
-        // binary search
-        while (upper >= lower) {
-          i = lower + (upper - lower) / 2;
-          if (m_PartialSums[i] > cutoff) {
-            upper = i - 1;
-          } else {
-            lower = i + 1;
-          }
-        }
-        if (lower >= m_PartialSums_Size) { lower = m_PartialSums_Size - 1; }
-        results.push_back(std::unique_ptr<Individual>(population->getIndividual(lower)->clone()));
+      std::vector<size_t> indices(size);
+      selectIndices(population, indices);
+      for (auto index: indices) {
+        results.push_back(std::unique_ptr<Individual>(population->getIndividual(index)->clone()));
       }
-
-      return std::move(results);
     }
-    std::vector<std::unique_ptr<Individual> > results {};
     return results;
   }
 }
@@ -1,6 +1,7 @@
 export module SelectorRoulette;
 
 import SelectionSchema;
+import RandomIntFromRange;
 import RandomRealFromRange;
 import std;
 import std.compat;
@@ -12,7 +13,13 @@ namespace Geneticxx {
      *
      * This class implements the `SelectionSchema` interface and selects individuals based on their cumulative fitness.
      * The selection process uses the roulette wheel mechanism, where individuals with higher fitness have a higher
-     * chance of being selected.
+     * chance of being selected. The wheel is kept as an alias table, built once per version of the population,
+     * so that every draw costs O(1) instead of an O(n) rebuild followed by a binary search.
+     *
+     * Building the table costs O(n), and any change of the population, even of a single individual, bumps its
+     * version and so triggers a rebuild on the next draw. Steady-state algorithms replace individuals after every
+     * few draws, which makes each of their steps O(n); `SelectorTournament` costs O(k) per draw whatever the
+     * changes and suits them better.
      */
     export class SelectorRoulette : public SelectionSchema {
     private:
@@ -24,27 +31,54 @@ namespace Geneticxx {
         RandomRealFromRange *m_RandomNumbersGeneratorReal{};
 
         /**
-         * @brief A vector that stores cumulative fitness values for the roulette wheel selection.
+         * @brief Acceptance probabilities of the alias table, one per individual.
          *
-         * The vector holds partial sums of individual fitness values. The cumulative sum allows for fast selection
-         * of individuals using the roulette wheel method.
+         * Together with `m_Aliases` this is the Walker/Vose alias table of the fitness distribution, which lets
+         * every draw be served in constant time: a slot is picked uniformly and either accepted with its
+         * probability or replaced by its alias.
          */
-        std::vector<double> m_PartialSums;
+        std::vector<double> m_Probabilities;
 
         /**
-         * @brief The current size of the `m_PartialSums` vector.
-         *
-         * This value represents the number of individuals in the population, which is used to determine if the
-         * `m_PartialSums` vector needs to be resized.
+         * @brief Alias of every slot of the alias table, drawn when the slot itself is rejected.
+         */
+        std::vector<size_t> m_Aliases;
+
+        /**
+         * @brief Scratch worklists of under- and overfull slots used while building the alias table.
+         */
+        std::vector<size_t> m_Small, m_Large;
+
+        /**
+         * @brief Population the alias table was built for, compared with its version to detect stale tables.
+         */
+        const Population *m_CachedPopulation = nullptr;
+
+        /**
+         * @brief Version of `m_CachedPopulation` at the time the alias table was built.
+         */
+        size_t m_CachedVersion = 0;
+
+        /**
+         * @brief Scratch buffer for fitness values of populations without flat fitness storage.
+         */
+        std::vector<double> m_FitnessBuffer;
+
+        /**
+         * @brief Checks whether the alias table was built for the current version of the population.
+         */
+        bool isTableCurrent(const Population* population) const;
+
+        /**
+         * @brief Draws one index per element of `indices` from the alias table.
          */
-        size_t m_PartialSums_Size;
+        void draw(std::span<size_t> indices, RandomRealFromRange* genReal) const;
 
     public:
         /**
          * @brief Default constructor for `SelectorRoulette` class.
          *
-         * Initializes the selector by accepting random number generators for real and sets the size
-         * of the partial sums vector to zero.
+         * Initializes the selector by accepting random number generators for real, with no cached alias table.
          *
          * @param genReal Pointer to the random real generator.
          */
@@ -61,8 +95,8 @@ namespace Geneticxx {
          * @brief Selects a subset of individuals from the population using the roulette wheel method.
          *
          * This method selects `size` individuals based on their fitness, with higher fitness individuals having
-         * a higher chance of being selected. The roulette wheel mechanism is implemented using the cumulative
-         * fitness stored in `m_PartialSums`.
+         * a higher chance of being selected. The roulette wheel mechanism is implemented using the alias table
+         * stored in `m_Probabilities` and `m_Aliases`.
          *
          * @param population The population from which to select individuals.
          * @param size The number of individuals to select.
@@ -71,14 +105,49 @@ namespace Geneticxx {
         std::vector<std::unique_ptr<Individual>> select(Population* population, size_t size) override;
 
         /**
-         * @brief Updates the cumulative fitness values (partial sums) for the population.
+         * @brief Selects individuals using the roulette wheel method and writes their indices.
+         *
+         * @param population The population from which to select individuals.
+         * @param indices Output span receiving the indices of the selected individuals.
+         * @return Always true.
+         *
+         * @throws std::invalid_argument If individuals are requested from an empty population.
+         */
+        bool selectIndices(Population* population, std::span<size_t> indices) override;
+
+        /**
+         * @brief Builds the alias table for the population unless it is current.
          *
-         * This method calculates the partial sums of the fitness values of the individuals in the population and
-         * stores them in the `m_PartialSums` vector. The cumulative sum is used for fast selection in the roulette
-         * wheel method.
+         * @param population The population individuals will be selected from.
+         */
+        void prepare(Population* population) override;
+
+        /**
+         * @brief Draws from the alias table built by `prepare`, with `genReal` instead of the selector's generator.
+         *
+         * @return False if `genReal` is null or the table was not built for the current version of the population.
+         */
+        bool selectIndicesWith(Population* population, std::span<size_t> indices, RandomIntFromRange* genInt,
+                               RandomRealFromRange* genReal) const override;
+
+        /**
+         * @brief Rebuilds the alias table from the fitness values of the population.
+         *
+         * The table is built in O(n) and reused by all following selections from the same population until its
+         * version (see `Population::getVersion`) changes, so a whole breeding phase costs a single rebuild.
+         * Negative fitness values are treated as zero; if no individual has a positive fitness, all individuals
+         * are equally likely to be selected.
+         *
+         * @param population The population whose fitness values are used to build the alias table.
+         */
+        void updateAliasTable(Population* population);
+
+        /**
+         * @brief Discards the cached alias table.
          *
-         * @param population The population whose fitness values are used to update the partial sums.
+         * Needed only when the fitness of individuals is changed in place through `Population::getIndividual`
+         * between two selections, which does not change the population's version.
          */
-        void updatePartialSums(Population* population);
+        void invalidate();
     };
 }
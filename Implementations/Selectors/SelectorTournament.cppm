@@ -1,57 +1,100 @@
 module SelectorTournament;
 
 namespace Geneticxx {
-    SelectorTournament::SelectorTournament() {
+    namespace {
+        // scratch buffers of a batch, per thread so that selections may run concurrently
+        thread_local std::vector<double> fitnessBuffer;
+        /// Indices of the participants of all tournaments of the current batch, `k` per tournament.
+        thread_local std::vector<size_t> candidates;
+        /// Fitness of the participants, gathered in the same order as `candidates`.
+        thread_local std::vector<double> candidateFitness;
+    }
+
+    SelectorTournament::SelectorTournament(RandomIntFromRange* genInt, size_t tournamentSize, bool withReplacement,
+                                           bool maximize)
+        : m_RandomNumbersGeneratorInt{genInt}, m_TournamentSize{tournamentSize}, m_WithReplacement{withReplacement},
+          m_Maximize{maximize} {
+        if (tournamentSize == 0) {
+            throw std::invalid_argument("Tournament size must be greater than 0");
+        }
     }
 
     SelectorTournament::~SelectorTournament() {
     }
 
     std::vector<std::unique_ptr<Individual>> SelectorTournament::select(Population* population, size_t size) {
-        //TODO finish tournament selector
-        /*
-        Population* transitionalPopulation = new Population(); // Create the transitional population
-
-        // Divide the given population into m_subsetsNumber subsets
-        std::vector<std::vector<Individual*>> dividedPopulations(m_subsetsNumber); // ??
-        size_t populationSize = population->getSize();
-        size_t subsetSize = populationSize / m_subsetsNumber;
-
-        for (size_t i = 0; i < populationSize; ++i) {
-            dividedPopulations[i % m_subsetsNumber].push_back(population->at(i)); // ??
-        }
-
-        // Iterate through each subpopulation
-        for (const auto& subPopulation : dividedPopulations) {
-            Individual* bestIndividual = nullptr;
-            double bestFitness = std::numeric_limits<double>::max(); // Start with a very high fitness value
-
-            // Find the individual with the lowest fitness in the subpopulation
-            for (Individual* individual : subPopulation) {
-                double fitness = individual->getFitness();
-                if (fitness < bestFitness) {
-                    bestFitness = fitness;
-                    bestIndividual = individual;
-                }
+        std::vector<std::unique_ptr<Individual>> results;
+        if (population->getSize() > 0) {
+            std::vector<size_t> indices(size);
+            selectIndices(population, indices);
+            for (auto index: indices) {
+                results.push_back(std::unique_ptr<Individual>(population->getIndividual(index)->clone()));
             }
-
-            // Add the best individual to the transitional population
-            transitionalPopulation->add(bestIndividual);
         }
+        return std::move(results);
+    }
 
-        // Return the transitional population
-        return transitionalPopulation;
+    bool SelectorTournament::selectIndices(Population* population, std::span<size_t> indices) {
+        return selectIndicesWith(population, indices, m_RandomNumbersGeneratorInt, nullptr);
+    }
 
+    bool SelectorTournament::selectIndicesWith(Population* population, std::span<size_t> indices,
+                                               RandomIntFromRange* genInt, RandomRealFromRange* genReal) const {
+        if (genInt == nullptr) {
+            return false;
+        }
+        if (indices.empty()) {
+            return true;
+        }
+        const size_t size = population->getSize();
+        if (size == 0) {
+            throw std::invalid_argument("Cannot select individuals from an empty population");
+        }
+        if (!m_WithReplacement && m_TournamentSize > size) {
+            throw std::invalid_argument("Tournament without replacement is larger than the population");
+        }
+        const size_t k = m_TournamentSize;
+        const int last = static_cast<int>(size - 1);
 
-        */
-        // a temporary measure - previous code will be the final one after adjustments
-        auto temp = population->getIndividual(0)->clone();
-        std::vector<std::unique_ptr<Individual>> results;
-        auto tt = std::unique_ptr<Individual>(temp);
-        results.push_back(std::move(tt));
-        return std::move(results);
-    }
-}
+        // draw the participants of all tournaments
+        candidates.resize(indices.size() * k);
+        for (size_t t = 0; t < indices.size(); t++) {
+            auto tournament = std::span(candidates).subspan(t * k, k);
+            for (size_t j = 0; j < k; j++) {
+                size_t candidate = genInt->generate(0, last);
+                // without replacement redraw until the participant is new; tournaments are small, so this is cheap
+                auto drawn = tournament.first(j);
+                while (!m_WithReplacement && std::ranges::find(drawn, candidate) != drawn.end()) {
+                    candidate = genInt->generate(0, last);
+                }
+                tournament[j] = candidate;
+            }
+        }
 
+        // gather their fitness into one contiguous array, negated when minimizing so one comparison serves both
+        auto fitness = viewFitness(population, fitnessBuffer);
+        const double direction = m_Maximize ? 1.0 : -1.0;
+        candidateFitness.resize(candidates.size());
+        for (size_t i = 0; i < candidates.size(); i++) {
+            candidateFitness[i] = direction * fitness[candidates[i]];
+        }
 
+        // the first best participant of every tournament wins
+        for (size_t t = 0; t < indices.size(); t++) {
+            const double *tournament = candidateFitness.data() + t * k;
+            size_t winner = 0;
+            double best = tournament[0];
+            for (size_t j = 1; j < k; j++) {
+                const bool better = tournament[j] > best;
+                winner = better ? j : winner;
+                best = better ? tournament[j] : best;
+            }
+            indices[t] = candidates[t * k + winner];
+        }
+        return true;
+    }
 
+    size_t SelectorTournament::getTournamentSize() const {
+        return m_TournamentSize;
+    }
+}
@@ -1,6 +1,8 @@
 export module SelectorTournament;
 
 import SelectionSchema;
+import RandomIntFromRange;
+import RandomRealFromRange;
 import std;
 
 namespace Geneticxx {
@@ -8,25 +10,54 @@ namespace Geneticxx {
      * @class SelectorTournament
      * @brief A selection schema that selects individuals using a tournament-based method.
      *
-     * This class implements the `SelectionSchema` interface and selects individuals by running a tournament
-     * among subsets of individuals from the population. The best individual from each subset is selected.
+     * This class implements the `SelectionSchema` interface. For every selected individual a tournament of
+     * `k` randomly drawn individuals is held and the one with the best fitness wins. Larger tournaments
+     * increase the selection pressure.
+     *
+     * Selections are processed in batches: the candidates of all requested tournaments are drawn first,
+     * their fitness values are gathered from the population's flat fitness buffer (see `viewFitness`) into
+     * a contiguous array, and the winners are then found by a branch-light scan over that array. Selecting
+     * a whole generation's worth of parents with a single `selectIndices` call is therefore the fastest way
+     * to use this selector. The scratch buffers of a batch are per thread, so `selectIndicesWith` may be
+     * called concurrently without any preparation.
      */
     export class SelectorTournament : public SelectionSchema {
     private:
         /**
-         * @brief The number of subsets used in the tournament selection.
+         * @brief Pointer to a random number generator for generating random integers.
          *
-         * This value determines how the population is divided into subsets for the tournament selection process.
+         * This utility is used to draw the participants of the tournaments.
+         */
+        RandomIntFromRange *m_RandomNumbersGeneratorInt;
+
+        /**
+         * @brief The number of individuals taking part in every tournament.
+         */
+        size_t m_TournamentSize;
+
+        /**
+         * @brief Whether an individual may take part more than once in the same tournament.
          */
-        unsigned int m_subsetsNumber;
+        bool m_WithReplacement;
+
+        /**
+         * @brief Whether higher fitness wins (true) or lower fitness wins (false).
+         */
+        bool m_Maximize;
 
     public:
         /**
-         * @brief Default constructor for `SelectorTournament` class.
+         * @brief Constructor for `SelectorTournament` class.
          *
-         * Initializes the tournament selector with default parameters, such as the number of subsets for the tournament.
+         * @param genInt Pointer to the random integer generator used to draw the participants.
+         * @param tournamentSize Number of individuals taking part in every tournament (k).
+         * @param withReplacement Whether the same individual may be drawn more than once for one tournament.
+         * @param maximize True if higher fitness is better, false if lower fitness is better.
+         *
+         * @throws std::invalid_argument If the tournament size is 0.
          */
-        SelectorTournament();
+        explicit SelectorTournament(RandomIntFromRange* genInt, size_t tournamentSize = 2, bool withReplacement = true,
+                                    bool maximize = true);
 
         /**
          * @brief Destructor for `SelectorTournament` class.
@@ -38,13 +69,39 @@ namespace Geneticxx {
         /**
          * @brief Selects a subset of individuals from the population using the tournament selection method.
          *
-         * This method divides the population into a number of subsets (`m_subsetsNumber`) and performs a tournament
-         * in each subset. The best individual (based on fitness) from each subset is selected and returned in the results.
+         * This method holds `size` tournaments and returns clones of their winners.
          *
          * @param population The population from which to select individuals.
          * @param size The number of individuals to select.
          * @return A vector containing the selected individuals as unique pointers.
          */
         std::vector<std::unique_ptr<Individual>> select(Population* population, size_t size) override;
+
+        /**
+         * @brief Selects individuals using the tournament selection method and writes their indices.
+         *
+         * One tournament is held for every element of `indices`, all of them in one batch.
+         *
+         * @param population The population from which to select individuals.
+         * @param indices Output span receiving the indices of the selected individuals.
+         * @return Always true.
+         *
+         * @throws std::invalid_argument If the population is empty, or if the tournament is drawn without
+         *         replacement and is larger than the population.
+         */
+        bool selectIndices(Population* population, std::span<size_t> indices) override;
+
+        /**
+         * @brief Holds the tournaments like `selectIndices`, drawing the participants from `genInt`.
+         *
+         * @return False if `genInt` is null.
+         */
+        bool selectIndicesWith(Population* population, std::span<size_t> indices, RandomIntFromRange* genInt,
+                               RandomRealFromRange* genReal) const override;
+
+        /**
+         * @brief Returns the number of individuals taking part in every tournament.
+         */
+        size_t getTournamentSize() const;
     };
 }
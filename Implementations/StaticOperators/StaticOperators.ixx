@@ -0,0 +1,247 @@
+export module StaticOperators;
+
+export import PhiloxEngine;
+import std;
+import std.compat;
+
+namespace Geneticxx {
+    /**
+     * @brief Genome usable by `GeneticAlgorithmStatic`: a copyable, sized, random-access range of genes, e.g.
+     * `std::vector<double>` or `std::array<std::uint8_t, 64>`.
+     */
+    export template<typename GenomeType>
+    concept StaticGenome = std::copyable<GenomeType> && std::ranges::random_access_range<GenomeType> &&
+                           std::ranges::sized_range<GenomeType>;
+
+    /**
+     * @brief Evaluation computing the fitness of a genome, decoding the phenome itself if needed.
+     */
+    export template<typename EvaluationType, typename GenomeType>
+    concept StaticEvaluation = StaticGenome<GenomeType> &&
+                               requires(const EvaluationType &evaluation, const GenomeType &genome) {
+                                   { evaluation(genome) } -> std::convertible_to<double>;
+                               };
+
+    /**
+     * @brief Selection returning the index of a parent, given the fitness of the population.
+     */
+    export template<typename SelectionType>
+    concept StaticSelection = requires(const SelectionType &selection, std::span<const double> fitness,
+                                       PhiloxEngine &random) {
+        { selection(fitness, random) } -> std::convertible_to<size_t>;
+    };
+
+    /**
+     * @brief Crossover writing two children of two parents into existing genomes.
+     *
+     * The children may be reused genomes of an earlier generation; they are never aliases of the parents.
+     */
+    export template<typename CrossoverType, typename GenomeType>
+    concept StaticCrossover = StaticGenome<GenomeType> &&
+                              requires(const CrossoverType &crossover, const GenomeType &parent, GenomeType &child,
+                                       PhiloxEngine &random) {
+                                  crossover(parent, parent, child, child, random);
+                              };
+
+    /**
+     * @brief Mutation changing a genome in place.
+     */
+    export template<typename MutationType, typename GenomeType>
+    concept StaticMutation = StaticGenome<GenomeType> &&
+                             requires(const MutationType &mutation, GenomeType &genome, PhiloxEngine &random) {
+                                 mutation(genome, random);
+                             };
+
+    /**
+     * @brief Draws an index uniformly from [0, bound) with Lemire's multiply-shift method.
+     *
+     * @param random Engine to draw from.
+     * @param bound Number of possible indices, greater than 0.
+     * @return The index.
+     */
+    export inline size_t drawIndex(PhiloxEngine &random, size_t bound) {
+        if (bound > std::numeric_limits<std::uint32_t>::max()) {
+            return static_cast<size_t>(random() % bound);
+        }
+        const auto range = static_cast<std::uint32_t>(bound);
+        std::uint64_t product = std::uint64_t{random.next32()} * range;
+        if (static_cast<std::uint32_t>(product) < range) {
+            const std::uint32_t threshold = (0u - range) % range;
+            while (static_cast<std::uint32_t>(product) < threshold) {
+                product = std::uint64_t{random.next32()} * range;
+            }
+        }
+        return static_cast<size_t>(product >> 32);
+    }
+
+    /**
+     * @brief Draws a real number uniformly from [0, 1).
+     */
+    export inline double drawUnit(PhiloxEngine &random) {
+        return static_cast<double>(random() >> 11) * 0x1.0p-53;
+    }
+
+    /**
+     * @struct StaticSelectorTournament
+     * @brief Tournament selection, see `SelectorTournament`.
+     */
+    export struct StaticSelectorTournament {
+        size_t tournamentSize = 2; ///< Number of individuals taking part in every tournament.
+        bool maximize = true; ///< Whether higher fitness wins.
+
+        size_t operator()(std::span<const double> fitness, PhiloxEngine &random) const {
+            size_t winner = drawIndex(random, fitness.size());
+            for (size_t round = 1; round < tournamentSize; round++) {
+                const size_t candidate = drawIndex(random, fitness.size());
+                if (maximize ? fitness[candidate] > fitness[winner] : fitness[candidate] < fitness[winner]) {
+                    winner = candidate;
+                }
+            }
+            return winner;
+        }
+    };
+
+    /**
+     * @struct StaticCrossoverUniform
+     * @brief Uniform crossover, see `CrossoverUniform`: every gene is exchanged with probability 1/2, decided by
+     * the bits of 64-bit random words.
+     */
+    export struct StaticCrossoverUniform {
+        template<StaticGenome GenomeType>
+        void operator()(const GenomeType &parent1, const GenomeType &parent2, GenomeType &child1,
+                        GenomeType &child2, PhiloxEngine &random) const {
+            if (std::ranges::size(parent1) != std::ranges::size(parent2)) {
+                throw std::invalid_argument("Genomes must have the same size");
+            }
+            child1 = parent1;
+            child2 = parent2;
+            const size_t size = std::ranges::size(parent1);
+            for (size_t start = 0; start < size; start += 64) {
+                const std::uint64_t mask = random();
+                const size_t end = std::min(size, start + 64);
+                for (size_t i = start; i < end; i++) {
+                    if ((mask >> (i - start) & 1) != 0) {
+                        child1[i] = parent2[i];
+                        child2[i] = parent1[i];
+                    }
+                }
+            }
+        }
+    };
+
+    /**
+     * @struct StaticCrossoverSinglePoint
+     * @brief Single-point crossover, see `CrossoverSinglePoint`: the genes past a random point are exchanged.
+     */
+    export struct StaticCrossoverSinglePoint {
+        template<StaticGenome GenomeType>
+        void operator()(const GenomeType &parent1, const GenomeType &parent2, GenomeType &child1,
+                        GenomeType &child2, PhiloxEngine &random) const {
+            if (std::ranges::size(parent1) != std::ranges::size(parent2)) {
+                throw std::invalid_argument("Genomes must have the same size");
+            }
+            child1 = parent1;
+            child2 = parent2;
+            const size_t size = std::ranges::size(parent1);
+            if (size < 2) {
+                return;
+            }
+            const size_t point = 1 + drawIndex(random, size - 1);
+            for (size_t i = point; i < size; i++) {
+                child1[i] = parent2[i];
+                child2[i] = parent1[i];
+            }
+        }
+    };
+
+    /**
+     * @struct StaticBitFlip
+     * @brief Gene operation negating a boolean gene, see `Mutator1DPointBitFlip`.
+     */
+    export struct StaticBitFlip {
+        template<typename GeneType>
+        void operator()(GeneType &&gene, PhiloxEngine &) const {
+            gene = !gene;
+        }
+    };
+
+    /**
+     * @struct StaticPointReplacement
+     * @brief Gene operation replacing a gene with a random value from [minValue, maxValue), see
+     * `MutatorPointReplacement`.
+     */
+    export template<typename T>
+    struct StaticPointReplacement {
+        T minValue = 0; ///< Lower bound of the new values.
+        T maxValue = 60; ///< Upper bound of the new values.
+
+        void operator()(T &gene, PhiloxEngine &random) const {
+            gene = static_cast<T>(minValue + (maxValue - minValue) * drawUnit(random));
+        }
+    };
+
+    /**
+     * @struct StaticRandomValueAddition
+     * @brief Gene operation adding a random value from [minValue, maxValue) to a gene, see
+     * `Mutator1DRandomValueAddition`.
+     */
+    export template<typename T>
+    struct StaticRandomValueAddition {
+        T minValue = -1; ///< Lower bound of the added values.
+        T maxValue = 1; ///< Upper bound of the added values.
+
+        void operator()(T &gene, PhiloxEngine &random) const {
+            gene += static_cast<T>(minValue + (maxValue - minValue) * drawUnit(random));
+        }
+    };
+
+    /**
+     * @struct StaticMutatorPoint
+     * @brief Mutation applying a gene operation to one random gene.
+     */
+    export template<typename GeneOperation>
+    struct StaticMutatorPoint {
+        GeneOperation operation{}; ///< Operation applied to the gene.
+
+        template<StaticGenome GenomeType>
+        void operator()(GenomeType &genome, PhiloxEngine &random) const {
+            if (std::ranges::size(genome) == 0) {
+                throw std::invalid_argument("Invalid genome");
+            }
+            operation(genome[drawIndex(random, std::ranges::size(genome))], random);
+        }
+    };
+
+    /**
+     * @struct StaticMutatorPerGene
+     * @brief Mutation applying a gene operation to every gene independently with a given probability, jumping
+     * between the mutated genes with geometric skips, see `MutatorPerGene`.
+     */
+    export template<typename GeneOperation>
+    struct StaticMutatorPerGene {
+        double geneProbability = 0.01; ///< Probability of mutating every single gene.
+        GeneOperation operation{}; ///< Operation applied to the mutated genes.
+
+        template<StaticGenome GenomeType>
+        void operator()(GenomeType &genome, PhiloxEngine &random) const {
+            if (!(geneProbability > 0.0)) {
+                return;
+            }
+            const size_t size = std::ranges::size(genome);
+            if (geneProbability >= 1.0) {
+                for (size_t position = 0; position < size; position++) {
+                    operation(genome[position], random);
+                }
+                return;
+            }
+            const double logComplement = std::log1p(-geneProbability);
+            auto skip = [&]() {
+                const double gap = std::floor(std::log1p(-drawUnit(random)) / logComplement);
+                return gap < static_cast<double>(size) ? static_cast<size_t>(gap) : size;
+            };
+            for (size_t position = skip(); position < size; position += 1 + skip()) {
+                operation(genome[position], random);
+            }
+        }
+    };
+}
@@ -14,32 +14,46 @@ namespace Geneticxx
         m_meanFitness = 0;
         m_medianFitness = 0;
         m_realSize = population->getSize() > m_size ? m_size : population->getSize();
+        m_Individuals.clear();
+        if (population->getSize() == 0)
+        {
+            return;
+        }
 
-         for (int i = 0; i < population->getSize(); i++)
-         {
-             m_Individuals.push_back(std::unique_ptr<Individual>(population->getIndividual(i)->clone()));
-             m_meanFitness += m_Individuals[i]->getFitness();
-         }
-        m_meanFitness /= population->getSize();
-        for (int i = 0; i < population->getSize(); i++)
+        // all statistics are computed on a flat copy of the fitness, only the best individuals are cloned
+        auto fitness = viewFitness(population, m_FitnessBuffer);
+        const size_t size = fitness.size();
+        for (double value : fitness)
+        {
+            m_meanFitness += value;
+        }
+        m_meanFitness /= size;
+        for (double value : fitness)
         {
-            m_varianceFitness += (m_Individuals[i]->getFitness() - m_meanFitness)*(m_Individuals[i]->getFitness() - m_meanFitness);
+            m_varianceFitness += (value - m_meanFitness) * (value - m_meanFitness);
         }
-        m_varianceFitness /= population->getSize();
-        std::sort( m_Individuals.begin(),
-                          //m_Individuals.begin() + m_realSize,
-                           m_Individuals.end(),
-                           [](const std::unique_ptr<Individual> &lhs, const std::unique_ptr<Individual> &rhs)
-                           {
-                              return lhs.get()->getFitness() > rhs.get()->getFitness(); //  (*lhs) > (*rhs) for the greatest n elements
-                           });
-        if (population->getSize() % 2 == 0)
+        m_varianceFitness /= size;
+
+        m_SortedFitness.assign(fitness.begin(), fitness.end());
+        auto upperMiddle = m_SortedFitness.begin() + size / 2;
+        std::nth_element(m_SortedFitness.begin(), upperMiddle, m_SortedFitness.end());
+        m_medianFitness = *upperMiddle;
+        if (size % 2 == 0)
+        {
+            m_medianFitness = (m_medianFitness + *std::max_element(m_SortedFitness.begin(), upperMiddle)) / 2;
+        }
+
+        m_BestIndices.resize(size);
+        std::iota(m_BestIndices.begin(), m_BestIndices.end(), 0);
+        std::partial_sort(m_BestIndices.begin(), m_BestIndices.begin() + m_realSize, m_BestIndices.end(),
+                          [&fitness](size_t lhs, size_t rhs)
+                          {
+                              return fitness[lhs] > fitness[rhs]; // the greatest n elements first
+                          });
+        for (size_t i = 0; i < m_realSize; i++)
         {
-            m_medianFitness = (m_Individuals[population->getSize()/2]->getFitness() +
-                m_Individuals[population->getSize()/2-1]->getFitness())/2;
+            m_Individuals.push_back(std::unique_ptr<Individual>(population->getIndividual(m_BestIndices[i])->clone()));
         }
-        else  m_medianFitness = m_Individuals[population->getSize()/2-1]->getFitness();
-         m_Individuals.resize(m_realSize);
     }
 
     void StatisticsBasic::clear()
@@ -44,6 +44,12 @@ namespace Geneticxx {
          */
         size_t m_realSize;
         double m_meanFitness, m_medianFitness, m_varianceFitness;
+
+        /**
+         * @brief Scratch buffers for fitness values and indices of the best individuals.
+         */
+        std::vector<double> m_FitnessBuffer, m_SortedFitness;
+        std::vector<size_t> m_BestIndices;
     public:
         /**
          * @brief Destructor for `StatisticsBasic` class.
@@ -0,0 +1,210 @@
+module;
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GENETICXX_POSIX_SHARED_MEMORY 1
+#endif
+
+module TransportSharedMemory;
+
+namespace Geneticxx {
+    namespace {
+        /**
+         * @brief Start of every ring, followed by the data bytes.
+         *
+         * Both positions only grow, the used part of the ring is [head, tail) modulo the capacity. The producer and
+         * the consumer each write one of them, kept on separate cache lines, and access them through atomic_ref, so
+         * the zero-filled memory of a new shared-memory object is a valid empty ring.
+         */
+        struct RingHeader {
+            alignas(64) std::uint64_t head; ///< Number of bytes read by the consumer.
+            alignas(64) std::uint64_t tail; ///< Number of bytes written by the producer.
+        };
+
+        using MessageLength = std::uint32_t;
+
+        std::byte *ringData(void *address) {
+            return static_cast<std::byte *>(address) + sizeof(RingHeader);
+        }
+
+        void copyIn(std::byte *data, std::size_t capacity, std::uint64_t position, const void *source,
+                    std::size_t size) {
+            const std::size_t offset = position & (capacity - 1);
+            const std::size_t first = std::min(size, capacity - offset);
+            std::memcpy(data + offset, source, first);
+            std::memcpy(data, static_cast<const std::byte *>(source) + first, size - first);
+        }
+
+        void copyOut(const std::byte *data, std::size_t capacity, std::uint64_t position, void *target,
+                     std::size_t size) {
+            const std::size_t offset = position & (capacity - 1);
+            const std::size_t first = std::min(size, capacity - offset);
+            std::memcpy(target, data + offset, first);
+            std::memcpy(static_cast<std::byte *>(target) + first, data, size - first);
+        }
+
+        /**
+         * @brief Checks the requested capacity of the rings and rounds it up to a power of two of at least 64 bytes.
+         *
+         * @throws std::invalid_argument If the capacity is 0 or does not fit a message length.
+         */
+        std::size_t ringCapacity(std::size_t capacity) {
+            if (capacity == 0 || capacity > std::numeric_limits<MessageLength>::max()) {
+                throw std::invalid_argument("Ring capacity must be between 1 and 2^32 - 1 bytes");
+            }
+            return std::bit_ceil(std::max<std::size_t>(capacity, 64));
+        }
+    }
+
+    TransportSharedMemory::TransportSharedMemory(std::string name, size_t island, size_t islands, size_t capacity)
+        : m_Name{std::move(name)}, m_Island{island}, m_Islands{islands},
+          m_Capacity{ringCapacity(capacity)}, m_Incoming(islands), m_Outgoing(islands) {
+        if (island >= islands) {
+            throw std::invalid_argument("Island index must be less than the number of islands");
+        }
+#ifndef GENETICXX_POSIX_SHARED_MEMORY
+        throw std::runtime_error("TransportSharedMemory requires POSIX shared memory");
+#else
+        try {
+            for (size_t source = 0; source < islands; source++) {
+                if (source != island) {
+                    m_Incoming[source] = mapRing(source, island);
+                }
+            }
+        } catch (...) {
+            for (auto &ring: m_Incoming) {
+                unmapRing(ring);
+            }
+            throw;
+        }
+#endif
+    }
+
+    TransportSharedMemory::~TransportSharedMemory() {
+        for (auto &ring: m_Outgoing) {
+            unmapRing(ring);
+        }
+        for (auto &ring: m_Incoming) {
+            unmapRing(ring);
+#ifdef GENETICXX_POSIX_SHARED_MEMORY
+            if (!ring.name.empty()) {
+                shm_unlink(ring.name.c_str());
+            }
+#endif
+        }
+    }
+
+    TransportSharedMemory::MappedRing TransportSharedMemory::mapRing(size_t source, size_t target) const {
+        MappedRing ring;
+        ring.name = "/" + m_Name + "-" + std::to_string(source) + "-" + std::to_string(target);
+#ifdef GENETICXX_POSIX_SHARED_MEMORY
+        const auto bytes = static_cast<off_t>(sizeof(RingHeader) + m_Capacity);
+        const int descriptor = shm_open(ring.name.c_str(), O_RDWR | O_CREAT, 0600);
+        if (descriptor < 0) {
+            throw std::runtime_error("Cannot open shared memory " + ring.name + ": " + std::strerror(errno));
+        }
+        // both islands of the ring may size it, they always agree on its size
+        struct stat status{};
+        if (fstat(descriptor, &status) != 0 || (status.st_size == 0 && ftruncate(descriptor, bytes) != 0)) {
+            const int error = errno;
+            close(descriptor);
+            throw std::runtime_error("Cannot size shared memory " + ring.name + ": " + std::strerror(error));
+        }
+        if (status.st_size != 0 && status.st_size != bytes) {
+            close(descriptor);
+            throw std::runtime_error("Shared memory " + ring.name + " was created with a different capacity");
+        }
+        void *address = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+        close(descriptor);
+        if (address == MAP_FAILED) {
+            throw std::runtime_error("Cannot map shared memory " + ring.name + ": " + std::strerror(errno));
+        }
+        ring.address = address;
+#endif
+        return ring;
+    }
+
+    void TransportSharedMemory::unmapRing(MappedRing &ring) const {
+#ifdef GENETICXX_POSIX_SHARED_MEMORY
+        if (ring.address != nullptr) {
+            munmap(ring.address, sizeof(RingHeader) + m_Capacity);
+        }
+#endif
+        ring.address = nullptr;
+    }
+
+    size_t TransportSharedMemory::getIslandIndex() const {
+        return m_Island;
+    }
+
+    size_t TransportSharedMemory::getIslandsNumber() const {
+        return m_Islands;
+    }
+
+    bool TransportSharedMemory::send(size_t target, std::span<const std::byte> message) {
+        if (target >= m_Islands || target == m_Island ||
+            sizeof(MessageLength) + message.size() > m_Capacity) {
+            return false;
+        }
+        auto &ring = m_Outgoing[target];
+        if (ring.address == nullptr) {
+            try {
+                ring = mapRing(m_Island, target);
+            } catch (const std::runtime_error &) {
+                return false;
+            }
+        }
+
+        auto header = static_cast<RingHeader *>(ring.address);
+        const std::uint64_t head = std::atomic_ref(header->head).load(std::memory_order_acquire);
+        const std::uint64_t tail = std::atomic_ref(header->tail).load(std::memory_order_relaxed);
+        const std::size_t frame = sizeof(MessageLength) + message.size();
+        if (m_Capacity - (tail - head) < frame) {
+            return false;
+        }
+        const auto length = static_cast<MessageLength>(message.size());
+        copyIn(ringData(ring.address), m_Capacity, tail, &length, sizeof(length));
+        copyIn(ringData(ring.address), m_Capacity, tail + sizeof(length), message.data(), message.size());
+        // publishes the message, the consumer reads the tail with acquire ordering
+        std::atomic_ref(header->tail).store(tail + frame, std::memory_order_release);
+        return true;
+    }
+
+    bool TransportSharedMemory::receive(std::vector<std::byte> &message) {
+        for (size_t visited = 0; visited < m_Islands; visited++) {
+            const size_t source = (m_NextSource + visited) % m_Islands;
+            auto &ring = m_Incoming[source];
+            if (ring.address == nullptr) {
+                continue;
+            }
+            auto header = static_cast<RingHeader *>(ring.address);
+            const std::uint64_t head = std::atomic_ref(header->head).load(std::memory_order_relaxed);
+            const std::uint64_t tail = std::atomic_ref(header->tail).load(std::memory_order_acquire);
+            if (head == tail) {
+                continue;
+            }
+            const std::uint64_t used = tail - head;
+            MessageLength length = 0;
+            if (used >= sizeof(length)) {
+                copyOut(ringData(ring.address), m_Capacity, head, &length, sizeof(length));
+            }
+            // the ring lives in memory other processes can write, a corrupt one must not make us read past it
+            if (used > m_Capacity || used < sizeof(length) || length > used - sizeof(length) ||
+                length > m_Capacity - sizeof(length)) {
+                unmapRing(ring);
+                continue;
+            }
+            message.resize(length);
+            copyOut(ringData(ring.address), m_Capacity, head + sizeof(length), message.data(), length);
+            // frees the space, the producer reads the head with acquire ordering
+            std::atomic_ref(header->head).store(head + sizeof(length) + length, std::memory_order_release);
+            m_NextSource = source + 1;
+            return true;
+        }
+        return false;
+    }
+}
@@ -0,0 +1,93 @@
+export module TransportSharedMemory;
+
+export import MigrationTransport;
+import std;
+import std.compat;
+
+namespace Geneticxx {
+    /**
+     * @class TransportSharedMemory
+     * @brief Migration transport between processes of the same machine over POSIX shared-memory ring buffers.
+     *
+     * Every ordered pair of islands has its own single-producer, single-consumer ring buffer, stored in the
+     * shared-memory object `/<name>-<source>-<target>`. The head and tail of a ring are lock-free atomics, so
+     * sending and receiving never block and never enter the kernel once the rings are mapped. A ring is created
+     * by whichever of its two islands opens it first; a zero-filled ring is a valid empty ring, so no further
+     * initialization is needed. Each island unlinks its incoming rings when its transport is destroyed.
+     *
+     * Only available on POSIX systems; elsewhere the constructor throws.
+     */
+    export class TransportSharedMemory : public MigrationTransport {
+    private:
+        /// A ring buffer mapped into this process.
+        struct MappedRing {
+            std::string name; ///< Name of the shared-memory object.
+            void *address = nullptr; ///< Address of the mapping, null if the ring is not mapped yet.
+        };
+
+        std::string m_Name; ///< Prefix of the names of the shared-memory objects.
+        size_t m_Island; ///< Index of the island owning the transport.
+        size_t m_Islands; ///< Number of islands.
+        size_t m_Capacity; ///< Number of data bytes of every ring, a power of two.
+        size_t m_NextSource = 0; ///< Island whose ring is read first by the next `receive`.
+        std::vector<MappedRing> m_Incoming; ///< Rings from every island to this one, indexed by the source.
+        std::vector<MappedRing> m_Outgoing; ///< Rings from this island to every other, mapped on first use.
+
+        /**
+         * @brief Creates or opens the ring from `source` to `target` and maps it.
+         */
+        MappedRing mapRing(size_t source, size_t target) const;
+
+        /**
+         * @brief Unmaps a ring mapped by `mapRing`.
+         */
+        void unmapRing(MappedRing &ring) const;
+
+    public:
+        /// Default number of data bytes of every ring.
+        static constexpr size_t DefaultCapacity = size_t{1} << 20;
+
+        /**
+         * @brief Creates the transport of one island and maps the rings it receives from.
+         *
+         * All islands of a run have to use the same name, number of islands and capacity.
+         *
+         * @param name Name of the run, prefix of the shared-memory objects; must not contain '/'.
+         * @param island Index of the island owning the transport.
+         * @param islands Number of islands.
+         * @param capacity Number of data bytes of every ring, rounded up to a power of two.
+         *
+         * @throws std::invalid_argument If the island index or the capacity is invalid.
+         * @throws std::runtime_error If a ring cannot be created or mapped, or shared memory is not supported.
+         */
+        TransportSharedMemory(std::string name, size_t island, size_t islands, size_t capacity = DefaultCapacity);
+
+        TransportSharedMemory(const TransportSharedMemory &) = delete;
+
+        TransportSharedMemory &operator=(const TransportSharedMemory &) = delete;
+
+        /**
+         * @brief Unmaps all rings and unlinks the rings this island receives from.
+         */
+        ~TransportSharedMemory() override;
+
+        size_t getIslandIndex() const override;
+
+        size_t getIslandsNumber() const override;
+
+        /**
+         * @brief Copies the message into the ring from this island to `target`.
+         *
+         * @return False if the ring cannot be mapped or has no room for the message.
+         */
+        bool send(size_t target, std::span<const std::byte> message) override;
+
+        /**
+         * @brief Reads the next message from the incoming rings, visiting the sources in turn.
+         *
+         * A ring whose positions or message length do not fit its capacity, as after a write by a foreign or crashed
+         * process, is unmapped and not read any further.
+         */
+        bool receive(std::vector<std::byte> &message) override;
+    };
+}
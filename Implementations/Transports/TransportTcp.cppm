@@ -0,0 +1,339 @@
+module;
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#define GENETICXX_POSIX_SOCKETS 1
+#endif
+
+module TransportTcp;
+
+namespace Geneticxx {
+    namespace {
+        using MessageLength = std::uint32_t;
+
+        std::vector<TcpEndpoint> loopbackEndpoints(std::uint16_t basePort, std::size_t islands) {
+            std::vector<TcpEndpoint> endpoints(islands);
+            for (std::size_t i = 0; i < islands; i++) {
+                endpoints[i].port = static_cast<std::uint16_t>(basePort + i);
+            }
+            return endpoints;
+        }
+
+        /**
+         * @brief Moves the first whole message of `pending` to `message`.
+         *
+         * @return False if `pending` does not hold a whole message yet.
+         */
+        bool takeMessage(std::vector<std::byte> &pending, std::vector<std::byte> &message) {
+            MessageLength length;
+            if (pending.size() < sizeof(length)) {
+                return false;
+            }
+            std::memcpy(&length, pending.data(), sizeof(length));
+            if (pending.size() - sizeof(length) < length) {
+                return false;
+            }
+            const auto begin = pending.begin() + sizeof(length);
+            message.assign(begin, begin + length);
+            pending.erase(pending.begin(), begin + length);
+            return true;
+        }
+
+#ifdef GENETICXX_POSIX_SOCKETS
+        /// Addresses of an endpoint, released on destruction.
+        struct ResolvedAddresses {
+            addrinfo *list = nullptr;
+
+            ~ResolvedAddresses() {
+                if (list != nullptr) {
+                    freeaddrinfo(list);
+                }
+            }
+        };
+
+        bool resolve(const TcpEndpoint &endpoint, bool passive, ResolvedAddresses &addresses) {
+            addrinfo hints{};
+            hints.ai_family = AF_UNSPEC;
+            hints.ai_socktype = SOCK_STREAM;
+            hints.ai_flags = passive ? AI_PASSIVE : 0;
+            return getaddrinfo(endpoint.host.c_str(), std::to_string(endpoint.port).c_str(), &hints,
+                               &addresses.list) == 0;
+        }
+
+        void setNonBlocking(int socket) {
+            fcntl(socket, F_SETFL, fcntl(socket, F_GETFL) | O_NONBLOCK);
+        }
+
+#ifdef MSG_NOSIGNAL
+        constexpr int SendFlags = MSG_NOSIGNAL;
+#else
+        constexpr int SendFlags = 0;
+#endif
+
+        /**
+         * @brief Writes as many bytes to a non-blocking socket as fit without waiting.
+         *
+         * @return Number of bytes written, or -1 if the connection failed.
+         */
+        std::ptrdiff_t sendSome(int socket, std::span<const std::byte> bytes) {
+            std::size_t total = 0;
+            while (total < bytes.size()) {
+                const auto written = ::send(socket, bytes.data() + total, bytes.size() - total, SendFlags);
+                if (written > 0) {
+                    total += static_cast<std::size_t>(written);
+                } else if (written < 0 && errno == EINTR) {
+                    continue;
+                } else if (written < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                    break;
+                } else {
+                    return -1;
+                }
+            }
+            return static_cast<std::ptrdiff_t>(total);
+        }
+
+        void closeOutgoing(int &socket, std::vector<std::byte> &unsent) {
+            close(socket);
+            socket = -1;
+            // the receiver drops the partial message together with the connection
+            unsent.clear();
+        }
+#endif
+    }
+
+    TransportTcp::TransportTcp(std::vector<TcpEndpoint> endpoints, size_t island)
+        : m_Endpoints{std::move(endpoints)}, m_Island{island}, m_Outgoing(m_Endpoints.size()) {
+        if (island >= m_Endpoints.size()) {
+            throw std::invalid_argument("Island index must be less than the number of islands");
+        }
+#ifndef GENETICXX_POSIX_SOCKETS
+        throw std::runtime_error("TransportTcp requires POSIX sockets");
+#else
+        // resolving may wait for a name server, so it is done once here and never by `send`
+        for (size_t target = 0; target < m_Endpoints.size(); target++) {
+            if (target == island) {
+                continue;
+            }
+            ResolvedAddresses addresses;
+            if (!resolve(m_Endpoints[target], false, addresses)) {
+                throw std::runtime_error("Cannot resolve " + m_Endpoints[target].host);
+            }
+            for (auto address = addresses.list; address != nullptr; address = address->ai_next) {
+                const auto bytes = reinterpret_cast<const std::byte *>(address->ai_addr);
+                m_Outgoing[target].addresses.push_back(SocketAddress{
+                    address->ai_family, address->ai_socktype, address->ai_protocol,
+                    std::vector<std::byte>(bytes, bytes + address->ai_addrlen)
+                });
+            }
+        }
+
+        const auto &endpoint = m_Endpoints[island];
+        ResolvedAddresses addresses;
+        if (!resolve(endpoint, true, addresses)) {
+            throw std::runtime_error("Cannot resolve " + endpoint.host);
+        }
+        for (auto address = addresses.list; address != nullptr && m_Listener < 0; address = address->ai_next) {
+            const int listener = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+            if (listener < 0) {
+                continue;
+            }
+            const int reuse = 1;
+            setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+            if (bind(listener, address->ai_addr, address->ai_addrlen) == 0 && listen(listener, SOMAXCONN) == 0) {
+                m_Listener = listener;
+            } else {
+                close(listener);
+            }
+        }
+        if (m_Listener < 0) {
+            throw std::runtime_error("Cannot listen on " + endpoint.host + ":" + std::to_string(endpoint.port));
+        }
+        setNonBlocking(m_Listener);
+#endif
+    }
+
+    TransportTcp::TransportTcp(std::uint16_t basePort, size_t island, size_t islands)
+        : TransportTcp(loopbackEndpoints(basePort, islands), island) {
+    }
+
+    TransportTcp::~TransportTcp() {
+#ifdef GENETICXX_POSIX_SOCKETS
+        for (const auto &connection: m_Outgoing) {
+            if (connection.socket >= 0) {
+                close(connection.socket);
+            }
+        }
+        for (const auto &connection: m_Incoming) {
+            if (connection.socket >= 0) {
+                close(connection.socket);
+            }
+        }
+        if (m_Listener >= 0) {
+            close(m_Listener);
+        }
+#endif
+    }
+
+    size_t TransportTcp::getIslandIndex() const {
+        return m_Island;
+    }
+
+    size_t TransportTcp::getIslandsNumber() const {
+        return m_Endpoints.size();
+    }
+
+    void TransportTcp::acceptConnections() {
+#ifdef GENETICXX_POSIX_SOCKETS
+        for (int socket = accept(m_Listener, nullptr, nullptr); socket >= 0;
+             socket = accept(m_Listener, nullptr, nullptr)) {
+            setNonBlocking(socket);
+            m_Incoming.push_back(Connection{socket, {}});
+        }
+#endif
+    }
+
+    int TransportTcp::connectTo(size_t target, bool &connected) const {
+#ifdef GENETICXX_POSIX_SOCKETS
+        for (const auto &address: m_Outgoing[target].addresses) {
+            const int socket = ::socket(address.family, address.type, address.protocol);
+            if (socket < 0) {
+                continue;
+            }
+            setNonBlocking(socket);
+            // migrants are sent as soon as they are selected, without waiting to fill a segment
+            const int enabled = 1;
+            setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled));
+#ifdef SO_NOSIGPIPE
+            setsockopt(socket, SOL_SOCKET, SO_NOSIGPIPE, &enabled, sizeof(enabled));
+#endif
+            if (connect(socket, reinterpret_cast<const sockaddr *>(address.bytes.data()),
+                        static_cast<socklen_t>(address.bytes.size())) == 0) {
+                connected = true;
+                return socket;
+            }
+            if (errno == EINPROGRESS) {
+                connected = false;
+                return socket;
+            }
+            close(socket);
+        }
+#endif
+        return -1;
+    }
+
+    bool TransportTcp::flush(Outgoing &connection) {
+#ifdef GENETICXX_POSIX_SOCKETS
+        if (!connection.connected) {
+            pollfd descriptor{connection.socket, POLLOUT, 0};
+            if (poll(&descriptor, 1, 0) <= 0) {
+                return false;
+            }
+            int error = 0;
+            socklen_t size = sizeof(error);
+            if (getsockopt(connection.socket, SOL_SOCKET, SO_ERROR, &error, &size) != 0 || error != 0) {
+                closeOutgoing(connection.socket, connection.unsent);
+                return false;
+            }
+            connection.connected = true;
+        }
+        if (connection.unsent.empty()) {
+            return true;
+        }
+        const auto written = sendSome(connection.socket, connection.unsent);
+        if (written < 0) {
+            closeOutgoing(connection.socket, connection.unsent);
+            return false;
+        }
+        connection.unsent.erase(connection.unsent.begin(), connection.unsent.begin() + written);
+        return connection.unsent.empty();
+#else
+        return false;
+#endif
+    }
+
+    bool TransportTcp::send(size_t target, std::span<const std::byte> message) {
+        if (target >= m_Endpoints.size() || target == m_Island ||
+            message.size() > std::numeric_limits<MessageLength>::max()) {
+            return false;
+        }
+#ifdef GENETICXX_POSIX_SOCKETS
+        auto &connection = m_Outgoing[target];
+        if (connection.socket < 0) {
+            connection.socket = connectTo(target, connection.connected);
+            if (connection.socket < 0) {
+                return false;
+            }
+        }
+        // the message is dropped while connecting or while an earlier message is still being written
+        if (!flush(connection)) {
+            return false;
+        }
+        const auto length = static_cast<MessageLength>(message.size());
+        const auto lengthBytes = std::as_bytes(std::span(&length, 1));
+        m_Frame.assign(lengthBytes.begin(), lengthBytes.end());
+        m_Frame.insert(m_Frame.end(), message.begin(), message.end());
+        const auto written = sendSome(connection.socket, m_Frame);
+        if (written < 0) {
+            closeOutgoing(connection.socket, connection.unsent);
+            return false;
+        }
+        if (written == 0) {
+            // nothing of the message was written, so dropping it keeps the stream consistent
+            return false;
+        }
+        connection.unsent.assign(m_Frame.begin() + written, m_Frame.end());
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool TransportTcp::receive(std::vector<std::byte> &message) {
+#ifdef GENETICXX_POSIX_SOCKETS
+        for (auto &connection: m_Outgoing) {
+            if (connection.socket >= 0) {
+                flush(connection);
+            }
+        }
+        acceptConnections();
+        std::array<std::byte, 16384> chunk;
+        bool found = false;
+        for (size_t visited = 0; visited < m_Incoming.size() && !found; visited++) {
+            const size_t index = (m_NextConnection + visited) % m_Incoming.size();
+            auto &connection = m_Incoming[index];
+            bool closed = false;
+            while (true) {
+                const auto received = recv(connection.socket, chunk.data(), chunk.size(), 0);
+                if (received > 0) {
+                    connection.pending.insert(connection.pending.end(), chunk.begin(), chunk.begin() + received);
+                } else if (received < 0 && errno == EINTR) {
+                    continue;
+                } else {
+                    // 0 means the peer closed the connection, EAGAIN that nothing more is waiting
+                    closed = received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK);
+                    break;
+                }
+            }
+            // whole messages received before the connection was closed are still delivered
+            if (takeMessage(connection.pending, message)) {
+                m_NextConnection = index + 1;
+                found = true;
+            } else if (closed) {
+                close(connection.socket);
+                connection.socket = -1;
+            }
+        }
+        std::erase_if(m_Incoming, [](const Connection &connection) { return connection.socket < 0; });
+        return found;
+#else
+        return false;
+#endif
+    }
+}
@@ -0,0 +1,139 @@
+export module TransportTcp;
+
+export import MigrationTransport;
+import std;
+import std.compat;
+
+namespace Geneticxx {
+    /**
+     * @struct TcpEndpoint
+     * @brief Address on which an island accepts messages.
+     */
+    export struct TcpEndpoint {
+        std::string host = "127.0.0.1"; ///< Host name or numeric address of the island.
+        std::uint16_t port = 0; ///< Port the island listens on.
+    };
+
+    /**
+     * @class TransportTcp
+     * @brief Migration transport over TCP connections, on the loopback interface or between hosts.
+     *
+     * Every island listens on its own endpoint and opens one connection to every island it sends to, on the first
+     * message for it. Messages are framed with their length. All sockets are non-blocking, so neither `send` nor
+     * `receive` ever waits: messages that cannot be delivered at once, because the connection is still being
+     * established, the target is not listening yet or its socket buffer is full, are dropped, and a failed
+     * connection is retried with the next message. When only the beginning of a message fits into the socket
+     * buffer, the rest is kept and written before any later message, by `send` or `receive`, so the stream of
+     * frames stays consistent. Hosts have to share the same byte order, see `Genome::serialize`.
+     *
+     * Only available on POSIX systems; elsewhere the constructor throws.
+     */
+    export class TransportTcp : public MigrationTransport {
+    private:
+        /// An accepted connection together with the bytes received on it that do not form a whole message yet.
+        struct Connection {
+            int socket = -1; ///< Descriptor of the connection.
+            std::vector<std::byte> pending; ///< Received bytes not returned by `receive` yet.
+        };
+
+        /// Socket address of an island as resolved from its endpoint, with the parameters to create a socket for it.
+        struct SocketAddress {
+            int family = 0; ///< Address family of the socket.
+            int type = 0; ///< Type of the socket.
+            int protocol = 0; ///< Protocol of the socket.
+            std::vector<std::byte> bytes; ///< The address itself, as passed to `connect`.
+        };
+
+        /// A connection to another island together with the bytes of a message that were not written yet.
+        struct Outgoing {
+            std::vector<SocketAddress> addresses; ///< Addresses of the island, resolved once on construction.
+            int socket = -1; ///< Descriptor of the connection, -1 if not connected.
+            bool connected = false; ///< False while the connection is still being established.
+            std::vector<std::byte> unsent; ///< Rest of a partially written message, written before any other.
+        };
+
+        std::vector<TcpEndpoint> m_Endpoints; ///< Endpoints of all islands, indexed by island.
+        size_t m_Island; ///< Index of the island owning the transport.
+        int m_Listener = -1; ///< Listening socket of this island.
+        std::vector<Outgoing> m_Outgoing; ///< Connection to every island.
+        std::vector<std::byte> m_Frame; ///< Buffer of the framed message being sent.
+        std::vector<Connection> m_Incoming; ///< Connections accepted from other islands.
+        size_t m_NextConnection = 0; ///< Connection read first by the next `receive`.
+
+        /**
+         * @brief Accepts the connections waiting on the listening socket.
+         */
+        void acceptConnections();
+
+        /**
+         * @brief Starts connecting to an island without waiting for the connection to be established.
+         *
+         * @param target Index of the island.
+         * @param connected Set to true if the connection was established at once.
+         * @return The descriptor of the connection, or -1 if the island is not reachable.
+         */
+        int connectTo(size_t target, bool &connected) const;
+
+        /**
+         * @brief Completes the connection and the message partially written to it, as far as possible without
+         *        waiting. Closes the connection if it failed.
+         *
+         * @return True if the connection is ready for a new message.
+         */
+        bool flush(Outgoing &connection);
+
+    public:
+        /**
+         * @brief Creates the transport of one island and starts listening on its endpoint.
+         *
+         * The endpoints of all islands are resolved here once, so reconnecting never waits for name resolution.
+         *
+         * @param endpoints Endpoints of all islands of the run, indexed by island; the same on every island.
+         * @param island Index of the island owning the transport.
+         *
+         * @throws std::invalid_argument If the island index is invalid.
+         * @throws std::runtime_error If an endpoint cannot be resolved, the island's endpoint cannot be listened on,
+         *         or sockets are not supported.
+         */
+        TransportTcp(std::vector<TcpEndpoint> endpoints, size_t island);
+
+        /**
+         * @brief Creates the transport of one island of a run on the loopback interface.
+         *
+         * Island `i` listens on port `basePort + i` of 127.0.0.1.
+         *
+         * @param basePort Port of the first island.
+         * @param island Index of the island owning the transport.
+         * @param islands Number of islands.
+         */
+        TransportTcp(std::uint16_t basePort, size_t island, size_t islands);
+
+        TransportTcp(const TransportTcp &) = delete;
+
+        TransportTcp &operator=(const TransportTcp &) = delete;
+
+        /**
+         * @brief Closes all connections and the listening socket.
+         */
+        ~TransportTcp() override;
+
+        size_t getIslandIndex() const override;
+
+        size_t getIslandsNumber() const override;
+
+        /**
+         * @brief Writes the framed message to the connection to `target`, connecting first if needed.
+         *
+         * @return False if the target is not reachable, the connection is not established yet, failed or cannot
+         *         take the message without waiting; the message is dropped then.
+         */
+        bool send(size_t target, std::span<const std::byte> message) override;
+
+        /**
+         * @brief Reads what arrived on the accepted connections and returns the first whole message.
+         *
+         * Also writes what is left of partially written outgoing messages.
+         */
+        bool receive(std::vector<std::byte> &message) override;
+    };
+}
@@ -0,0 +1,77 @@
+#include "../doctest.h"
+#include "../TestIndividuals.h"
+
+import GenerationPool;
+import std;
+
+using namespace Geneticxx;
+
+namespace GenerationPoolTest {
+    std::unique_ptr<Individual> createIndividual() {
+        return std::unique_ptr<Individual>(TestIndividuals::createIndividual(std::vector<int>(64, 1)));
+    }
+
+    TEST_SUITE("GenerationPool") {
+        TEST_CASE("Objects created while the pool is set are served by it and returned to it") {
+            GenerationPool pool;
+            std::vector<std::unique_ptr<Individual> > individuals;
+            {
+                ObjectResourceScope scope(&pool);
+                for (int i = 0; i < 10; i++) {
+                    individuals.push_back(createIndividual());
+                }
+                CHECK(getObjectResource() == &pool);
+            }
+            CHECK(getObjectResource() == std::pmr::get_default_resource());
+
+            const auto statistics = pool.getStatistics();
+            CHECK(statistics.allocations >= 30);
+            CHECK(statistics.deallocations == 0);
+            CHECK(statistics.bytesInUse == statistics.bytesAllocated);
+            CHECK(statistics.bytesInUse >= 10 * 64 * sizeof(int));
+
+            CHECK_THROWS_AS(pool.release(), std::logic_error);
+
+            individuals.clear();
+            CHECK(pool.getStatistics().bytesInUse == 0);
+            CHECK(pool.getStatistics().deallocations == statistics.allocations);
+            CHECK(pool.getStatistics().peakBytesInUse == statistics.bytesAllocated);
+
+            pool.release();
+            CHECK(pool.getStatistics().allocations == 0);
+        }
+
+        TEST_CASE("Clones are allocated from the pool current when cloning") {
+            GenerationPool pool;
+            auto original = createIndividual();
+            {
+                ObjectResourceScope scope(&pool);
+                std::unique_ptr<Individual> clone(original->clone());
+                CHECK(pool.getStatistics().allocations >= 3);
+                CHECK(clone->getGenome()->getSize() == 64);
+            }
+            CHECK(pool.getStatistics().bytesInUse == 0);
+        }
+
+        TEST_CASE("Generations report the allocations served since the previous one") {
+            GenerationPool pool;
+            ObjectResourceScope scope(&pool);
+            auto survivor = createIndividual();
+            const auto first = pool.endGeneration();
+            CHECK(first.allocations >= 3);
+            CHECK(first.bytesInUse == first.bytesAllocated);
+
+            for (int i = 0; i < 5; i++) {
+                createIndividual();
+            }
+            const auto second = pool.endGeneration();
+            CHECK(second.allocations == 5 * first.allocations);
+            CHECK(second.deallocations == second.allocations);
+            CHECK(second.bytesInUse == first.bytesInUse);
+            CHECK(second.peakBytesInUse == 2 * first.bytesInUse);
+
+            survivor.reset();
+            CHECK(pool.endGeneration().bytesInUse == 0);
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#include "../doctest.h"
+
+import CrossoverUniform;
+import GenomeBitVector;
+import GenomeVector;
+import PhiloxUniformIntRandomGenerator;
+import std;
+
+using namespace Geneticxx;
+
+namespace CrossoverUniformTest {
+    std::vector<bool> pattern(size_t size, size_t stride) {
+        std::vector<bool> bits(size);
+        for (size_t i = 0; i < size; i++) {
+            bits[i] = i % stride == 0;
+        }
+        return bits;
+    }
+
+    TEST_SUITE("CrossoverUniform") {
+        TEST_CASE("crossover: Packed children exchange every bit between the parents") {
+            PhiloxUniformIntRandomGenerator genInt(1);
+            CrossoverUniform crossover(&genInt);
+            GenomeBitVector parent1(pattern(150, 2));
+            GenomeBitVector parent2(pattern(150, 3));
+
+            auto children = crossover.crossover(&parent1, &parent2);
+
+            REQUIRE(children.size() == 2);
+            auto child1 = dynamic_cast<GenomeBitVector *>(children[0].get());
+            auto child2 = dynamic_cast<GenomeBitVector *>(children[1].get());
+            REQUIRE(child1->getSize() == 150);
+            for (size_t i = 0; i < 150; i++) {
+                const bool bit1 = std::any_cast<bool>(child1->getValue(i));
+                const bool bit2 = std::any_cast<bool>(child2->getValue(i));
+                const bool from1 = std::any_cast<bool>(parent1.getValue(i));
+                const bool from2 = std::any_cast<bool>(parent2.getValue(i));
+                CHECK(((bit1 == from1 && bit2 == from2) || (bit1 == from2 && bit2 == from1)));
+            }
+            CHECK(child1->countOnes() + child2->countOnes() == parent1.countOnes() + parent2.countOnes());
+        }
+
+        TEST_CASE("Parents of different sizes are rejected") {
+            PhiloxUniformIntRandomGenerator genInt(2);
+            CrossoverUniform crossover(&genInt);
+            GenomeBitVector shortBits(64), longBits(130);
+            GenomeBitVector child1(130), child2(130);
+            CHECK_THROWS_AS(crossover.crossover(&shortBits, &longBits), std::invalid_argument);
+            CHECK_THROWS_AS(crossover.crossover(&longBits, &shortBits), std::invalid_argument);
+            CHECK_THROWS_AS(crossover.crossoverInto(&shortBits, &longBits, &child1, &child2), std::invalid_argument);
+
+            GenomeVector<int> shortValues(std::vector<int>(3, 1)), longValues(std::vector<int>(5, 2));
+            CHECK_THROWS_AS(crossover.crossover(&shortValues, &longValues), std::invalid_argument);
+        }
+    }
+}
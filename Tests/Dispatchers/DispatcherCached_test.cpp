@@ -0,0 +1,110 @@
+#include "../doctest.h"
+#include "../TestIndividuals.h"
+
+import DispatcherCached;
+import DispatcherNoDispatch;
+import PopulationSimple;
+import GenomeVector;
+import std;
+
+using namespace Geneticxx;
+
+namespace DispatcherCachedTest {
+    // Sums the phenome's values and counts how many times it was called.
+    class CountingEvaluation : public Evaluation {
+    public:
+        std::atomic<int> calls{0};
+
+        std::vector<double> evaluate(const Phenome *phenome) override {
+            calls++;
+            auto values = dynamic_cast<const Phenome1DView<int> *>(phenome)->getValues();
+            return {static_cast<double>(std::accumulate(values.begin(), values.end(), 0))};
+        }
+    };
+
+    using TestIndividuals::createIndividual;
+
+    TEST_SUITE("DispatcherCached") {
+        TEST_CASE("dispatch: Evaluates every distinct genome only once") {
+            // Arrange
+            PopulationSimple population;
+            population.resize(4);
+            population.setIndividual(0, createIndividual({1, 2, 3}));
+            population.setIndividual(1, createIndividual({4, 5, 6}));
+            population.setIndividual(2, createIndividual({1, 2, 3}));
+            population.setIndividual(3, createIndividual({7, 8, 9}));
+            auto evaluation = std::make_unique<CountingEvaluation>();
+            auto counter = evaluation.get();
+            std::vector<std::unique_ptr<Evaluation>> evaluations;
+            evaluations.push_back(std::move(evaluation));
+            DispatcherCached dispatcher(new DispatcherNoDispatch(), 16);
+            // Act
+            dispatcher.dispatch(&population, &evaluations);
+            dispatcher.dispatch(&population, &evaluations);
+            // Assert: the first call misses all four genomes, the second one hits all of them.
+            CHECK(counter->calls == 4);
+            CHECK(dispatcher.getCache().getMisses() == 4);
+            CHECK(dispatcher.getCache().getHits() == 4);
+            CHECK(dispatcher.getCache().getSize() == 3);
+            CHECK(population.getIndividual(2)->getObjectiveScore() == std::vector<double>{6.0});
+            CHECK(population.getIndividual(3)->getObjectiveScore() == std::vector<double>{24.0});
+        }
+
+        TEST_CASE("dispatch: Concurrent calls each score their own population") {
+            std::vector<std::unique_ptr<Evaluation>> evaluations;
+            evaluations.push_back(std::make_unique<CountingEvaluation>());
+            DispatcherCached dispatcher(new DispatcherNoDispatch(), 4096);
+            std::vector<std::unique_ptr<PopulationSimple>> populations;
+            for (int t = 0; t < 4; t++) {
+                auto population = std::make_unique<PopulationSimple>();
+                population->resize(50);
+                for (int i = 0; i < 50; i++) {
+                    population->setIndividual(i, createIndividual({t, i, i % 7}));
+                }
+                populations.push_back(std::move(population));
+            }
+            // individuals whose scores did not match their own genes
+            std::atomic<int> wrong{0};
+            std::vector<std::thread> callers;
+            for (int t = 0; t < 4; t++) {
+                callers.emplace_back([&, t]() {
+                    auto &population = populations[t];
+                    for (int round = 0; round < 10; round++) {
+                        dispatcher.dispatch(population.get(), &evaluations);
+                        for (int i = 0; i < 50; i++) {
+                            const double expected = t + i + i % 7;
+                            wrong += population->getIndividual(i)->getObjectiveScore() == std::vector{expected} ? 0 : 1;
+                        }
+                    }
+                });
+            }
+            for (auto &caller: callers) {
+                caller.join();
+            }
+            CHECK(wrong == 0);
+            CHECK(dispatcher.getCache().getMisses() == 200);
+        }
+
+        TEST_CASE("EvaluationCache: Evicts entries beyond the capacity") {
+            EvaluationCache cache(2, 1);
+            GenomeVector<int> first({1}), second({2}), third({3});
+            std::vector<double> scores;
+            cache.insert(&first, std::vector<double>{1.0});
+            cache.insert(&second, std::vector<double>{2.0});
+            // mark the first entry as recently used, so the clock hand evicts the second one
+            CHECK(cache.lookup(&first, scores));
+            cache.insert(&third, std::vector<double>{3.0});
+
+            CHECK(cache.getSize() == 2);
+            CHECK(cache.lookup(&first, scores));
+            CHECK(scores == std::vector<double>{1.0});
+            CHECK_FALSE(cache.lookup(&second, scores));
+            CHECK(cache.lookup(&third, scores));
+            CHECK(scores == std::vector<double>{3.0});
+        }
+
+        TEST_CASE("EvaluationCache: Zero capacity is rejected") {
+            CHECK_THROWS_AS(EvaluationCache(0), std::invalid_argument);
+        }
+    }
+}
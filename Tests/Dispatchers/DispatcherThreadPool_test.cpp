@@ -0,0 +1,248 @@
+#include "../doctest.h"
+
+import DispatcherThreadPool;
+import Evaluation;
+import Individual;
+import Population;
+import std;
+
+using namespace Geneticxx;
+
+namespace DispatcherThreadPoolTest {
+    class DummyIndividual : public Individual {
+    private:
+        double fitness = 0.0;
+        std::vector<double> objScore;
+    public:
+        DummyIndividual() = default;
+        ~DummyIndividual() override { }
+
+        Individual* createNew() const override { return new DummyIndividual(); }
+        Individual* clone() const override { return new DummyIndividual(*this); }
+
+        double getFitness() const override { return fitness; }
+        void setFitness(double f) override { fitness = f; }
+
+        std::vector<double> getObjectiveScore() const override { return objScore; }
+        void setObjectiveScore(std::vector<double> *score) override { objScore = *score; }
+
+        void updatePhenome() override { }
+
+        const Genome* getGenome() const override { return nullptr; }
+        Genome* getGenome() override { return nullptr; }
+        void setGenome(Genome* /*genome*/) override { }
+
+        const Phenome* getPhenome() const override { return nullptr; }
+        void setPhenome(Phenome* /*phenome*/) override { }
+    };
+
+    class DummyPopulation : public Population {
+    public:
+        std::vector<std::unique_ptr<Individual>> individuals;
+
+        explicit DummyPopulation(size_t size) {
+            for (size_t i = 0; i < size; i++) {
+                individuals.push_back(std::make_unique<DummyIndividual>());
+            }
+        }
+
+        [[nodiscard]] std::unique_ptr<Population> createNew() const override {
+            return std::make_unique<DummyPopulation>(0);
+        }
+        [[nodiscard]] std::unique_ptr<Population> clone() const override {
+            return std::make_unique<DummyPopulation>(individuals.size());
+        }
+        Individual* getIndividual(size_t i) override { return individuals[i].get(); }
+        void setIndividual(size_t i, Individual* individual) override { individuals[i].reset(individual); }
+        size_t getSize() const override { return individuals.size(); }
+        size_t getIteration() const override { return 0; }
+        void increaseIteration() override { }
+        void resize(size_t size) override { individuals.resize(size); }
+        void clear() override { individuals.clear(); }
+    };
+
+    // Counts calls from all workers; returns a constant score.
+    class CountingEvaluation : public Evaluation {
+    public:
+        std::atomic<int> calls{0};
+        double score;
+
+        explicit CountingEvaluation(double s) : score(s) { }
+
+        std::vector<double> evaluate(const Phenome* /*phenome*/) override {
+            ++calls;
+            return {score};
+        }
+    };
+
+    // Declares two objectives and counts the phenomes it receives through evaluateBatch.
+    class BatchEvaluation : public Evaluation {
+    public:
+        std::atomic<int> calls{0};
+        std::atomic<int> batched{0};
+
+        std::vector<double> evaluate(const Phenome* /*phenome*/) override {
+            ++calls;
+            return {3.0, 4.0};
+        }
+
+        size_t getObjectivesNumber() const override { return 2; }
+
+        void evaluateBatch(std::span<const Phenome* const> phenomes, std::span<double> scores) override {
+            batched += static_cast<int>(phenomes.size());
+            for (size_t i = 0; i < phenomes.size(); i++) {
+                scores[2 * i] = 3.0;
+                scores[2 * i + 1] = 4.0;
+            }
+        }
+    };
+
+    class ThrowingEvaluation : public Evaluation {
+    public:
+        std::vector<double> evaluate(const Phenome* /*phenome*/) override {
+            throw std::runtime_error("evaluation failed");
+        }
+    };
+
+    TEST_SUITE("DispatcherThreadPool") {
+        TEST_CASE("dispatch: Every individual receives the scores of all evaluations") {
+            // Arrange
+            DispatcherThreadPool dispatcher(4);
+            DummyPopulation population(1001);
+            std::vector<std::unique_ptr<Evaluation>> evaluations;
+            evaluations.push_back(std::make_unique<CountingEvaluation>(1.0));
+            evaluations.push_back(std::make_unique<CountingEvaluation>(2.0));
+            // Act
+            dispatcher.dispatch(&population, &evaluations);
+            // Assert
+            CHECK(dynamic_cast<CountingEvaluation*>(evaluations[0].get())->calls == 1001);
+            CHECK(dynamic_cast<CountingEvaluation*>(evaluations[1].get())->calls == 1001);
+            for (size_t i = 0; i < population.getSize(); i++) {
+                CHECK(population.getIndividual(i)->getObjectiveScore() == std::vector<double>{1.0, 2.0});
+            }
+        }
+
+        TEST_CASE("dispatch: Pool can be reused across many generations and sizes") {
+            DispatcherThreadPool dispatcher(3);
+            std::vector<std::unique_ptr<Evaluation>> evaluations;
+            evaluations.push_back(std::make_unique<CountingEvaluation>(5.0));
+            int expected = 0;
+            for (size_t size : {0, 1, 2, 7, 64, 500}) {
+                DummyPopulation population(size);
+                dispatcher.dispatch(&population, &evaluations);
+                expected += static_cast<int>(size);
+            }
+            CHECK(dynamic_cast<CountingEvaluation*>(evaluations[0].get())->calls == expected);
+        }
+
+        TEST_CASE("dispatch: Exception thrown by an evaluation is propagated to the caller") {
+            DispatcherThreadPool dispatcher(2);
+            DummyPopulation population(10);
+            std::vector<std::unique_ptr<Evaluation>> evaluations;
+            evaluations.push_back(std::make_unique<ThrowingEvaluation>());
+            CHECK_THROWS_AS(dispatcher.dispatch(&population, &evaluations), std::runtime_error);
+            // The pool stays usable after a failed dispatch.
+            evaluations.clear();
+            evaluations.push_back(std::make_unique<CountingEvaluation>(1.0));
+            CHECK_NOTHROW(dispatcher.dispatch(&population, &evaluations));
+        }
+
+        TEST_CASE("dispatch: Concurrent calls each wait for their own population") {
+            DispatcherThreadPool dispatcher(4);
+            std::vector<std::unique_ptr<Evaluation>> evaluations;
+            evaluations.push_back(std::make_unique<CountingEvaluation>(3.0));
+            std::vector<std::unique_ptr<DummyPopulation>> populations;
+            for (size_t i = 0; i < 6; i++) {
+                populations.push_back(std::make_unique<DummyPopulation>(100 + 37 * i));
+            }
+            // individuals still without scores when their dispatch returned
+            std::atomic<int> unevaluated{0};
+            std::vector<std::thread> callers;
+            for (auto &population: populations) {
+                callers.emplace_back([&dispatcher, &evaluations, &population, &unevaluated]() {
+                    std::vector<double> none;
+                    for (int round = 0; round < 20; round++) {
+                        for (size_t i = 0; i < population->getSize(); i++) {
+                            population->getIndividual(i)->setObjectiveScore(&none);
+                        }
+                        dispatcher.dispatch(population.get(), &evaluations);
+                        for (size_t i = 0; i < population->getSize(); i++) {
+                            unevaluated += population->getIndividual(i)->getObjectiveScore().empty() ? 1 : 0;
+                        }
+                    }
+                });
+            }
+            for (auto &caller: callers) {
+                caller.join();
+            }
+            CHECK(unevaluated == 0);
+            int expected = 0;
+            for (auto &population: populations) {
+                expected += 20 * static_cast<int>(population->getSize());
+            }
+            CHECK(dynamic_cast<CountingEvaluation*>(evaluations[0].get())->calls == expected);
+        }
+
+        TEST_CASE("dispatch: Chunks are passed to evaluateBatch when all evaluations support it") {
+            DispatcherThreadPool dispatcher(3);
+            DummyPopulation population(100);
+            std::vector<std::unique_ptr<Evaluation>> evaluations;
+            evaluations.push_back(std::make_unique<BatchEvaluation>());
+            evaluations.push_back(std::make_unique<BatchEvaluation>());
+            dispatcher.dispatch(&population, &evaluations);
+            auto batch = dynamic_cast<BatchEvaluation*>(evaluations[0].get());
+            CHECK(batch->batched == 100);
+            CHECK(batch->calls == 0);
+            for (size_t i = 0; i < population.getSize(); i++) {
+                CHECK(population.getIndividual(i)->getObjectiveScore() == std::vector<double>{3.0, 4.0, 3.0, 4.0});
+            }
+
+            // an evaluation without a known number of objectives makes every evaluation run one phenome at a time
+            evaluations.push_back(std::make_unique<CountingEvaluation>(1.0));
+            dispatcher.dispatch(&population, &evaluations);
+            CHECK(batch->batched == 100);
+            CHECK(batch->calls == 100);
+            CHECK(population.getIndividual(0)->getObjectiveScore() == std::vector<double>{3.0, 4.0, 3.0, 4.0, 1.0});
+        }
+
+        TEST_CASE("dispatchAsync: Individuals complete on the workers without a barrier") {
+            DispatcherThreadPool dispatcher(4);
+            DummyPopulation population(200);
+            std::vector<std::unique_ptr<Evaluation>> evaluations;
+            evaluations.push_back(std::make_unique<CountingEvaluation>(2.0));
+            std::atomic<int> completed{0};
+            std::vector<std::future<void>> futures;
+            for (size_t i = 0; i < population.getSize(); i++) {
+                futures.push_back(dispatcher.dispatchAsync(population.getIndividual(i), &evaluations,
+                                                           [&completed](Individual *, bool succeeded) {
+                                                               completed += succeeded ? 1 : 0;
+                                                           }));
+            }
+            // a blocking dispatch in between is served while individual tasks are still queued
+            DummyPopulation other(50);
+            dispatcher.dispatch(&other, &evaluations);
+            for (auto &future: futures) {
+                future.get();
+            }
+            CHECK(completed == 200);
+            for (size_t i = 0; i < population.getSize(); i++) {
+                CHECK(population.getIndividual(i)->getObjectiveScore() == std::vector<double>{2.0});
+            }
+
+            evaluations.clear();
+            evaluations.push_back(std::make_unique<ThrowingEvaluation>());
+            bool reported = true;
+            auto failed = dispatcher.dispatchAsync(population.getIndividual(0), &evaluations,
+                                                   [&reported](Individual *, bool succeeded) {
+                                                       reported = succeeded;
+                                                   });
+            CHECK_THROWS_AS(failed.get(), std::runtime_error);
+            CHECK_FALSE(reported);
+        }
+
+        TEST_CASE("constructor: Zero threads falls back to a single worker") {
+            DispatcherThreadPool dispatcher(0);
+            CHECK(dispatcher.getThreadsNumber() == 1);
+        }
+    }
+}
@@ -126,3 +126,204 @@
 //         CHECK_THROWS_AS(evaluator.evaluate(&phenome), std::invalid_argument);
 //     }
 // }
+
+#include "../doctest.h"
+
+import EvaluationTravellingSalesman;
+import PhenomeIntVector;
+import Dispatcher;
+import IndividualSimple;
+import GenomeVector;
+import Phenome1DNoTranslation;
+import MutatorRandomSwap;
+import DefaultUniformIntRandomGenerator;
+import std;
+
+using namespace Geneticxx;
+
+namespace EvaluationTravellingSalesmanTest {
+    double** circleCities(int count) {
+        auto array = new double*[count];
+        for (int i = 0; i < count; i++) {
+            const double angle = 2 * std::numbers::pi * i / count;
+            array[i] = new double[2]{100 * std::cos(angle) + i % 7, 100 * std::sin(angle) - i % 5};
+        }
+        return array;
+    }
+
+    TEST_SUITE("EvaluationTravellingSalesman") {
+        TEST_CASE("evaluate: Closed route over the default cities") {
+            EvaluationTravellingSalesman evaluator;
+            PhenomeIntVector route(8, {0, 1, 2, 3, 4, 5, 6, 7});
+            auto result = evaluator.evaluate(&route);
+            REQUIRE(result.size() == 1);
+            CHECK(result[0] == doctest::Approx(7 + std::sqrt(8.0) + std::sqrt(5.0)));
+            CHECK(evaluator.hasDistanceMatrix());
+
+            // city 0 visited twice doubles the distance twice
+            PhenomeIntVector revisit(8, {0, 1, 2, 3, 4, 5, 6, 0});
+            CHECK(evaluator.evaluate(&revisit)[0] == doctest::Approx(4 * (7 + std::sqrt(8.0) + 1)));
+
+            PhenomeIntVector tooShort(3, {0, 1, 2});
+            CHECK_THROWS_AS(evaluator.evaluate(&tooShort), std::invalid_argument);
+        }
+
+        TEST_CASE("evaluate: Distances computed on the fly match the distance matrix") {
+            constexpr int cities = 50;
+            EvaluationTravellingSalesman matrix(cities, circleCities(cities));
+            EvaluationTravellingSalesman onTheFly(cities, circleCities(cities), 0);
+            CHECK(matrix.hasDistanceMatrix());
+            CHECK_FALSE(onTheFly.hasDistanceMatrix());
+
+            std::vector<int> order(cities);
+            std::iota(order.begin(), order.end(), 0);
+            std::mt19937 engine(7);
+            std::shuffle(order.begin(), order.end(), engine);
+            PhenomeIntVector route(cities, order);
+            CHECK(matrix.evaluate(&route)[0] == doctest::Approx(onTheFly.evaluate(&route)[0]));
+            CHECK(matrix.getDistance(3, 41) == doctest::Approx(onTheFly.getDistance(41, 3)));
+
+            std::vector<const Phenome *> batch = {&route, &route};
+            std::vector<double> scores(batch.size());
+            onTheFly.evaluateBatch(batch, scores);
+            CHECK(scores[0] == doctest::Approx(matrix.evaluate(&route)[0]));
+            CHECK(scores[1] == scores[0]);
+        }
+
+        TEST_CASE("fromTsplib: Cities are read from the NODE_COORD_SECTION") {
+            std::istringstream input(
+                "NAME : square\n"
+                "TYPE : TSP\n"
+                "DIMENSION : 4\n"
+                "EDGE_WEIGHT_TYPE : EUC_2D\n"
+                "NODE_COORD_SECTION\n"
+                "1 0 0\n"
+                "2 3 0\n"
+                "3 3 4\n"
+                "4 0 4\n"
+                "EOF\n");
+            auto evaluator = EvaluationTravellingSalesman::fromTsplib(input);
+            CHECK(evaluator->getRows() == 4);
+            CHECK(evaluator->getDistance(0, 2) == doctest::Approx(5));
+
+            PhenomeIntVector route(4, {0, 1, 2, 3});
+            CHECK(evaluator->evaluate(&route)[0] == doctest::Approx(14));
+
+            std::istringstream explicitWeights(
+                "TYPE : TSP\n"
+                "DIMENSION : 4\n"
+                "EDGE_WEIGHT_TYPE : EXPLICIT\n");
+            CHECK_THROWS_AS(EvaluationTravellingSalesman::fromTsplib(explicitWeights), std::runtime_error);
+        }
+
+        TEST_CASE("fromTsplib: Distances follow the TSPLIB edge weight type") {
+            auto load = [](const std::string &type, std::size_t maxMatrixBytes) {
+                std::istringstream input(
+                    "TYPE : TSP\n"
+                    "DIMENSION : 4\n"
+                    "EDGE_WEIGHT_TYPE : " + type + "\n"
+                    "NODE_COORD_SECTION\n"
+                    "1 0 0\n"
+                    "2 1 1\n"
+                    "3 10 10\n"
+                    "4 30 40\n"
+                    "EOF\n");
+                return EvaluationTravellingSalesman::fromTsplib(input, maxMatrixBytes);
+            };
+            // the distance matrix and the distances computed on the fly agree
+            for (std::size_t maxMatrixBytes: {EvaluationTravellingSalesman::DefaultMaxMatrixBytes, std::size_t{0}}) {
+                auto euclidean = load("EUC_2D", maxMatrixBytes);
+                CHECK(euclidean->getDistanceType() == DistanceType::Euc2D);
+                CHECK(euclidean->getDistance(0, 1) == 1.0);
+                CHECK(euclidean->getDistance(0, 3) == 50.0);
+
+                auto ceiling = load("CEIL_2D", maxMatrixBytes);
+                CHECK(ceiling->getDistance(0, 1) == 2.0);
+                CHECK(ceiling->getDistance(1, 2) == 13.0);
+
+                // pseudo-Euclidean: sqrt(200 / 10) = 4.47 rounds up to 5, sqrt(2500 / 10) = 15.8 rounds to 16
+                auto att = load("ATT", maxMatrixBytes);
+                CHECK(att->getDistance(0, 2) == 5.0);
+                CHECK(att->getDistance(0, 3) == 16.0);
+
+                PhenomeIntVector route(4, {0, 1, 2, 3});
+                const double length = att->getDistance(0, 1) + att->getDistance(1, 2) + att->getDistance(2, 3) +
+                                      att->getDistance(3, 0);
+                CHECK(att->evaluate(&route)[0] == length);
+            }
+        }
+
+        TEST_CASE("evaluateDelta: Swapped cities update the distance of the route") {
+            constexpr int cities = 30;
+            std::vector<int> order(cities);
+            std::iota(order.begin(), order.end(), 0);
+            auto evaluator = std::make_unique<EvaluationTravellingSalesman>(cities, circleCities(cities));
+            evaluator->setPermutationRoutes(true);
+            std::vector<std::unique_ptr<Evaluation>> evaluations;
+            evaluations.push_back(std::move(evaluator));
+
+            IndividualSimple individual(new Phenome1DNoTranslation<int>(), new GenomeVector<int>(order));
+            individual.updatePhenome();
+            auto initial = evaluations[0]->evaluate(individual.getPhenome());
+            individual.setObjectiveScore(&initial);
+
+            DefaultUniformIntRandomGenerator genInt(3);
+            MutatorRandomSwap mutator(&genInt);
+            std::vector<GeneChange> changes;
+            for (int i = 0; i < 20; i++) {
+                changes.clear();
+                REQUIRE(mutator.mutateTracked(individual.getGenome(), changes));
+                CHECK(changes.size() == 2);
+                individual.invalidatePhenome();
+                CHECK(evaluateChanges(&individual, changes, &evaluations));
+                CHECK(individual.getObjectiveScore()[0] ==
+                      doctest::Approx(evaluations[0]->evaluate(individual.getPhenome())[0]));
+            }
+
+            // replacing a city changes the cities of the route, so the route is evaluated again
+            PhenomeIntVector revisit(cities, order);
+            std::vector<double> scores = evaluations[0]->evaluate(&revisit);
+            revisit.setValue(4, 5);
+            const std::vector<GeneChange> replaced = {{4, 4}};
+            CHECK_FALSE(evaluations[0]->evaluateDelta(&revisit, replaced, scores));
+        }
+
+        TEST_CASE("evaluateDelta: Routes not declared permutations are evaluated again") {
+            constexpr int cities = 8;
+            EvaluationTravellingSalesman evaluator(cities, circleCities(cities));
+            // cities 1 and 6 are visited twice, 3 and 4 never, so the length is scaled by 2^4
+            PhenomeIntVector route(cities, {0, 1, 2, 1, 5, 6, 7, 6});
+            std::vector<double> scores = evaluator.evaluate(&route);
+
+            route.setValue(1, 5);
+            route.setValue(4, 1);
+            const std::vector<GeneChange> swapped = {{1, 1}, {4, 5}};
+            CHECK_FALSE(evaluator.evaluateDelta(&route, swapped, scores));
+
+            evaluator.setPermutationRoutes(true);
+            CHECK_THROWS_AS(evaluator.evaluate(&route), std::invalid_argument);
+        }
+
+        TEST_CASE("evaluateDelta: Only the edges next to the changes are read") {
+            constexpr int cities = 12;
+            EvaluationTravellingSalesman evaluator(cities, circleCities(cities));
+            evaluator.setPermutationRoutes(true);
+            std::vector<int> order(cities);
+            std::iota(order.begin(), order.end(), 0);
+            PhenomeIntVector route(cities, order);
+            std::vector<double> scores = evaluator.evaluate(&route);
+
+            std::swap(order[2], order[3]);
+            PhenomeIntVector swappedRoute(cities, order);
+            const double expected = evaluator.evaluate(&swappedRoute)[0];
+
+            // a city unknown to the evaluation far from the swap makes any pass over the whole route fail
+            route.setValue(2, 3);
+            route.setValue(3, 2);
+            route.setValue(8, -1);
+            const std::vector<GeneChange> swapped = {{2, 2}, {3, 3}};
+            REQUIRE(evaluator.evaluateDelta(&route, swapped, scores));
+            CHECK(scores[0] == doctest::Approx(expected));
+        }
+    }
+}
@@ -0,0 +1,248 @@
+#include "../doctest.h"
+
+import GeneticAlgorithmSimple;
+import PopulationSimple;
+import PopulationMigratory;
+import IndividualSimple;
+import GenomeVector;
+import Phenome1DNoTranslation;
+import SelectorTournament;
+import SelectorRoulette;
+import CrossoverUniform;
+import Mutator1DPointBitFlip;
+import ReplacementFull;
+import ReplacementElitist;
+import ScalingWithout;
+import InitializeNoInit;
+import DispatcherNoDispatch;
+import PhiloxUniformIntRandomGenerator;
+import PhiloxUniformRealRandomGenerator;
+import std;
+
+using namespace Geneticxx;
+
+namespace GeneticAlgorithmSimpleTest {
+    constexpr size_t GenesNumber = 48;
+
+    class OneMax : public Evaluation {
+    public:
+        std::vector<double> evaluate(const Phenome *phenome) override {
+            auto values = dynamic_cast<const Phenome1DView<bool> *>(phenome)->getValues();
+            return {static_cast<double>(std::ranges::count(values, 1))};
+        }
+    };
+
+    class NeverStop : public StoppingCriterionSchema {
+    public:
+        bool check(Population *population) override {
+            return false;
+        }
+    };
+
+    Population *createPopulation(Population *population, size_t size, unsigned int seed) {
+        std::mt19937 engine(seed);
+        population->resize(size);
+        for (size_t i = 0; i < size; i++) {
+            std::vector<bool> genes(GenesNumber);
+            for (size_t gene = 0; gene < GenesNumber; gene++) {
+                genes[gene] = engine() % 4 == 0;
+            }
+            population->setIndividual(i, new IndividualSimple(new Phenome1DNoTranslation<bool>(),
+                                                              new GenomeVector<bool>(genes)));
+        }
+        return population;
+    }
+
+    BreedingOperators createOperators(unsigned int seed) {
+        BreedingOperators operators;
+        operators.genInt = std::make_unique<PhiloxUniformIntRandomGenerator>(seed);
+        operators.genReal = std::make_unique<PhiloxUniformRealRandomGenerator>(seed, 1);
+        operators.selection = std::make_unique<SelectorTournament>(operators.genInt.get(), 3);
+        operators.crossover = std::make_unique<CrossoverUniform>(operators.genInt.get());
+        operators.mutation = std::make_unique<Mutator1DPointBitFlip>(operators.genInt.get());
+        return operators;
+    }
+
+    BreedingOperators createRouletteOperators(unsigned int seed) {
+        BreedingOperators operators = createOperators(seed);
+        operators.selection = std::make_unique<SelectorRoulette>(operators.genReal.get());
+        return operators;
+    }
+
+    std::vector<std::vector<std::uint8_t>> genesOf(Population *population) {
+        std::vector<std::vector<std::uint8_t>> genes;
+        for (size_t i = 0; i < population->getSize(); i++) {
+            auto values = asGenomeView<bool>(population->getIndividual(i)->getGenome())->getValues();
+            genes.emplace_back(values.begin(), values.end());
+        }
+        return genes;
+    }
+
+    std::vector<Individual *> individualsOf(Population *population) {
+        std::vector<Individual *> individuals;
+        for (size_t i = 0; i < population->getSize(); i++) {
+            individuals.push_back(population->getIndividual(i));
+        }
+        std::ranges::sort(individuals);
+        return individuals;
+    }
+
+    /// Returns every individual with the highest fitness of the population.
+    std::vector<Individual *> bestOf(Population *population) {
+        double fitness = population->getIndividual(0)->getFitness();
+        for (size_t i = 1; i < population->getSize(); i++) {
+            fitness = std::max(fitness, population->getIndividual(i)->getFitness());
+        }
+        std::vector<Individual *> best;
+        for (size_t i = 0; i < population->getSize(); i++) {
+            if (population->getIndividual(i)->getFitness() == fitness) {
+                best.push_back(population->getIndividual(i));
+            }
+        }
+        return best;
+    }
+
+    /// Algorithm over populations of random bit strings, with the shared operators drawing from its own generators.
+    struct Fixture {
+        PhiloxUniformIntRandomGenerator genInt{11};
+        PhiloxUniformRealRandomGenerator genReal{12};
+        /// Populations owned by the algorithm, which keeps evolving them in place.
+        std::vector<Population *> populations;
+        std::unique_ptr<GeneticAlgorithmSimple> algorithm;
+
+        explicit Fixture(std::vector<Population *> populations, size_t size = 64) : populations{populations} {
+            std::vector<std::unique_ptr<Population>> owned;
+            for (size_t i = 0; i < populations.size(); i++) {
+                owned.emplace_back(createPopulation(populations[i], size, static_cast<unsigned int>(i + 1)));
+            }
+            algorithm = std::make_unique<GeneticAlgorithmSimple>(
+                &owned, new OneMax(), new ReplacementFull(), new CrossoverUniform(&genInt),
+                new Mutator1DPointBitFlip(&genInt), new ScalingWithout(), new SelectorTournament(&genInt, 3),
+                new InitializeNoInit(), new NeverStop(), new DispatcherNoDispatch(), &genReal);
+        }
+    };
+
+    TEST_SUITE("GeneticAlgorithmSimple") {
+        TEST_CASE("Parallel breeding gives the same populations for 1 and 4 threads") {
+            Fixture serial({new PopulationSimple()});
+            Fixture parallel({new PopulationSimple()});
+            serial.algorithm->setParallelBreeding(1, createOperators, 7, 8);
+            parallel.algorithm->setParallelBreeding(4, createOperators, 7, 8);
+            serial.algorithm->initialize();
+            parallel.algorithm->initialize();
+            const auto initial = genesOf(serial.populations[0]);
+
+            serial.algorithm->step(5);
+            parallel.algorithm->step(5);
+
+            const auto bred = genesOf(serial.populations[0]);
+            CHECK(bred != initial);
+            CHECK(bred == genesOf(parallel.populations[0]));
+        }
+
+        TEST_CASE("Parallel breeding with a roulette gives the same populations for 1 and 3 threads") {
+            Fixture serial({new PopulationSimple()});
+            Fixture parallel({new PopulationSimple()});
+            serial.algorithm->setParallelBreeding(1, createRouletteOperators, 3, 8);
+            parallel.algorithm->setParallelBreeding(3, createRouletteOperators, 3, 8);
+            serial.algorithm->initialize();
+            parallel.algorithm->initialize();
+            const auto initial = genesOf(serial.populations[0]);
+
+            serial.algorithm->step(5);
+            parallel.algorithm->step(5);
+
+            const auto bred = genesOf(serial.populations[0]);
+            CHECK(bred != initial);
+            CHECK(bred == genesOf(parallel.populations[0]));
+        }
+
+        TEST_CASE("Parallel breeding builds the operators once per thread") {
+            Fixture fixture({new PopulationSimple()});
+            std::atomic<int> built{0};
+            fixture.algorithm->setParallelBreeding(4, [&built](unsigned int seed) {
+                built++;
+                return createOperators(seed);
+            }, 7, 8);
+            CHECK(built == 4);
+            fixture.algorithm->initialize();
+
+            // 64 individuals in blocks of 8 slots, so every generation has 8 blocks
+            fixture.algorithm->step(3);
+            CHECK(built == 4);
+        }
+
+        TEST_CASE("Islands give the same populations for 1 and 3 threads") {
+            auto createIslands = []() {
+                return std::vector<Population *>{new PopulationMigratory(), new PopulationMigratory(),
+                                                 new PopulationMigratory(), new PopulationMigratory()};
+            };
+            MigrationPolicy policy;
+            policy.topology = MigrationTopology::Random;
+            policy.interval = 1;
+            policy.migrants = 4;
+            Fixture serial(createIslands());
+            Fixture parallel(createIslands());
+            serial.algorithm->setIslandModel(1, policy, createOperators, 5);
+            parallel.algorithm->setIslandModel(3, policy, createOperators, 5);
+            serial.algorithm->initialize();
+            parallel.algorithm->initialize();
+
+            for (int generation = 0; generation < 8; generation++) {
+                serial.algorithm->step();
+                parallel.algorithm->step();
+                for (size_t island = 0; island < serial.populations.size(); island++) {
+                    CHECK(genesOf(serial.populations[island]) == genesOf(parallel.populations[island]));
+                }
+            }
+        }
+
+        TEST_CASE("Double buffering alternates between two sets of individuals in the same population") {
+            Fixture fixture({new PopulationSimple()});
+            fixture.algorithm->setDoubleBuffering(true);
+            fixture.algorithm->initialize();
+            Population *population = fixture.populations[0];
+            const auto initial = individualsOf(population);
+            const size_t iteration = population->getIteration();
+            const size_t version = population->getVersion();
+
+            fixture.algorithm->step();
+            CHECK(population->getIteration() == iteration + 1);
+            CHECK(population->getVersion() != version);
+            const auto first = individualsOf(population);
+            CHECK(first != initial);
+
+            fixture.algorithm->step();
+            CHECK(population->getIteration() == iteration + 2);
+            CHECK(individualsOf(population) == initial);
+
+            fixture.algorithm->step();
+            CHECK(individualsOf(population) == first);
+        }
+
+        TEST_CASE("Double buffering applies the configured replacement") {
+            Fixture fixture({new PopulationSimple()});
+            fixture.algorithm->setReplacementSchema(new ReplacementElitist(1));
+            fixture.algorithm->setDoubleBuffering(true);
+            fixture.algorithm->setMutationChance(1.0);
+            fixture.algorithm->initialize();
+            Population *population = fixture.populations[0];
+
+            const size_t iteration = population->getIteration();
+
+            for (int generation = 0; generation < 10; generation++) {
+                // the elite is one of the best individuals, the full replacement would keep none of them
+                const auto candidates = bestOf(population);
+                const double fitness = candidates.front()->getFitness();
+                fixture.algorithm->step();
+                const auto current = individualsOf(population);
+                CHECK(std::ranges::any_of(candidates, [&current](Individual *candidate) {
+                    return std::ranges::binary_search(current, candidate);
+                }));
+                CHECK(bestOf(population).front()->getFitness() >= fitness);
+                CHECK(population->getSize() == 64);
+            }
+            CHECK(population->getIteration() == iteration + 10);
+        }
+    }
+}
@@ -0,0 +1,97 @@
+#include "../doctest.h"
+
+import GeneticAlgorithmStatic;
+import PopulationSimple;
+import IndividualSimple;
+import GenomeVector;
+import Phenome1DNoTranslation;
+import std;
+
+using namespace Geneticxx;
+
+namespace GeneticAlgorithmStaticTest {
+    struct OneMax {
+        double operator()(const std::vector<int> &genome) const {
+            return static_cast<double>(std::ranges::count(genome, 1));
+        }
+    };
+
+    using Algorithm = GeneticAlgorithmStatic<std::vector<int>, OneMax, StaticSelectorTournament,
+        StaticCrossoverUniform, StaticMutatorPerGene<StaticBitFlip>>;
+
+    Algorithm createAlgorithm(std::uint64_t seed) {
+        std::vector<std::vector<int>> genomes(100, std::vector<int>(64, 0));
+        Algorithm algorithm(std::move(genomes), OneMax{}, StaticSelectorTournament{3}, StaticCrossoverUniform{},
+                            StaticMutatorPerGene<StaticBitFlip>{1.0 / 64}, seed);
+        algorithm.setMutationChance(1.0);
+        algorithm.setElitism(1);
+        return algorithm;
+    }
+
+    class MaxGenerations : public StoppingCriterionSchema {
+    public:
+        bool check(Population *population) override {
+            return population->getIteration() >= 20;
+        }
+    };
+
+    TEST_SUITE("GeneticAlgorithmStatic") {
+        TEST_CASE("Evolution improves the fitness and never loses the elite") {
+            auto algorithm = createAlgorithm(1);
+            algorithm.initialize();
+
+            double best = 0.0;
+            for (int generation = 0; generation < 30; generation++) {
+                algorithm.step();
+                const double current = std::ranges::max(algorithm.getFitness());
+                CHECK(current >= best);
+                best = current;
+            }
+            CHECK(best > 40.0);
+            CHECK(algorithm.getIteration() == 30);
+        }
+
+        TEST_CASE("The generations do not depend on the number of threads") {
+            auto serial = createAlgorithm(5);
+            auto parallel = createAlgorithm(5);
+            serial.setThreads(1, 16);
+            parallel.setThreads(4, 16);
+            serial.initialize();
+            parallel.initialize();
+
+            serial.step(10);
+            parallel.step(10);
+
+            CHECK(std::ranges::equal(serial.getGenomes(), parallel.getGenomes()));
+        }
+
+        TEST_CASE("The wrapper evolves a population through the GeneticAlgorithm interface") {
+            auto population = std::make_unique<PopulationSimple>();
+            population->resize(20);
+            for (size_t i = 0; i < 20; i++) {
+                population->setIndividual(i, new IndividualSimple(new Phenome1DNoTranslation<int>(),
+                                                                  new GenomeVector<int>(std::vector<int>(64, 0))));
+            }
+            std::vector<std::unique_ptr<Population>> populations;
+            populations.push_back(std::move(population));
+
+            GeneticAlgorithmStaticWrapper<int, Algorithm> wrapper(&populations, createAlgorithm(3),
+                                                                  new MaxGenerations());
+            GeneticAlgorithm &algorithm = wrapper;
+            algorithm.initialize();
+            algorithm.evolve();
+
+            auto evolved = wrapper.getPopulation();
+            CHECK(evolved->getIteration() == 20);
+            CHECK(wrapper.getAlgorithm().getIteration() == 20);
+            // the individuals hold the genes and the fitness of the static algorithm
+            for (size_t i = 0; i < evolved->getSize(); i++) {
+                auto individual = evolved->getIndividual(i);
+                auto genes = dynamic_cast<GenomeVector<int> *>(individual->getGenome())->getValues();
+                CHECK(std::ranges::equal(genes, wrapper.getAlgorithm().getGenomes()[i]));
+                CHECK(individual->getFitness() == wrapper.getAlgorithm().getFitness()[i]);
+            }
+            CHECK_THROWS_AS(algorithm.setDispatcher(nullptr), std::logic_error);
+        }
+    }
+}
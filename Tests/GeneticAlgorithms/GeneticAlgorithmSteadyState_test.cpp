@@ -0,0 +1,255 @@
+#include "../doctest.h"
+
+import GeneticAlgorithmSteadyState;
+import PopulationSimple;
+import IndividualSimple;
+import GenomeVector;
+import Phenome1DNoTranslation;
+import SelectorTournament;
+import MutatorRandomSwap;
+import ReplacementFull;
+import ScalingWithout;
+import InitializeNoInit;
+import DispatcherNoDispatch;
+import DispatcherThreadPool;
+import PhiloxUniformIntRandomGenerator;
+import PhiloxUniformRealRandomGenerator;
+import std;
+
+using namespace Geneticxx;
+
+namespace GeneticAlgorithmSteadyStateTest {
+    int geneOf(const Phenome *phenome) {
+        return dynamic_cast<const Phenome1DView<int> *>(phenome)->getValues()[0];
+    }
+
+    /// Scores an individual with its only gene.
+    class GeneValue : public Evaluation {
+    public:
+        std::vector<double> evaluate(const Phenome *phenome) override {
+            return {static_cast<double>(geneOf(phenome))};
+        }
+    };
+
+    /// Breeds one child per call, whose only gene is the next value of the script, regardless of the parents.
+    class ScriptedCrossover : public CrossoverSchema {
+    public:
+        std::deque<int> script;
+        int fallback = 1; ///< Gene of the children once the script is exhausted.
+        size_t calls = 0;
+
+        std::vector<std::unique_ptr<Genome>> crossover(Genome *parent1, Genome *parent2) override {
+            calls++;
+            int value = fallback;
+            if (!script.empty()) {
+                value = script.front();
+                script.pop_front();
+            }
+            std::vector<std::unique_ptr<Genome>> children;
+            children.push_back(std::make_unique<GenomeVector<int>>(std::vector<int>{value}));
+            return children;
+        }
+    };
+
+    /// Scores an individual with its only gene, taking long for the gene 100 and failing for the gene 13.
+    class SlowGeneValue : public Evaluation {
+        std::chrono::milliseconds m_Delay;
+        std::atomic<int> *m_Finished;
+
+    public:
+        SlowGeneValue(std::chrono::milliseconds delay, std::atomic<int> *finished)
+            : m_Delay{delay}, m_Finished{finished} {
+        }
+
+        std::vector<double> evaluate(const Phenome *phenome) override {
+            const int gene = geneOf(phenome);
+            if (gene == 13) {
+                throw std::runtime_error("Evaluation failed");
+            }
+            if (gene == 100) {
+                std::this_thread::sleep_for(m_Delay);
+                ++*m_Finished;
+            }
+            return {static_cast<double>(gene)};
+        }
+    };
+
+    class NeverStop : public StoppingCriterionSchema {
+    public:
+        bool check(Population *population) override {
+            return false;
+        }
+    };
+
+    class StopAt : public StoppingCriterionSchema {
+        size_t m_Iteration;
+
+    public:
+        explicit StopAt(size_t iteration) : m_Iteration{iteration} {
+        }
+
+        bool check(Population *population) override {
+            return population->getIteration() >= m_Iteration;
+        }
+    };
+
+    /// Returns the sorted genes of a population.
+    std::vector<int> valuesOf(Population *population) {
+        std::vector<int> values;
+        for (size_t i = 0; i < population->getSize(); i++) {
+            values.push_back(asGenomeView<int>(population->getIndividual(i)->getGenome())->getValues()[0]);
+        }
+        std::ranges::sort(values);
+        return values;
+    }
+
+    /// Steady-state algorithm over a population of four individuals with the genes 10, 20, 30 and 40, breeding
+    /// one scripted child per step without mutation.
+    struct Fixture {
+        PhiloxUniformIntRandomGenerator genInt{3};
+        PhiloxUniformRealRandomGenerator genReal{4};
+        /// Population owned by the algorithm.
+        Population *population = new PopulationSimple();
+        /// Crossover owned by the algorithm.
+        ScriptedCrossover *crossover = new ScriptedCrossover();
+        std::unique_ptr<GeneticAlgorithmSteadyState> algorithm;
+
+        Fixture(Evaluation *evaluation, Dispatcher *dispatcher,
+                StoppingCriterionSchema *stoppingCriterion = new NeverStop()) {
+            population->resize(4);
+            for (size_t i = 0; i < 4; i++) {
+                population->setIndividual(i, new IndividualSimple(new Phenome1DNoTranslation<int>(),
+                                                                  new GenomeVector<int>(std::vector<int>{
+                                                                      static_cast<int>(10 * (i + 1))
+                                                                  })));
+            }
+            std::vector<std::unique_ptr<Population>> populations;
+            populations.emplace_back(population);
+            algorithm = std::make_unique<GeneticAlgorithmSteadyState>(
+                &populations, evaluation, crossover, new MutatorRandomSwap(&genInt), new ScalingWithout(),
+                new SelectorTournament(&genInt, 2), new InitializeNoInit(), stoppingCriterion, dispatcher, &genReal,
+                1);
+            algorithm->setMutationChance(0.0);
+            algorithm->initialize();
+        }
+    };
+
+    TEST_SUITE("GeneticAlgorithmSteadyState") {
+        TEST_CASE("FitnessTournamentTree: The root is the lowest fitness, ties go to the lower index") {
+            FitnessTournamentTree tree;
+            std::vector<double> fitness{5.0, 2.0, 7.0, 2.0, 9.0};
+            tree.build(fitness);
+            CHECK(tree.getSize() == 5);
+            CHECK(tree.worst() == 1);
+
+            tree.update(1, 8.0);
+            CHECK(tree.worst() == 3);
+            tree.update(3, 10.0);
+            CHECK(tree.worst() == 0);
+            tree.update(4, std::numeric_limits<double>::quiet_NaN());
+            CHECK(tree.worst() == 4);
+            CHECK(tree.getFitness(3) == 10.0);
+        }
+
+        TEST_CASE("FitnessTournamentTree: Updates agree with a linear scan") {
+            std::mt19937 engine(7);
+            std::uniform_real_distribution<double> distribution(0.0, 100.0);
+            for (size_t size: {1, 2, 3, 17, 64}) {
+                std::vector<double> fitness(size);
+                for (auto &value: fitness) {
+                    value = distribution(engine);
+                }
+                FitnessTournamentTree tree;
+                tree.build(fitness);
+                for (int i = 0; i < 200; i++) {
+                    const size_t index = engine() % size;
+                    fitness[index] = distribution(engine);
+                    tree.update(index, fitness[index]);
+                    CHECK(tree.worst() == static_cast<size_t>(std::ranges::min_element(fitness) - fitness.begin()));
+                }
+            }
+            CHECK_THROWS_AS(FitnessTournamentTree{}.worst(), std::out_of_range);
+        }
+
+        TEST_CASE("step: A better child replaces the worst individual, a worse one is rejected") {
+            Fixture fixture(new GeneValue(), new DispatcherNoDispatch());
+            fixture.crossover->script = {25, 5, 35, 1};
+            const size_t iteration = fixture.population->getIteration();
+
+            fixture.algorithm->step();
+            CHECK(valuesOf(fixture.population) == std::vector{20, 25, 30, 40});
+            fixture.algorithm->step();
+            CHECK(valuesOf(fixture.population) == std::vector{20, 25, 30, 40});
+            fixture.algorithm->step();
+            CHECK(valuesOf(fixture.population) == std::vector{25, 30, 35, 40});
+            CHECK(fixture.population->getIteration() == iteration);
+
+            // the fourth child completes a generation equivalent, even though it is rejected
+            fixture.algorithm->step();
+            CHECK(valuesOf(fixture.population) == std::vector{25, 30, 35, 40});
+            CHECK(fixture.population->getIteration() == iteration + 1);
+        }
+
+        TEST_CASE("evolve: The iteration advances once per population size children") {
+            Fixture fixture(new GeneValue(), new DispatcherNoDispatch(), new StopAt(3));
+            REQUIRE(fixture.population->getIteration() == 0);
+            fixture.algorithm->evolve();
+            CHECK(fixture.population->getIteration() == 3);
+            CHECK(fixture.crossover->calls == 12);
+        }
+
+        TEST_CASE("Asynchronous evaluation: Children are integrated in the order their evaluations complete") {
+            std::atomic<int> finished{0};
+            Fixture fixture(new SlowGeneValue(std::chrono::milliseconds(300), &finished), new DispatcherThreadPool(2));
+            fixture.algorithm->setAsynchronousEvaluation(2);
+            // the slow child is bred first, the fast one overtakes it
+            fixture.crossover->script = {100, 50};
+
+            fixture.algorithm->step();
+            CHECK(valuesOf(fixture.population) == std::vector{20, 30, 40, 50});
+            CHECK(finished == 0);
+
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (valuesOf(fixture.population).back() != 100 && std::chrono::steady_clock::now() < deadline) {
+                fixture.algorithm->step();
+            }
+            CHECK(valuesOf(fixture.population) == std::vector{30, 40, 50, 100});
+        }
+
+        TEST_CASE("Asynchronous evaluation: A failing evaluation is rethrown by step and its child discarded") {
+            std::atomic<int> finished{0};
+            Fixture fixture(new SlowGeneValue(std::chrono::milliseconds(0), &finished), new DispatcherThreadPool(2));
+            fixture.algorithm->setAsynchronousEvaluation(1);
+            fixture.crossover->script = {13, 60};
+
+            CHECK_THROWS_AS(fixture.algorithm->step(), std::runtime_error);
+            CHECK(valuesOf(fixture.population) == std::vector{10, 20, 30, 40});
+
+            // the failed child left no slot in flight behind
+            fixture.algorithm->step();
+            CHECK(valuesOf(fixture.population) == std::vector{20, 30, 40, 60});
+        }
+
+        TEST_CASE("Asynchronous evaluation: Children in flight are discarded once evaluated on destruction") {
+            std::atomic<int> finished{0};
+            Fixture fixture(new SlowGeneValue(std::chrono::milliseconds(100), &finished), new DispatcherThreadPool(1));
+            fixture.algorithm->setAsynchronousEvaluation(3);
+            fixture.crossover->script = {100, 100, 100};
+
+            // the single worker evaluates the children one after another, the step integrates the first one only
+            fixture.algorithm->step();
+            CHECK(valuesOf(fixture.population) == std::vector{20, 30, 40, 100});
+            CHECK(finished < 3);
+
+            // the worker still evaluates the other children, so they are freed only once their evaluations finished
+            fixture.algorithm.reset();
+            CHECK(finished == 3);
+        }
+
+        TEST_CASE("setReplacementSchema: The replacement of the worst individual cannot be changed") {
+            Fixture fixture(new GeneValue(), new DispatcherNoDispatch());
+            ReplacementFull replacement;
+            CHECK_THROWS_AS(fixture.algorithm->setReplacementSchema(&replacement), std::logic_error);
+        }
+    }
+}
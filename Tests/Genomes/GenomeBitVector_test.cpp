@@ -0,0 +1,81 @@
+#include "../doctest.h"
+
+import GenomeBitVector;
+import std;
+
+using namespace Geneticxx;
+
+namespace GenomeBitVectorTest {
+    std::vector<bool> pattern(size_t size, size_t stride) {
+        std::vector<bool> bits(size);
+        for (size_t i = 0; i < size; i++) {
+            bits[i] = i % stride == 0;
+        }
+        return bits;
+    }
+
+    TEST_SUITE("GenomeBitVector") {
+        TEST_CASE("getValue/setValue: Bits are stored across word boundaries") {
+            GenomeBitVector genome(130);
+            genome.setValue(0, true);
+            genome.setValue(64, true);
+            genome.setValue(129, true);
+            CHECK(std::any_cast<bool>(genome.getValue(0)));
+            CHECK_FALSE(std::any_cast<bool>(genome.getValue(63)));
+            CHECK(std::any_cast<bool>(genome.getValue(64)));
+            CHECK(std::any_cast<bool>(genome.getValue(129)));
+            CHECK(genome.getWords().size() == 3);
+            CHECK(genome.countOnes() == 3);
+            CHECK_THROWS_AS(genome.setValue(130, true), std::out_of_range);
+        }
+
+        TEST_CASE("distance and operator==: Whole words are compared") {
+            GenomeBitVector first(pattern(200, 3));
+            GenomeBitVector second(pattern(200, 3));
+            CHECK(first == &second);
+            CHECK(first.distance(&second) == 0.0);
+
+            second.setValue(5, true);
+            second.setValue(150, false);
+            CHECK_FALSE(first == &second);
+            CHECK(first.hammingDistance(second) == 2);
+            CHECK(first.distance(&second) == doctest::Approx(2.0 / 200));
+
+            GenomeBitVector shorter(pattern(199, 3));
+            CHECK_FALSE(first == &shorter);
+            CHECK(first.distance(&shorter) == 1.0);
+        }
+
+        TEST_CASE("Gray representation: Round trip matches the bitwise definition") {
+            auto binary = pattern(150, 7);
+            std::vector<bool> gray(binary.size());
+            gray[0] = binary[0];
+            for (size_t i = 1; i < binary.size(); i++) {
+                gray[i] = binary[i - 1] ^ binary[i];
+            }
+
+            GenomeBitVector genome(binary);
+            CHECK(genome.getGrayRepresentation() == gray);
+
+            GenomeBitVector decoded;
+            decoded.setGrayRepresentation(gray);
+            CHECK(decoded == &genome);
+            CHECK(decoded.getSize() == 150);
+        }
+
+        TEST_CASE("flipMasked and blendMasked: Words are combined under a mask") {
+            GenomeBitVector genome(70);
+            std::vector<std::uint64_t> mask = {0b101, ~std::uint64_t{0}};
+            genome.flipMasked(mask);
+            // bits past the end of the genome are never set
+            CHECK(genome.countOnes() == 2 + 6);
+            CHECK(std::any_cast<bool>(genome.getValue(2)));
+
+            GenomeBitVector donor(pattern(70, 1));
+            genome.clearDirty();
+            genome.blendMasked(donor, std::vector<std::uint64_t>{0b010});
+            CHECK(genome.countOnes() == 3 + 6);
+            CHECK(genome.getDirtyRange() == std::pair<size_t, size_t>{0, 64});
+        }
+    }
+}
@@ -3,6 +3,9 @@
 import Genome1D;
 import Phenome1D;
 import IndividualSimple;
+import GenomeVector;
+import Phenome1DNoTranslation;
+import PhenomeBoolToDouble;
 import std;
 
 using namespace Geneticxx;
@@ -426,6 +429,53 @@ namespace IndividualSimpleTest {
                 CHECK(cloneSimple->getObjectiveScore() == original.getObjectiveScore());
             }
         }
+        TEST_CASE("invalidatePhenome: Decoding is deferred until the phenome is read") {
+            auto dg = new DummyGenomeIndividualSimple(5);
+            auto dp = new DummyPhenomeIndividualSimple(0);
+            IndividualSimple individual(dp, dg);
+            individual.invalidatePhenome();
+            CHECK(dp->updated == false);
+            individual.getPhenome();
+            CHECK(dp->updated == true);
+            CHECK(dp->trait == 5);
+        }
+
+        TEST_CASE("updatePhenome: Only genes marked dirty are decoded again") {
+            auto genome = new GenomeVector<int>(std::vector<int>{1, 2, 3, 4});
+            auto phenome = new Phenome1DNoTranslation<int>();
+            IndividualSimple individual(phenome, genome);
+            individual.updatePhenome();
+            CHECK(genome->getDirtyRange().first == genome->getDirtyRange().second);
+
+            // the write to gene 0 is not reported, so it is not picked up by the next update
+            genome->getValues()[0] = 10;
+            genome->getValues()[2] = 30;
+            genome->markDirty(2, 3);
+            individual.updatePhenome();
+            CHECK(std::any_cast<int>(phenome->getValue(0)) == 1);
+            CHECK(std::any_cast<int>(phenome->getValue(2)) == 30);
+
+            // a new genome is always decoded in full
+            individual.setGenome(new GenomeVector<int>(std::vector<int>{5, 6, 7, 8}));
+            individual.updatePhenome();
+            CHECK(std::any_cast<int>(phenome->getValue(0)) == 5);
+        }
+
+        TEST_CASE("PhenomeBoolToDouble: Range update decodes only the overlapping values") {
+            // two values of 2 exponent bits and 1 mantissa bit each: 10|1 -> 2.5, 01|0 -> 1.0
+            auto genome = new GenomeVector<bool>(std::vector<bool>{true, false, true, false, true, false});
+            auto phenome = new PhenomeBoolToDouble(2, 2, 1);
+            IndividualSimple individual(phenome, genome);
+            individual.updatePhenome();
+            CHECK(std::any_cast<double>(phenome->getValue(0)) == doctest::Approx(2.5));
+            CHECK(std::any_cast<double>(phenome->getValue(1)) == doctest::Approx(1.0));
+
+            genome->setValue(5, true);
+            individual.invalidatePhenome();
+            auto decoded = dynamic_cast<const Phenome1D*>(individual.getPhenome());
+            CHECK(std::any_cast<double>(decoded->getValue(0)) == doctest::Approx(2.5));
+            CHECK(std::any_cast<double>(decoded->getValue(1)) == doctest::Approx(1.5));
+        }
         /// TODO: If Genome::clone() or Phenome::clone() throws, does IndividualSimple remain in a valid state? (This one is a bit more advanced.)
     }
 }
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "../doctest.h"
+
+import Mutator1DPointBitFlip;
+import PhiloxUniformIntRandomGenerator;
+import GenomeBitVector;
+import std;
+
+using namespace Geneticxx;
+
+namespace Mutator1DPointBitFlipTest {
+    TEST_SUITE("Mutator1DPointBitFlip") {
+        TEST_CASE("Point mode flips exactly one bit") {
+            PhiloxUniformIntRandomGenerator generator(1);
+            Mutator1DPointBitFlip mutator(&generator);
+            GenomeBitVector genome(100);
+
+            mutator.mutate(&genome);
+
+            CHECK(genome.countOnes() == 1);
+        }
+
+        TEST_CASE("Per-gene mode flips bits with the given probability and keeps the padding clear") {
+            PhiloxUniformIntRandomGenerator generator(2);
+            Mutator1DPointBitFlip mutator(&generator, 0.25);
+            GenomeBitVector genome(10000 + 7);
+
+            mutator.mutate(&genome);
+
+            CHECK(genome.countOnes() > 2300);
+            CHECK(genome.countOnes() < 2700);
+            CHECK((genome.getWords().back() >> 7) == 0);
+        }
+
+        TEST_CASE("Per-gene mode reports every flipped bit") {
+            PhiloxUniformIntRandomGenerator generator(3);
+            Mutator1DPointBitFlip mutator(&generator, 0.5);
+            GenomeBitVector genome(200);
+
+            std::vector<GeneChange> changes;
+            CHECK(mutator.mutateTracked(&genome, changes));
+
+            CHECK(changes.size() == genome.countOnes());
+            for (const auto &change: changes) {
+                CHECK_FALSE(std::any_cast<bool>(change.previousValue));
+                CHECK(std::any_cast<bool>(genome.getValue(change.position)));
+            }
+        }
+
+        TEST_CASE("Probabilities outside [0, 1] are rejected") {
+            PhiloxUniformIntRandomGenerator generator(4);
+            CHECK_THROWS_AS(Mutator1DPointBitFlip(&generator, 1.5), std::invalid_argument);
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#include "../doctest.h"
+
+import Mutator1DRandomValueAddition;
+import PhiloxUniformIntRandomGenerator;
+import PhiloxUniformRealRandomGenerator;
+import GenomeVector;
+import std;
+
+using namespace Geneticxx;
+
+namespace Mutator1DRandomValueAdditionTest {
+    TEST_SUITE("Mutator1DRandomValueAddition") {
+        TEST_CASE("A value from the range is added to one real gene") {
+            PhiloxUniformIntRandomGenerator genInt(1);
+            PhiloxUniformRealRandomGenerator genReal(2);
+            Mutator1DRandomValueAddition<double> mutator(&genInt, &genReal, 0.5, 1.0);
+            GenomeVector<double> genome(std::vector<double>(10, 0.0));
+
+            std::vector<GeneChange> changes;
+            REQUIRE(mutator.mutateAt(&genome, 3, &changes));
+
+            const double value = std::any_cast<double>(genome.getValue(3));
+            CHECK(value >= 0.5);
+            CHECK(value < 1.0);
+            REQUIRE(changes.size() == 1);
+            CHECK(std::any_cast<double>(changes[0].previousValue) == 0.0);
+        }
+
+        TEST_CASE("Integral genes are rejected instead of truncating the added value") {
+            PhiloxUniformIntRandomGenerator genInt(3);
+            PhiloxUniformRealRandomGenerator genReal(4);
+            Mutator1DRandomValueAddition<int> mutator(&genInt, &genReal);
+            GenomeVector<int> genome(std::vector<int>(10, 5));
+
+            CHECK_THROWS_AS(mutator.mutate(&genome), std::bad_any_cast);
+            CHECK(std::ranges::count(asGenomeView<int>(&genome)->getValues(), 5) == 10);
+        }
+    }
+}
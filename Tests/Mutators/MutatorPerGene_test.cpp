@@ -0,0 +1,67 @@
+#include "../doctest.h"
+
+import MutatorPerGene;
+import Mutator1DPointBitFlip;
+import MutatorPointReplacement;
+import PhiloxUniformIntRandomGenerator;
+import PhiloxUniformRealRandomGenerator;
+import GenomeBitVector;
+import GenomeVector;
+import std;
+
+using namespace Geneticxx;
+
+namespace MutatorPerGeneTest {
+    TEST_SUITE("MutatorPerGene") {
+        TEST_CASE("Genes are mutated with the given probability") {
+            PhiloxUniformIntRandomGenerator genInt(1);
+            PhiloxUniformRealRandomGenerator genReal(2);
+            MutatorPerGene mutator(new Mutator1DPointBitFlip(&genInt), &genReal, 0.01);
+            GenomeBitVector genome(100000);
+
+            mutator.mutate(&genome);
+
+            CHECK(genome.countOnes() > 850);
+            CHECK(genome.countOnes() < 1150);
+        }
+
+        TEST_CASE("Probabilities of 0 and 1 mutate no gene and every gene") {
+            PhiloxUniformIntRandomGenerator genInt(3);
+            PhiloxUniformRealRandomGenerator genReal(4);
+            GenomeBitVector genome(300);
+
+            MutatorPerGene(new Mutator1DPointBitFlip(&genInt), &genReal, 0.0).mutate(&genome);
+            CHECK(genome.countOnes() == 0);
+
+            MutatorPerGene(new Mutator1DPointBitFlip(&genInt), &genReal, 1.0).mutate(&genome);
+            CHECK(genome.countOnes() == 300);
+        }
+
+        TEST_CASE("Tracked mutations report every mutated gene once, in order") {
+            PhiloxUniformIntRandomGenerator genInt(5);
+            PhiloxUniformRealRandomGenerator genReal(6);
+            MutatorPerGene mutator(new MutatorPointReplacement(&genInt, &genReal, 1.0, 2.0), &genReal, 0.05);
+            GenomeVector<double> genome(std::vector<double>(1000, 0.0));
+
+            std::vector<GeneChange> changes;
+            CHECK(mutator.mutateTracked(&genome, changes));
+
+            REQUIRE_FALSE(changes.empty());
+            CHECK(std::ranges::adjacent_find(changes, std::ranges::greater_equal{}, &GeneChange::position) ==
+                  changes.end());
+            const auto values = genome.getValues();
+            CHECK(static_cast<size_t>(std::ranges::count_if(values, [](double value) { return value != 0.0; })) ==
+                  changes.size());
+            for (const auto &change: changes) {
+                CHECK(std::any_cast<double>(change.previousValue) == 0.0);
+            }
+        }
+
+        TEST_CASE("A missing mutation and invalid probabilities are rejected") {
+            PhiloxUniformRealRandomGenerator genReal(7);
+            CHECK_THROWS_AS(MutatorPerGene(nullptr, &genReal, 0.5), std::invalid_argument);
+            CHECK_THROWS_AS(MutatorPerGene(new Mutator1DPointBitFlip(nullptr), &genReal, 1.5),
+                            std::invalid_argument);
+        }
+    }
+}
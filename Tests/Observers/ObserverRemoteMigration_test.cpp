@@ -0,0 +1,76 @@
+#include "../doctest.h"
+#include "../TestIndividuals.h"
+
+import ObserverRemoteMigration;
+import TransportSharedMemory;
+import PopulationSimple;
+import GenomeBitVector;
+import std;
+
+using namespace Geneticxx;
+
+namespace ObserverRemoteMigrationTest {
+    using TestIndividuals::createIndividual;
+
+    std::vector<int> genesOf(Individual *individual) {
+        auto values = asGenomeView<int>(individual->getGenome())->getValues();
+        return {values.begin(), values.end()};
+    }
+
+    TEST_SUITE("ObserverRemoteMigration") {
+        TEST_CASE("serializeIndividual: Genome, scores and fitness survive a round trip") {
+            std::unique_ptr<Individual> original(createIndividual({4, 8, 15, 16, 23, 42}, 3.5, {3.5, -3.5}));
+            std::vector<std::byte> message;
+            REQUIRE(serializeIndividual(original.get(), message));
+
+            std::unique_ptr<Individual> copy(createIndividual({}, 0.0, {0.0, -0.0}));
+            CHECK(deserializeIndividual(message, copy.get()) == message.size());
+            CHECK(genesOf(copy.get()) == std::vector<int>{4, 8, 15, 16, 23, 42});
+            CHECK(copy->getObjectiveScore() == std::vector<double>{3.5, -3.5});
+            CHECK(copy->getFitness() == 3.5);
+            CHECK(copy->getPhenome()->getSize() == 6);
+
+            // truncated messages are rejected
+            CHECK(deserializeIndividual(std::span(message).first(message.size() - 1), copy.get()) == 0);
+
+            GenomeBitVector bits(std::vector<bool>{true, false, true, true, false});
+            std::vector<std::byte> bytes;
+            REQUIRE(bits.serialize(bytes));
+            GenomeBitVector readBits;
+            REQUIRE(readBits.deserialize(bytes));
+            CHECK(readBits == &bits);
+        }
+
+#if defined(__unix__) || defined(__APPLE__)
+        TEST_CASE("sendMigrants/receiveMigrants: The best individuals replace the worst ones of the other island") {
+            const std::string name = "geneticxx-test-" + std::to_string(std::random_device{}());
+            ObserverRemoteMigration first(new TransportSharedMemory(name, 0, 2, 4096),
+                                          MigrationPolicy{MigrationTopology::Ring, 1, 2, true});
+            ObserverRemoteMigration second(new TransportSharedMemory(name, 1, 2, 4096),
+                                           MigrationPolicy{MigrationTopology::Ring, 1, 2, true});
+
+            PopulationSimple source;
+            source.resize(4);
+            for (int i = 0; i < 4; i++) {
+                source.setIndividual(i, createIndividual({i, i, i}, i, {static_cast<double>(i), -static_cast<double>(i)}));
+            }
+            PopulationSimple target;
+            target.resize(3);
+            target.setIndividual(0, createIndividual({7}, 5.0, {5.0, -5.0}));
+            target.setIndividual(1, createIndividual({8}, -1.0, {-1.0, 1.0}));
+            target.setIndividual(2, createIndividual({9}, -2.0, {-2.0, 2.0}));
+
+            CHECK(first.sendMigrants(&source) == 1);
+            CHECK(second.receiveMigrants(&target) == 2);
+            CHECK(target.getIndividual(0)->getFitness() == 5);
+            CHECK(target.getIndividual(1)->getFitness() == 2);
+            CHECK(genesOf(target.getIndividual(1)) == std::vector<int>{2, 2, 2});
+            CHECK(target.getIndividual(2)->getFitness() == 3);
+            CHECK(genesOf(target.getIndividual(2)) == std::vector<int>{3, 3, 3});
+
+            // nothing is waiting anymore
+            CHECK(second.receiveMigrants(&target) == 0);
+        }
+#endif
+    }
+}
@@ -0,0 +1,83 @@
+#include "../doctest.h"
+#include "../TestIndividuals.h"
+
+import PopulationMigratory;
+import std;
+
+using namespace Geneticxx;
+
+namespace PopulationMigratoryTest {
+    using TestIndividuals::createIndividual;
+
+    std::vector<std::unique_ptr<Individual>> createMigrants(std::initializer_list<double> fitness) {
+        std::vector<std::unique_ptr<Individual>> migrants;
+        for (double value: fitness) {
+            migrants.emplace_back(createIndividual({1, 2}, value));
+        }
+        return migrants;
+    }
+
+    std::vector<double> fitnessOf(Population &population) {
+        std::vector<double> fitness;
+        for (size_t i = 0; i < population.getSize(); i++) {
+            fitness.push_back(population.getIndividual(i)->getFitness());
+        }
+        return fitness;
+    }
+
+    TEST_SUITE("PopulationMigratory") {
+        TEST_CASE("MigrationMailbox: Concurrent posts are collected in the order of their sources") {
+            MigrationMailbox mailbox;
+            CHECK(mailbox.empty());
+            {
+                std::vector<std::jthread> senders;
+                for (size_t source = 0; source < 4; source++) {
+                    senders.emplace_back([&mailbox, source]() {
+                        for (int i = 0; i < 50; i++) {
+                            mailbox.post(source, createMigrants({static_cast<double>(source)}));
+                        }
+                    });
+                }
+            }
+            CHECK_FALSE(mailbox.empty());
+
+            auto migrants = mailbox.collect();
+            REQUIRE(migrants.size() == 200);
+            for (size_t i = 0; i < migrants.size(); i++) {
+                CHECK(migrants[i]->getFitness() == static_cast<double>(i / 50));
+            }
+            CHECK(mailbox.empty());
+            CHECK(mailbox.collect().empty());
+        }
+
+        TEST_CASE("immigrate: The best migrants replace the worst individuals") {
+            PopulationMigratory population;
+            population.resize(5);
+            for (size_t i = 0; i < 5; i++) {
+                population.setIndividual(i, createIndividual({1, 2}, static_cast<double>(i + 1)));
+            }
+
+            // populations created from the island receive its migrants, clones do not
+            auto offspring = population.createNew();
+            auto copy = population.clone();
+            CHECK(dynamic_cast<PopulationMigratory *>(offspring.get())->getMailbox() == population.getMailbox());
+            CHECK(dynamic_cast<PopulationMigratory *>(copy.get())->getMailbox() != population.getMailbox());
+
+            population.getMailbox()->post(1, createMigrants({0, 7}));
+            population.getMailbox()->post(0, createMigrants({10}));
+            CHECK(population.immigrate(MigrationPolicy{MigrationTopology::Ring, 1, 2, true}) == 2);
+            CHECK(fitnessOf(population) == std::vector<double>{10, 7, 3, 4, 5});
+            CHECK(population.getMailbox()->empty());
+
+            auto emigrants = population.selectEmigrants(2, true);
+            REQUIRE(emigrants.size() == 2);
+            CHECK(emigrants[0]->getFitness() == 10);
+            CHECK(emigrants[1]->getFitness() == 7);
+
+            // when minimizing the lowest fitness is the best
+            population.getMailbox()->post(0, createMigrants({1}));
+            CHECK(population.immigrate(MigrationPolicy{MigrationTopology::Ring, 1, 2, false}) == 1);
+            CHECK(fitnessOf(population) == std::vector<double>{1, 7, 3, 4, 5});
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#include "../doctest.h"
+#include "../TestIndividuals.h"
+
+import PopulationSoA;
+import IndividualSimple;
+import Phenome1DNoTranslation;
+import std;
+
+using namespace Geneticxx;
+
+namespace PopulationSoATest {
+    using TestIndividuals::createIndividual;
+
+    TEST_SUITE("PopulationSoA") {
+        TEST_CASE("setIndividual: Copies fitness, scores and genes into the columns") {
+            // Arrange
+            PopulationSoA<int> population(3, 1, new Phenome1DNoTranslation<int>());
+            population.resize(2);
+            // Act
+            population.setIndividual(0, createIndividual({1, 2, 3}, 1.5, {3.0}));
+            population.setIndividual(1, createIndividual({4, 5, 6}, 2.5, {5.0}));
+            // Assert
+            CHECK(population.getSize() == 2);
+            CHECK(population.getIndividual(1)->getFitness() == 2.5);
+            CHECK(population.getIndividual(1)->getObjectiveScore() == std::vector<double>{5.0});
+            auto genes = population.getGenes(1);
+            CHECK(std::vector<int>(genes.begin(), genes.end()) == std::vector<int>{4, 5, 6});
+            auto fitness = population.getFitnessValues();
+            CHECK(std::vector<double>(fitness.begin(), fitness.end()) == std::vector<double>{1.5, 2.5});
+            // The phenome of the slot was updated from the copied genes.
+            auto phenome = dynamic_cast<const Phenome1D*>(population.getIndividual(0)->getPhenome());
+            REQUIRE(phenome != nullptr);
+            CHECK(std::any_cast<int>(phenome->getValue(2)) == 3);
+        }
+
+        TEST_CASE("Row views write through to the population") {
+            PopulationSoA<int> population(2);
+            population.resize(1);
+            auto individual = population.getIndividual(0);
+            individual->setFitness(7.0);
+            dynamic_cast<Genome1D*>(individual->getGenome())->setValue(1, 42);
+            CHECK(population.getFitnessValues()[0] == 7.0);
+            CHECK(population.getGenes(0)[1] == 42);
+        }
+
+        TEST_CASE("clone: Produces an independent copy and standalone individuals") {
+            PopulationSoA<int> population(3, 1, new Phenome1DNoTranslation<int>());
+            population.setIndividual(0, createIndividual({1, 2, 3}, 1.0, {2.0}));
+            auto copy = population.clone();
+            copy->getIndividual(0)->setFitness(9.0);
+            CHECK(population.getIndividual(0)->getFitness() == 1.0);
+
+            std::unique_ptr<Individual> detached{population.getIndividual(0)->clone()};
+            population.getIndividual(0)->setFitness(3.0);
+            CHECK(detached->getFitness() == 1.0);
+            CHECK(dynamic_cast<IndividualSimple*>(detached.get()) != nullptr);
+        }
+
+        TEST_CASE("setIndividual: Mismatched layout is rejected") {
+            PopulationSoA<int> population(3);
+            population.resize(1);
+            CHECK_THROWS_AS(population.setIndividual(0, createIndividual({1, 2}, 1.0, {2.0})), std::invalid_argument);
+            std::vector<double> scores = {1.0, 2.0};
+            CHECK_THROWS_AS(population.getIndividual(0)->setObjectiveScore(&scores), std::invalid_argument);
+        }
+    }
+}
@@ -0,0 +1,110 @@
+#include "../doctest.h"
+
+import PhiloxEngine;
+import PhiloxUniformIntRandomGenerator;
+import PhiloxUniformRealRandomGenerator;
+import std;
+
+using namespace Geneticxx;
+
+namespace PhiloxEngineTest {
+    std::vector<int> draw(RandomIntFromRange &generator, size_t count) {
+        std::vector<int> values(count);
+        for (auto &value: values) {
+            value = generator.generate(0, 1000);
+        }
+        return values;
+    }
+
+    TEST_SUITE("PhiloxEngine") {
+        TEST_CASE("Blocks match the known answers of Philox4x32-10") {
+            CHECK(PhiloxEngine::block(0, 0, 0) ==
+                  PhiloxEngine::Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+            CHECK(PhiloxEngine::block(~0ull, ~0ull, ~0ull) ==
+                  PhiloxEngine::Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+            CHECK(PhiloxEngine::block(0x299f31d0a4093822ull, 0x0370734413198a2eull, 0x85a308d3243f6a88ull) ==
+                  PhiloxEngine::Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+        }
+
+        TEST_CASE("Filling gives the same words as drawing them one by one") {
+            PhiloxEngine filled(5, 7);
+            PhiloxEngine drawn(5, 7);
+            filled.next32();
+            drawn.next32();
+
+            std::vector<std::uint64_t> words(11);
+            filled.fill(words);
+
+            for (auto word: words) {
+                CHECK(word == drawn());
+            }
+            CHECK(filled() == drawn());
+        }
+
+        TEST_CASE("Split streams are reproducible, distinct and do not advance the parent") {
+            PhiloxUniformIntRandomGenerator parent(42);
+            auto first = parent.split(3);
+            draw(parent, 10);
+            auto again = parent.split(3);
+            auto other = parent.split(4);
+
+            const auto values = draw(*first, 64);
+            CHECK(values == draw(*again, 64));
+            CHECK(values != draw(*other, 64));
+            CHECK(values != draw(parent, 64));
+        }
+
+        TEST_CASE("Reseeding restarts the generator at the stream split would draw") {
+            PhiloxUniformIntRandomGenerator generator(42);
+            const auto expected = draw(*generator.split(3), 64);
+
+            draw(generator, 10);
+            REQUIRE(generator.reseed(3));
+            CHECK(draw(generator, 64) == expected);
+
+            // streams derive from the generator as created, not from the last reseed
+            REQUIRE(generator.reseed(4));
+            REQUIRE(generator.reseed(3));
+            CHECK(draw(generator, 64) == expected);
+            CHECK(draw(*generator.split(3), 64) == expected);
+        }
+
+        TEST_CASE("Batch generation matches sequential generation and stays in range") {
+            PhiloxUniformIntRandomGenerator batch(9);
+            PhiloxUniformIntRandomGenerator sequential(9);
+            std::vector<int> values(200);
+            batch.generate(-3, 3, values);
+            for (auto value: values) {
+                CHECK(value == sequential.generate(-3, 3));
+            }
+            CHECK(std::ranges::min(values) == -3);
+            CHECK(std::ranges::max(values) == 3);
+
+            PhiloxUniformRealRandomGenerator real(9);
+            std::vector<double> reals(200);
+            real.generate(2.0, 4.0, reals);
+            CHECK(std::ranges::all_of(reals, [](double value) { return value >= 2.0 && value < 4.0; }));
+        }
+
+        TEST_CASE("Masks set every bit with the given probability") {
+            PhiloxUniformIntRandomGenerator generator(11);
+            std::vector<std::uint64_t> words(1000);
+            auto ones = [&words]() {
+                size_t count = 0;
+                for (auto word: words) {
+                    count += std::popcount(word);
+                }
+                return static_cast<double>(count) / (words.size() * 64);
+            };
+
+            generator.generateMask(0.0, words);
+            CHECK(ones() == 0.0);
+            generator.generateMask(1.0, words);
+            CHECK(ones() == 1.0);
+            generator.generateMask(0.5, words);
+            CHECK(ones() == doctest::Approx(0.5).epsilon(0.02));
+            generator.generateMask(0.1, words);
+            CHECK(ones() == doctest::Approx(0.1).epsilon(0.05));
+        }
+    }
+}
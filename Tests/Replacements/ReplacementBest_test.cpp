@@ -0,0 +1,100 @@
+#include "../doctest.h"
+
+import ReplacementBest;
+import ReplacementElitist;
+import PopulationSimple;
+import IndividualSimple;
+import GenomeVector;
+import Phenome1DNoTranslation;
+import std;
+
+using namespace Geneticxx;
+
+namespace ReplacementBestTest {
+    std::unique_ptr<PopulationSimple> createPopulation(std::vector<double> fitness) {
+        auto population = std::make_unique<PopulationSimple>();
+        population->resize(fitness.size());
+        for (size_t i = 0; i < fitness.size(); i++) {
+            auto individual = new IndividualSimple(new Phenome1DNoTranslation<int>(),
+                                                   new GenomeVector<int>(std::vector<int>{static_cast<int>(i)}));
+            individual->setFitness(fitness[i]);
+            population->setIndividual(i, individual);
+        }
+        return population;
+    }
+
+    std::vector<double> fitnessOf(Population &population) {
+        std::vector<double> fitness;
+        for (size_t i = 0; i < population.getSize(); i++) {
+            fitness.push_back(population.getIndividual(i)->getFitness());
+        }
+        return fitness;
+    }
+
+    TEST_SUITE("ReplacementBest") {
+        TEST_CASE("partitionBest: The best individuals come first, ties and NaN are deterministic") {
+            std::vector<size_t> order;
+            std::vector<double> fitness{3, std::numeric_limits<double>::quiet_NaN(), 9, 3, 1, 7};
+            partitionBest(fitness, 3, true, order);
+            std::vector<size_t> best(order.begin(), order.begin() + 3);
+            std::ranges::sort(best);
+            CHECK(best == std::vector<size_t>{0, 2, 5});
+
+            partitionBest(fitness, 2, false, order);
+            best.assign(order.begin(), order.begin() + 2);
+            std::ranges::sort(best);
+            CHECK(best == std::vector<size_t>{0, 4});
+        }
+
+        TEST_CASE("replace: (mu + lambda) keeps the best of parents and offspring in place") {
+            auto parents = createPopulation({5, 1, 8, 2});
+            auto offspring = createPopulation({6, 0, 9});
+            auto first = parents->getIndividual(0);
+            ReplacementBest replacement(TruncationMode::Plus);
+            replacement.replace(parents.get(), offspring.get());
+            // surviving parents keep their slots and objects, children fill the slots of the discarded ones
+            CHECK(parents->getIndividual(0) == first);
+            CHECK(parents->getIndividual(2)->getFitness() == 8);
+            auto fitness = fitnessOf(*parents);
+            std::ranges::sort(fitness);
+            CHECK(fitness == std::vector<double>{5, 6, 8, 9});
+            CHECK(parents->getIteration() == 1);
+        }
+
+        TEST_CASE("replace: (mu, lambda) keeps the best offspring only") {
+            auto parents = createPopulation({50, 60});
+            auto offspring = createPopulation({3, 7, 5});
+            auto best = offspring->getIndividual(1);
+            ReplacementBest replacement(TruncationMode::Comma);
+            replacement.replace(parents.get(), offspring.get());
+            auto fitness = fitnessOf(*parents);
+            std::ranges::sort(fitness);
+            CHECK(fitness == std::vector<double>{5, 7});
+            // children are moved, not cloned
+            CHECK((parents->getIndividual(0) == best || parents->getIndividual(1) == best));
+
+            auto few = createPopulation({1});
+            CHECK_THROWS_AS(replacement.replace(parents.get(), few.get()), std::invalid_argument);
+        }
+
+        TEST_CASE("ReplacementElitist: Elites survive and the worst offspring make room for them") {
+            auto parents = createPopulation({4, 9, 1, 7});
+            auto offspring = createPopulation({2, 3, 8, 0, 5});
+            ReplacementElitist replacement(2);
+            replacement.replace(parents.get(), offspring.get());
+            CHECK(parents->getSize() == 5);
+            CHECK(parents->getIndividual(1)->getFitness() == 9);
+            CHECK(parents->getIndividual(3)->getFitness() == 7);
+            auto fitness = fitnessOf(*parents);
+            std::ranges::sort(fitness);
+            CHECK(fitness == std::vector<double>{3, 5, 7, 8, 9});
+
+            // shrinking the population moves elites from the dropped slots down
+            auto next = createPopulation({1, 1});
+            replacement.replace(parents.get(), next.get());
+            fitness = fitnessOf(*parents);
+            std::ranges::sort(fitness);
+            CHECK(fitness == std::vector<double>{8, 9});
+        }
+    }
+}
@@ -3,6 +3,7 @@
 import Individual;
 import Population;
 import ReplacementFull;
+import PopulationSimple;
 import std;
 
 using namespace Geneticxx;
@@ -185,5 +186,29 @@ namespace ReplacementFullTest {
                 CHECK(result->getIndividual(i) != replacing->getIndividual(i));
             }
         }
+
+        TEST_CASE("replace: PopulationSimple takes over the replacing individuals without copying them") {
+            PopulationSimple original;
+            original.resize(2);
+            original.setIndividual(0, new DummyIndividual(1.0));
+            original.setIndividual(1, new DummyIndividual(2.0));
+            PopulationSimple replacing;
+            replacing.resize(3);
+            for (size_t i = 0; i < 3; i++) {
+                replacing.setIndividual(i, new DummyIndividual(4.0 + static_cast<double>(i)));
+            }
+            auto first = replacing.getIndividual(0);
+
+            ReplacementFull replacer;
+            replacer.replace(&original, &replacing);
+
+            CHECK(original.getSize() == 3);
+            CHECK(original.getIndividual(0) == first);
+            CHECK(original.getIndividual(2)->getFitness() == 6.0);
+            CHECK(original.getIteration() == 1);
+            // the storages were exchanged, the replacing population holds the previous generation
+            CHECK(replacing.getSize() == 2);
+            CHECK(replacing.getIndividual(1)->getFitness() == 2.0);
+        }
     }
 }
\ No newline at end of file
@@ -145,25 +145,25 @@ namespace SelectorRouletteTest {
 
         TEST_CASE("select: Returns empty vector when population is empty") {
             // Arrange
-            auto *genReal = new DefaultUniformRealRandomGenerator(42);
+            DefaultUniformRealRandomGenerator genReal(42);
             DummyPopulation population;
-            SelectorRoulette selector(genReal);
+            SelectorRoulette selector(&genReal);
             // Act
             auto selected = selector.select(&population, 5);
             // Assert
             CHECK(selected.size() == 0);
         }
 
-        TEST_CASE("updatePartialSums & select: Selected individuals are clones with correct fitness values") {
+        TEST_CASE("updateAliasTable & select: Selected individuals are clones with correct fitness values") {
             // Arrange: Create a dummy population with individuals of known fitness values.
-            auto *genReal = new DefaultUniformRealRandomGenerator(42);
+            DefaultUniformRealRandomGenerator genReal(42);
             DummyPopulation population;
             std::vector<double> fitnessValues = {10.0, 20.0, 30.0, 40.0};
             for (double f : fitnessValues) {
                 population.addIndividual(new DummyIndividual(f));
             }
             // Total fitness = 100.0 and partial sums should be [10, 30, 60, 100].
-            SelectorRoulette selector(genReal);
+            SelectorRoulette selector(&genReal);
             // Act: Request selection of 10 individuals.
             auto selected = selector.select(&population, 10);
             // Assert:
@@ -195,12 +195,124 @@ namespace SelectorRouletteTest {
             }
         }
 
+        TEST_CASE("selectIndices: Writes valid indices without copying individuals") {
+            // Arrange
+            DefaultUniformRealRandomGenerator genReal(42);
+            DummyPopulation population;
+            population.addIndividual(new DummyIndividual(0.0));
+            population.addIndividual(new DummyIndividual(10.0));
+            population.addIndividual(new DummyIndividual(0.0));
+            SelectorRoulette selector(&genReal);
+            std::vector<size_t> indices(20, 99);
+            // Act
+            bool selected = selector.selectIndices(&population, indices);
+            // Assert: only the individual with non-zero fitness can be drawn.
+            CHECK(selected);
+            for (auto index : indices) {
+                CHECK(index == 1);
+            }
+        }
+
+        TEST_CASE("selectIndices: Reuses the alias table until the population version changes") {
+            // Arrange
+            DefaultUniformRealRandomGenerator genReal(42);
+            DummyPopulation population;
+            population.addIndividual(new DummyIndividual(10.0));
+            population.addIndividual(new DummyIndividual(0.0));
+            SelectorRoulette selector(&genReal);
+            std::vector<size_t> indices(10);
+            selector.selectIndices(&population, indices);
+            // Act: change fitness in place, which does not change the version.
+            population.getIndividual(0)->setFitness(0.0);
+            population.getIndividual(1)->setFitness(10.0);
+            selector.selectIndices(&population, indices);
+            // Assert: the cached table is still used.
+            for (auto index : indices) {
+                CHECK(index == 0);
+            }
+            // Act: a new iteration changes the version and rebuilds the table.
+            population.increaseIteration();
+            selector.selectIndices(&population, indices);
+            for (auto index : indices) {
+                CHECK(index == 1);
+            }
+        }
+
+        TEST_CASE("selectIndices: Draws follow the fitness proportions") {
+            DefaultUniformRealRandomGenerator genReal(7);
+            DummyPopulation population;
+            for (double f : {10.0, 20.0, 30.0, 40.0}) {
+                population.addIndividual(new DummyIndividual(f));
+            }
+            SelectorRoulette selector(&genReal);
+            std::vector<size_t> indices(40000);
+            selector.selectIndices(&population, indices);
+            std::array<int, 4> counts{};
+            for (auto index : indices) {
+                REQUIRE(index < 4);
+                counts[index]++;
+            }
+            // expected 4000, 8000, 12000 and 16000 draws, the tolerance is about five standard deviations
+            CHECK(std::abs(counts[0] - 4000) < 350);
+            CHECK(std::abs(counts[1] - 8000) < 450);
+            CHECK(std::abs(counts[2] - 12000) < 500);
+            CHECK(std::abs(counts[3] - 16000) < 500);
+        }
+
+        TEST_CASE("selectIndices: The alias table is rebuilt for another population") {
+            DefaultUniformRealRandomGenerator genReal(42);
+            DummyPopulation first;
+            first.addIndividual(new DummyIndividual(10.0));
+            first.addIndividual(new DummyIndividual(0.0));
+            DummyPopulation second;
+            second.addIndividual(new DummyIndividual(0.0));
+            second.addIndividual(new DummyIndividual(10.0));
+            SelectorRoulette selector(&genReal);
+            std::vector<size_t> indices(10);
+            // Act: both populations have the same version, only their identity differs.
+            selector.selectIndices(&first, indices);
+            selector.selectIndices(&second, indices);
+            // Assert
+            for (auto index : indices) {
+                CHECK(index == 1);
+            }
+            // Act: invalidating drops the table even for the same population and version.
+            second.getIndividual(0)->setFitness(10.0);
+            second.getIndividual(1)->setFitness(0.0);
+            selector.invalidate();
+            selector.selectIndices(&second, indices);
+            for (auto index : indices) {
+                CHECK(index == 0);
+            }
+        }
+
+        TEST_CASE("selectIndices: Zero total fitness selects uniformly") {
+            DefaultUniformRealRandomGenerator genReal(42);
+            DummyPopulation population;
+            for (int i = 0; i < 4; i++) {
+                population.addIndividual(new DummyIndividual(0.0));
+            }
+            SelectorRoulette selector(&genReal);
+            std::vector<size_t> indices(400);
+            selector.selectIndices(&population, indices);
+            std::set<size_t> drawn(indices.begin(), indices.end());
+            CHECK(drawn.size() == 4);
+        }
+
+        TEST_CASE("selectIndices: Throws when selecting from an empty population") {
+            DefaultUniformRealRandomGenerator genReal(42);
+            DummyPopulation population;
+            SelectorRoulette selector(&genReal);
+            std::vector<size_t> indices(1);
+            CHECK_THROWS_AS(selector.selectIndices(&population, indices), std::invalid_argument);
+        }
+
         TEST_CASE("select: Returns clones that are independent copies") {
             // Arrange: Create a population with a single individual.
-            auto *genReal = new DefaultUniformRealRandomGenerator(42);
+            DefaultUniformRealRandomGenerator genReal(42);
             DummyPopulation population;
             population.addIndividual(new DummyIndividual(55.5));
-            SelectorRoulette selector(genReal);
+            SelectorRoulette selector(&genReal);
             // Act: Select multiple copies of the same individual.
             auto selected = selector.select(&population, 5);
             // Assert: All selected clones must have the same fitness as the original.
@@ -0,0 +1,82 @@
+#include "../doctest.h"
+
+import SelectorTournament;
+import PopulationSoA;
+import DefaultUniformIntRandomGenerator;
+import std;
+
+using namespace Geneticxx;
+
+namespace SelectorTournamentTest {
+    void fillFitness(PopulationSoA<int> &population, std::vector<double> fitness) {
+        population.resize(fitness.size());
+        for (size_t i = 0; i < fitness.size(); i++) {
+            population.setFitness(i, fitness[i]);
+        }
+    }
+
+    TEST_SUITE("SelectorTournament") {
+        TEST_CASE("selectIndices: Tournament over the whole population picks the best individual") {
+            // Arrange
+            DefaultUniformIntRandomGenerator genInt(42);
+            PopulationSoA<int> population(1);
+            fillFitness(population, {3.0, 7.0, 1.0, 5.0});
+            SelectorTournament maximizing(&genInt, 4, false, true);
+            SelectorTournament minimizing(&genInt, 4, false, false);
+            std::vector<size_t> indices(16);
+            // Act & Assert
+            maximizing.selectIndices(&population, indices);
+            for (auto index : indices) {
+                CHECK(index == 1);
+            }
+            minimizing.selectIndices(&population, indices);
+            for (auto index : indices) {
+                CHECK(index == 2);
+            }
+        }
+
+        TEST_CASE("selectIndices: Winners are never worse than the worst participant") {
+            DefaultUniformIntRandomGenerator genInt(42);
+            PopulationSoA<int> population(1);
+            fillFitness(population, {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0});
+            SelectorTournament selector(&genInt, 3);
+            std::vector<size_t> indices(1000);
+            selector.selectIndices(&population, indices);
+            // with replacement the worst individual only wins if drawn three times
+            auto worst = std::ranges::count(indices, 0);
+            auto best = std::ranges::count(indices, 7);
+            CHECK(best > worst);
+            for (auto index : indices) {
+                CHECK(index < population.getSize());
+            }
+        }
+
+        TEST_CASE("select: Returns clones of the winners") {
+            DefaultUniformIntRandomGenerator genInt(42);
+            PopulationSoA<int> population(1);
+            fillFitness(population, {2.0, 9.0});
+            SelectorTournament selector(&genInt, 2, false);
+            auto selected = selector.select(&population, 3);
+            REQUIRE(selected.size() == 3);
+            for (const auto &individual : selected) {
+                CHECK(individual->getFitness() == 9.0);
+                CHECK(individual.get() != population.getIndividual(1));
+            }
+        }
+
+        TEST_CASE("Invalid configurations are rejected") {
+            DefaultUniformIntRandomGenerator genInt(42);
+            CHECK_THROWS_AS(SelectorTournament(&genInt, 0), std::invalid_argument);
+
+            PopulationSoA<int> population(1);
+            fillFitness(population, {1.0, 2.0});
+            SelectorTournament selector(&genInt, 3, false);
+            std::vector<size_t> indices(1);
+            CHECK_THROWS_AS(selector.selectIndices(&population, indices), std::invalid_argument);
+
+            PopulationSoA<int> empty(1);
+            SelectorTournament withReplacement(&genInt, 3);
+            CHECK_THROWS_AS(withReplacement.selectIndices(&empty, indices), std::invalid_argument);
+        }
+    }
+}
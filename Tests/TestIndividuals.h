@@ -0,0 +1,30 @@
+#pragma once
+
+import IndividualSimple;
+import GenomeVector;
+import Phenome1DNoTranslation;
+import std;
+
+namespace TestIndividuals {
+    /**
+     * @brief Creates an individual over integer genes with its phenome decoded.
+     *
+     * @param genes Genes of the individual.
+     * @param fitness Fitness to set, left unset if empty.
+     * @param scores Objective scores to set, left unset if empty.
+     * @return The individual, owned by the caller.
+     */
+    inline Geneticxx::Individual *createIndividual(std::vector<int> genes, std::optional<double> fitness = {},
+                                                   std::vector<double> scores = {}) {
+        auto individual = new Geneticxx::IndividualSimple(new Geneticxx::Phenome1DNoTranslation<int>(),
+                                                          new Geneticxx::GenomeVector<int>(genes));
+        individual->updatePhenome();
+        if (fitness) {
+            individual->setFitness(*fitness);
+        }
+        if (!scores.empty()) {
+            individual->setObjectiveScore(&scores);
+        }
+        return individual;
+    }
+}
@@ -0,0 +1,52 @@
+#include "../doctest.h"
+
+import TransportTcp;
+import std;
+
+using namespace Geneticxx;
+
+namespace TransportTcpTest {
+    TEST_SUITE("TransportTcp") {
+        TEST_CASE("send: Messages that do not fit are dropped without blocking, the others arrive whole") {
+            TransportTcp sender(47311, 0, 2);
+            TransportTcp receiver(47311, 1, 2);
+
+            // the receiver does not read, so the socket buffers fill up and later messages are dropped
+            std::vector<std::byte> message(100000);
+            std::vector<int> sent;
+            for (int i = 0; i < 500; i++) {
+                std::ranges::fill(message, static_cast<std::byte>(i));
+                if (sender.send(1, message)) {
+                    sent.push_back(i % 256);
+                }
+            }
+            CHECK_FALSE(sent.empty());
+            CHECK(sent.size() < 500);
+
+            std::vector<int> received;
+            std::vector<std::byte> arrived;
+            bool whole = true;
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (received.size() < sent.size() && std::chrono::steady_clock::now() < deadline) {
+                // receiving on the sender writes the rest of a partially written message
+                sender.receive(arrived);
+                while (receiver.receive(arrived)) {
+                    whole = whole && arrived.size() == message.size() &&
+                            std::ranges::all_of(arrived, [&arrived](std::byte value) { return value == arrived[0]; });
+                    received.push_back(std::to_integer<int>(arrived[0]));
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            CHECK(whole);
+            CHECK(received == sent);
+        }
+
+        TEST_CASE("send: Messages for an island that does not listen are dropped") {
+            TransportTcp sender(47321, 0, 2);
+            const std::vector<std::byte> message(16);
+            for (int i = 0; i < 3; i++) {
+                CHECK_FALSE(sender.send(1, message));
+            }
+        }
+    }
+}